@@ -190,6 +190,7 @@ class ContactSubsection;
 class ContactList;
 class ContactListItem;
 class IssuerItem;
+class List;
 class ListRow;
 class MessagableList;
 class PayableList;
@@ -623,6 +623,9 @@ enum class MessageType : std::uint8_t {
     requestAdminResponse = 58,
     addClaim = 59,
     addClaimResponse = 60,
+    // Download every box receipt the client doesn't already have
+    getBoxReceipts = 61,
+    getBoxReceiptsResponse = 62,
 };
 
 enum class ThreadStatus : std::uint8_t {
@@ -26,6 +26,13 @@ public:
         const proto::HDPath& path,
         const BIP44Chain internal,
         const std::uint32_t index) const = 0;
+    /** Export the extended public key for one chain of an account, from which
+     *  every address on that chain can be derived without the seed */
+    EXPORT virtual bool AccountChainPublicKey(
+        const proto::HDPath& path,
+        const BIP44Chain internal,
+        Data& publicKey,
+        Data& chainCode) const = 0;
     EXPORT virtual std::string Bip32Root(
         const std::string& fingerprint = "") const = 0;
     EXPORT virtual std::string DefaultSeed() const = 0;
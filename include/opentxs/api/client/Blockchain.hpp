@@ -14,6 +14,9 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
 
 namespace opentxs
 {
@@ -24,6 +27,10 @@ namespace client
 class Blockchain
 {
 public:
+    /** chain, index, transaction */
+    using IncomingTransactions = std::vector<
+        std::tuple<BIP44Chain, std::uint32_t, proto::BlockchainTransaction>>;
+
     virtual std::shared_ptr<proto::Bip44Account> Account(
         const Identifier& nymID,
         const Identifier& accountID) const = 0;
@@ -35,6 +42,20 @@ public:
         const Identifier& accountID,
         const std::string& label = "",
         const BIP44Chain chain = EXTERNAL_CHAIN) const = 0;
+    /** Ensure at least gap unused addresses follow the most recent address
+     *  on the chain which has received a transaction
+     *
+     *  Missing addresses are derived from the account's extended public key
+     *  in parallel on the timer's worker threads and saved with a single
+     *  write.
+     *
+     *  \returns the number of newly allocated addresses
+     */
+    virtual std::uint32_t AllocateAddresses(
+        const Identifier& nymID,
+        const Identifier& accountID,
+        const std::uint32_t gap,
+        const BIP44Chain chain = EXTERNAL_CHAIN) const = 0;
     virtual bool AssignAddress(
         const Identifier& nymID,
         const Identifier& accountID,
@@ -46,6 +67,19 @@ public:
         const Identifier& accountID,
         const std::uint32_t index,
         const BIP44Chain chain) const = 0;
+    /** Find the account, chain and index to which an address belongs
+     *
+     *  The address index is held in memory only. It is filled from the
+     *  stored accounts as they are loaded, and on a miss every account of
+     *  the nym on the specified chain is loaded before the lookup fails.
+     */
+    virtual bool LookupAddress(
+        const Identifier& nymID,
+        const proto::ContactItemType type,
+        const std::string& address,
+        Identifier& accountID,
+        BIP44Chain& chain,
+        std::uint32_t& index) const = 0;
     virtual OTIdentifier NewAccount(
         const Identifier& nymID,
         const BlockchainAccountType standard,
@@ -56,6 +90,11 @@ public:
         const std::uint32_t index,
         const BIP44Chain chain,
         const proto::BlockchainTransaction& transaction) const = 0;
+    /** Store a batch of incoming transactions with a single write */
+    virtual bool StoreIncoming(
+        const Identifier& nymID,
+        const Identifier& accountID,
+        const IncomingTransactions& transactions) const = 0;
     virtual bool StoreOutgoing(
         const Identifier& senderNymID,
         const Identifier& accountID,
@@ -43,6 +43,8 @@
 
 #include "opentxs/api/storage/Driver.hpp"
 
+#include <chrono>
+
 namespace opentxs
 {
 namespace api
@@ -52,6 +54,13 @@ namespace storage
 class Multiplex : virtual public Driver
 {
 public:
+    /** Returns the number of writes accepted by the primary plugin which
+     *  have not yet been applied to the backup plugins
+     *
+     *  Always zero unless asynchronous backups are enabled. If any writes
+     *  are pending, age is set to the time since the oldest was accepted.
+     */
+    virtual std::size_t BackupLag(std::chrono::milliseconds& age) const = 0;
     virtual std::string BestRoot(bool& primaryOutOfSync) = 0;
     virtual void InitBackup() = 0;
     virtual void InitEncryptedBackup(opentxs::crypto::key::Symmetric& key) = 0;
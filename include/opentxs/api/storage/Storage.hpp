@@ -18,6 +18,8 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <tuple>
+#include <vector>
 
 namespace opentxs
 {
@@ -33,6 +35,9 @@ class Storage
 {
 public:
     using Bip47ChannelList = std::set<OTIdentifier>;
+    /** chain, index, transaction */
+    using BlockchainIncoming = std::vector<
+        std::tuple<BIP44Chain, std::uint32_t, proto::BlockchainTransaction>>;
 
     virtual ObjectList AccountList() const = 0;
     virtual OTIdentifier AccountContract(const Identifier& accountID) const = 0;
@@ -86,6 +91,12 @@ public:
     virtual std::string BlockchainAddressOwner(
         proto::ContactItemType chain,
         std::string address) const = 0;
+    virtual std::set<std::string> BlockchainAddressTransactions(
+        const std::string& accountID,
+        const BIP44Chain chain,
+        const std::uint32_t index) const = 0;
+    virtual std::set<std::string> BlockchainOutgoingTransactions(
+        const std::string& accountID) const = 0;
     virtual ObjectList BlockchainTransactionList() const = 0;
     virtual std::string ContactAlias(const std::string& id) const = 0;
     virtual ObjectList ContactList() const = 0;
@@ -214,8 +225,28 @@ public:
         const bool checking = false) const = 0;
     virtual const std::set<std::string> LocalNyms() const = 0;
     virtual void MapPublicNyms(NymLambda& lambda) const = 0;
+    /** Applies a lambda to at most limit public nyms whose ids sort after
+     *  the specified id, in the calling thread
+     *
+     *  Returns the id of the last nym visited, which should be passed as
+     *  after to continue the walk, or an empty string when no nyms remain.
+     */
+    virtual std::string MapPublicNyms(
+        NymLambda& lambda,
+        const std::string& after,
+        const std::size_t limit) const = 0;
     virtual void MapServers(ServerLambda& lambda) const = 0;
+    /** Same as MapPublicNyms, for server contracts */
+    virtual std::string MapServers(
+        ServerLambda& lambda,
+        const std::string& after,
+        const std::size_t limit) const = 0;
     virtual void MapUnitDefinitions(UnitLambda& lambda) const = 0;
+    /** Same as MapPublicNyms, for unit definitions */
+    virtual std::string MapUnitDefinitions(
+        UnitLambda& lambda,
+        const std::string& after,
+        const std::size_t limit) const = 0;
     virtual bool MoveThreadItem(
         const std::string& nymId,
         const std::string& fromThreadID,
@@ -304,6 +335,15 @@ public:
         const proto::Bip47Channel& data,
         Identifier& channelID) const = 0;
     virtual bool Store(const proto::BlockchainTransaction& data) const = 0;
+    /** Store incoming transactions and associate each of them with the
+     *  receiving address of an account in a single write */
+    virtual bool Store(
+        const std::string& accountID,
+        const BlockchainIncoming& incoming) const = 0;
+    /** Store an outgoing transaction and associate it with an account */
+    virtual bool Store(
+        const std::string& accountID,
+        const proto::BlockchainTransaction& outgoing) const = 0;
     virtual bool Store(const proto::Contact& data) const = 0;
     virtual bool Store(const proto::Context& data) const = 0;
     virtual bool Store(const proto::Credential& data) const = 0;
@@ -85,6 +85,14 @@ private:
     bool harvest_unused(ServerContext& context);
     bool init_new_account(const Identifier& accountID, ServerContext& context)
         const;
+    /** Instantiates a box receipt sent by the server, returning nullptr
+     *  unless it is signed by the server and carries the expected transaction
+     *  number and nym */
+    std::unique_ptr<OTTransaction> instantiate_box_receipt(
+        const String& serialized,
+        const TransactionNumber expected,
+        const Nym& serverNym,
+        const Identifier& nymID) const;
     void ProcessIncomingTransaction(
         const Message& theReply,
         ServerContext& context,
@@ -145,6 +153,9 @@ private:
         ServerContext& context,
         const String& serialized,
         const std::int64_t boxType);
+    bool processServerReplyGetBoxReceipts(
+        const Message& theReply,
+        ServerContext& context);
     bool processServerReplyProcessBox(
         const Message& theReply,
         const Identifier& accountID,
@@ -722,6 +722,18 @@ public:
         std::int32_t nBoxType,         // 0/nymbox, 1/inbox, 2/outbox
         const TransactionNumber& lTransactionNum) const;
 
+    /** Downloads, in one request, every receipt in the specified box which is
+     *  not listed in known. The server may stop early if the receipts are
+     *  large, in which case the reply's m_bBool is true and the caller should
+     *  ask again with the downloaded receipts added to known. */
+    EXPORT CommandResult getBoxReceipts(
+        ServerContext& context,
+        const Identifier& ACCOUNT_ID,  // If for Nymbox (vs
+                                       // inbox/outbox) then pass
+                                       // NYM_ID in this field also.
+        std::int32_t nBoxType,         // 0/nymbox, 1/inbox, 2/outbox
+        const NumList& known) const;
+
     EXPORT CommandResult queryInstrumentDefinitions(
         ServerContext& context,
         const Armored& ENCODED_MAP) const;
@@ -767,7 +779,11 @@ public:
         const String& BASKET_INFO,
         bool bExchangeInOrOut) const;
 
-    EXPORT CommandResult getTransactionNumbers(ServerContext& context) const;
+    /** Requests a block of at least quantity transaction numbers. The server
+     *  issues its default block size if quantity is smaller. */
+    EXPORT CommandResult getTransactionNumbers(
+        ServerContext& context,
+        const std::size_t quantity = 0) const;
 
 #if OT_CASH
     EXPORT CommandResult notarizeWithdrawal(
@@ -77,6 +77,14 @@ public:
         std::int32_t nBoxType,
         std::int64_t strTransactionNum,
         bool& bWasSent);
+    /** Requests every receipt in the box which is not listed in known.
+     *  bMore is set if the server has more receipts to send. */
+    EXPORT bool getBoxReceiptsLowLevel(
+        const std::string& accountID,
+        std::int32_t nBoxType,
+        const NumList& known,
+        bool& bWasSent,
+        bool& bMore);
     EXPORT bool getBoxReceiptWithErrorCorrection(
         const std::string& notaryID,
         const std::string& nymID,
@@ -147,6 +155,19 @@ protected:
     const api::client::Manager& api_;
 
     Utility() = delete;
+
+private:
+    void download_box_receipts(
+        const Identifier& notaryID,
+        const Identifier& nymID,
+        const Identifier& accountID,
+        const std::int32_t nBoxType,
+        const Ledger& box);
+    bool should_download_box_receipt(
+        const Identifier& notaryID,
+        const Identifier& nymID,
+        const OTTransaction& receipt) const;
+
     Utility(const Utility&) = delete;
     Utility(Utility&&) = delete;
     Utility& operator=(const Utility&) = delete;
@@ -15,11 +15,13 @@
 #include "opentxs/core/String.hpp"
 #include "opentxs/Types.hpp"
 
+#include <cstddef>
 #include <cstdint>
 #include <iosfwd>
 #include <list>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace irr
 {
@@ -43,6 +45,16 @@ OTString trim(const String& str);
 class Contract
 {
 public:
+    /** Counters describing the process-wide cache of verified signatures */
+    struct SignatureCacheStatistics {
+        std::uint64_t hits_{0};
+        std::uint64_t misses_{0};
+        std::uint64_t inserts_{0};
+        std::uint64_t evictions_{0};
+        std::size_t size_{0};
+        std::size_t limit_{0};
+    };
+
     /** Used by OTTransactionType::Factory and OTToken::Factory. In both cases,
      * it takes the input string, trims it, and if it's armored, it unarmors it,
      * with the result going into strOutput. On success, bool is returned, and
@@ -301,6 +313,23 @@ public:
         const OTPasswordData* pPWData = nullptr) const;
     EXPORT ConstNym GetContractPublicNym() const;
 
+    /** Verifies the signatures of several contracts signed by the same nym
+     *
+     *  The signatures are handed to the crypto providers in batches. Any
+     *  contract whose batch fails is verified again individually. Returns
+     *  true only if every contract verifies.
+     */
+    EXPORT static bool VerifySignatures(
+        const std::vector<const Contract*>& contracts,
+        const Nym& theNym,
+        const OTPasswordData* pPWData = nullptr);
+
+    /** Discards every remembered signature verification. The statistics are
+     *  reset as well. */
+    EXPORT static void ClearSignatureCache();
+    /** Returns a snapshot of the verified signature cache counters */
+    EXPORT static SignatureCacheStatistics SignatureCache();
+
 protected:
     const api::Core& api_;
 
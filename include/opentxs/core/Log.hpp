@@ -29,6 +29,15 @@
 #define PREDEF_MODE_DEBUG 1
 #endif
 
+/** Only evaluates the streamed arguments if the log level is enabled
+ *
+ *  Usage: OT_LOG_IF(otInfo) << expensive_function() << std::endl;
+ */
+#define OT_LOG_IF(stream)                                                      \
+    if (false == (stream).Enabled()) {                                         \
+    } else                                                                     \
+        (stream)
+
 namespace opentxs
 {
 
@@ -82,7 +91,10 @@ public:
     explicit OTLogStream(int _logLevel);
     ~OTLogStream();
 
+    bool Enabled() const;
+
     virtual int overflow(int c) override;
+    virtual std::streamsize xsputn(const char* s, std::streamsize n) override;
 };
 
 class Log
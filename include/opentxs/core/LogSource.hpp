@@ -9,6 +9,7 @@
 #include "opentxs/Forward.hpp"
 
 #include <atomic>
+#include <cstdint>
 #include <map>
 #include <mutex>
 #include <sstream>
@@ -22,6 +23,7 @@ class LogSource
 {
 public:
     static void SetVerbosity(const int level);
+    static int Verbosity() { return verbosity_.load(); }
     static void Shutdown();
     static const LogSource& StartLog(
         const LogSource& source,
@@ -36,9 +38,12 @@ public:
     template <typename T>
     const LogSource& operator()(const T& in) const
     {
+        if (false == Enabled()) { return *this; }
+
         return this->operator()(std::to_string(in));
     }
 
+    bool Enabled() const { return verbosity_.load() >= level_; }
     void Flush() const;
 
     explicit LogSource(const int logLevel);
@@ -50,12 +55,15 @@ private:
 
     static std::atomic<int> verbosity_;
     static std::atomic<bool> running_;
+    // Incremented whenever buffer_ is cleared, which invalidates the buffer
+    // pointers cached by each thread
+    static std::atomic<std::uint64_t> generation_;
     static std::mutex buffer_lock_;
     static std::map<std::thread::id, Source> buffer_;
 
     const int level_{-1};
 
-    static Source& get_buffer(std::string& id);
+    static Source* get_buffer(const std::string*& id);
 
     LogSource() = delete;
     LogSource(const LogSource&) = delete;
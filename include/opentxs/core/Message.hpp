@@ -135,6 +135,10 @@ public:
     EXPORT void SetAcknowledgments(const Context& context);
     EXPORT void SetAcknowledgments(const std::set<RequestNumber>& numbers);
 
+    /** True if the sender of this message can parse NumList fields which
+     *  contain runs written as "first-last" */
+    EXPORT bool SupportsNumberRanges() const;
+
     EXPORT static void registerStrategy(
         std::string name,
         OTMessageStrategy* strategy);
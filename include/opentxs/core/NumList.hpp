@@ -9,25 +9,40 @@
 #include "opentxs/Forward.hpp"
 
 #include <cstdint>
+#include <map>
 #include <set>
 #include <string>
 
+#define OT_NUMLIST_MAX_RANGE_NUMBERS 100000
+
 namespace opentxs
 {
 /** Useful for storing a std::set of longs, serializing to/from comma-separated
  * string, And easily being able to add/remove/verify the individual transaction
  * numbers that are there. (Used by OTTransaction::blank and
  * OTTransaction::successNotice.) Also used in OTMessage, for storing lists of
- * acknowledged request numbers. */
+ * acknowledged request numbers.
+ *
+ * Numbers are stored as runs of consecutive values, so blocks of sequentially
+ * issued numbers stay small in memory. Runs of three or more numbers may be
+ * serialized as "first-last" for readers which are known to parse that form.
+ * When parsing, the ranges in a single string may add no more than
+ * OT_NUMLIST_MAX_RANGE_NUMBERS numbers in total. */
 class NumList
 {
-    std::set<std::int64_t> m_setData;
+    /** Keyed by the first number in each run, mapped to the last */
+    std::map<std::int64_t, std::int64_t> m_mapRanges;
+    std::size_t m_lCount{0};
 
     /** private for security reasons, used internally only by a function that
      * knows the string length already. if false, means the numbers were already
      * there. (At least one of them.) */
     bool Add(const char* szfNumbers);
 
+    /** Adds every number from first to last, inclusive. if false, means the
+     * numbers were already there. (At least one of them.) */
+    bool add_range(const std::int64_t first, const std::int64_t last);
+
 public:
     explicit EXPORT NumList(const std::set<std::int64_t>& theNumbers);
     explicit EXPORT NumList(std::set<std::int64_t>&& theNumbers);
@@ -88,8 +103,10 @@ public:
     EXPORT bool Output(std::set<std::int64_t>& theOutput) const;
 
     /** Outputs the numlist as a comma-separated string (for serialization,
-     * usually.) returns false if the numlist was empty. */
-    EXPORT bool Output(String& strOutput) const;
+     * usually.) Runs are written as "first-last" only if bRanges is true,
+     * which older peers can not parse. returns false if the numlist was
+     * empty. */
+    EXPORT bool Output(String& strOutput, const bool bRanges = false) const;
     EXPORT void Release();
 };
 
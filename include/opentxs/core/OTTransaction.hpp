@@ -352,6 +352,10 @@ public:
 
     EXPORT bool AddNumbersToTransaction(const NumList& theAddition);
 
+    /** Writes the numbers of a blank or successNotice as "first-last" runs.
+     *  Only set this if the recipient announced that it parses them. */
+    void SetNumberRanges(const bool ranges) { m_bNumberRanges = ranges; }
+
     bool IsAbbreviated() const { return m_bIsAbbreviated; }
 
     std::int64_t GetAbbrevAdjustment() const { return m_lAbbrevAmount; }
@@ -663,6 +667,10 @@ protected:
     // to see if it's set to TRUE, and it will know.
     bool m_bCancelled{false};
 
+    // Not serialized. A transaction which is loaded again writes its numbers
+    // in the plain comma-separated form, which every peer can parse.
+    bool m_bNumberRanges{false};
+
     // return -1 if error, 0 if nothing, and 1 if the node was processed.
     std::int32_t ProcessXMLNode(irr::io::IrrXMLReader*& xml) override;
 
@@ -20,6 +20,7 @@
 #include <list>
 #include <utility>
 #include <string>
+#include <string_view>
 #include <map>
 
 #define MAX_STRING_LENGTH 0x800000  // this is about 8 megs.
@@ -107,6 +108,7 @@ public:
 
     EXPORT virtual void Concatenate(const char* arg, ...) ATTR_PRINTF(2, 3);
     EXPORT virtual void Concatenate(const String& data);
+    EXPORT virtual void Concatenate(const std::string_view data);
     EXPORT virtual void ConvertToUpperCase();
     EXPORT virtual bool DecodeIfArmored(bool escapedIsAllowed = true);
     EXPORT virtual void Format(const char* fmt, ...) ATTR_PRINTF(2, 3);
@@ -116,6 +118,9 @@ public:
     EXPORT virtual bool MemSet(const char* mem, std::uint32_t size);
     EXPORT virtual void OTfgets(std::istream& ofs);
     EXPORT virtual void Release();
+    /** Allocates room for at least size characters so that subsequent calls
+     *  to Concatenate do not reallocate */
+    EXPORT virtual void Reserve(std::uint32_t size);
     /** new_string MUST be at least nEnforcedMaxLength in size if
     nEnforcedMaxLength is passed in at all.
     That's because this function forces the null terminator at that length,
@@ -139,6 +144,10 @@ protected:
     std::uint32_t length_{0};
     std::uint32_t position_{0};
     char* data_{nullptr};
+    /** Characters which fit in data_ before the terminator. While data_ is
+     *  null this is the size requested by Reserve, allocated on the first
+     *  append. */
+    std::uint32_t capacity_{0};
 
     virtual void Release_String();
 
@@ -146,6 +155,8 @@ private:
     friend OTString;
     friend std::ostream& operator<<(std::ostream& os, const String& obj);
 
+    /** Appends size characters, growing the buffer geometrically */
+    void append(const char* data, std::uint32_t size);
     String* clone() const;
     /** Only call this right after calling Initialize() or Release(). Also, this
      * function ASSUMES the new_string pointer is good. */
@@ -13,6 +13,9 @@
 #include "opentxs/core/util/Timer.hpp"
 #include "opentxs/core/Contract.hpp"
 
+#include <mutex>
+#include <string>
+
 namespace opentxs
 {
 namespace api
@@ -46,8 +49,15 @@ private:
 private:
     friend api::implementation::Factory;
 
-    // A list of all valid markets.
+    /** A cron item read from the cron file: date added, armored contract */
+    using PendingItem = std::pair<time64_t, OTString>;
+    /** A market read from the cron file: unit, currency, scale */
+    using PendingMarket = std::tuple<OTIdentifier, OTIdentifier, std::int64_t>;
+
+    // A list of all valid markets. Market data queries are answered without
+    // the notary's processing lock, so the map is guarded by its own mutex.
     mapOfMarkets m_mapMarkets;
+    mutable std::mutex m_lockMarkets;
     // Cron Items are found on both lists.
     mapOfCronItems m_mapCronItems;
     multimapOfCronItems m_multimapCronItems;
@@ -60,6 +70,11 @@ private:
     bool m_bIsActivated{false};
     // I'll need this for later.
     ConstNym m_pServerNym{nullptr};
+    // Filled by ProcessXMLNode while loading, consumed by load_pending()
+    std::vector<PendingItem> pending_items_;
+    std::vector<PendingMarket> pending_markets_;
+    // Name of the cron file in the cron folder
+    std::string cron_file_;
     // Number of transaction numbers Cron  will grab for itself, when it gets
     // low, before each round.
     static std::int32_t __trans_refill_amount;
@@ -71,6 +86,14 @@ private:
 
     static Timer tCron;
 
+    /** Copies the market map, so it can be iterated without holding the lock
+     */
+    mapOfMarkets get_markets() const;
+
+    /** Parses and verifies the items and markets collected by ProcessXMLNode
+     * on a thread pool, then adds them in file order. */
+    bool load_pending();
+
     explicit OTCron(const api::Core& server);
 
     OTCron() = delete;
@@ -131,7 +154,8 @@ public:
         const Identifier& CURRENCY_ID,
         const std::int64_t& lScale);
     /** This is informational only. It returns OTStorage-type data objects,
-     * packed in a string. */
+     * packed in a string. Built from the markets' published snapshots, so it
+     * may be called while cron is processing. */
     bool GetMarketList(Armored& ascOutput, std::int32_t& nMarketCount);
     bool GetNym_OfferList(
         Armored& ascOutput,
@@ -171,6 +195,13 @@ public:
     }
     inline ConstNym GetServerNym() const { return m_pServerNym; }
 
+    /** Saves and loads this instance under another name, so that a second
+     * cron does not overwrite the notary's cron file */
+    inline void SetCronFile(const std::string& filename)
+    {
+        cron_file_ = filename;
+    }
+
     bool LoadCron();
     bool SaveCron();
 
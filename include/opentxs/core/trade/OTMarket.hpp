@@ -22,7 +22,9 @@
 #include "opentxs/core/OTStorage.hpp"
 
 #include <cstdint>
+#include <deque>
 #include <map>
+#include <memory>
 #include <string>
 
 namespace opentxs
@@ -60,6 +62,10 @@ public:
         bool bSaveFile = true,
         time64_t tDateAddedToMarket = OT_TIME_ZERO);
     bool RemoveOffer(const std::int64_t& lTransactionNum);
+    /** Fills in this market's getMarketList entry from the most recently
+     *  published snapshot. Safe to call while the market is being modified.
+     *  Returns false if no snapshot has been published yet. */
+    bool GetMarketData(OTDB::MarketData& output) const;
     // returns general information about offers on the market
     EXPORT bool GetOfferList(
         Armored& ascOutput,
@@ -94,8 +100,8 @@ public:
     std::int64_t GetHighestBidPrice();
     std::int64_t GetLowestAskPrice();
 
-    mapOfOffers::size_type GetBidCount() { return m_mapBids.size(); }
-    mapOfOffers::size_type GetAskCount() { return m_mapAsks.size(); }
+    mapOfOffers::size_type GetBidCount() { return m_lBidCount; }
+    mapOfOffers::size_type GetAskCount() { return m_lAskCount; }
     void SetInstrumentDefinitionID(const Identifier& INSTRUMENT_DEFINITION_ID)
     {
         m_INSTRUMENT_DEFINITION_ID = INSTRUMENT_DEFINITION_ID;
@@ -141,7 +147,15 @@ public:
 
     inline void SetCronPointer(OTCron& theCron) { m_pCron = &theCron; }
     inline OTCron* GetCron() { return m_pCron; }
+    /** Equivalent to ReadMarket() followed by ParseMarket() */
     bool LoadMarket();
+    /** Parses and verifies the contents fetched by ReadMarket. Does not touch
+     *  storage, so several markets may be parsed at the same time. */
+    bool ParseMarket();
+    /** Fetches the market file and recent trades from storage without parsing
+     *  them. OTDB is not thread safe, so only call this from one thread at a
+     *  time. */
+    bool ReadMarket();
     bool SaveMarket();
 
     void InitMarket();
@@ -163,12 +177,34 @@ private:
 
     typedef Contract ot_super;
 
+    // All the offers at a single price, in the order they were added to the
+    // market (first in line at the front), along with the total amount they
+    // have available.
+    struct PriceLevel {
+        std::int64_t depth_{0};
+        std::deque<OTOffer*> offers_{};
+    };
+    // Price levels ordered by price limit. Market orders, having a price limit
+    // of zero, always occupy the lowest level.
+    typedef std::map<std::int64_t, PriceLevel> mapOfPriceLevels;
+    // Immutable copy of the public market data, published every time the
+    // market is saved. Replies to market data queries are built from it and
+    // cached per depth.
+    class Snapshot;
+
     OTCron* m_pCron{nullptr};  // The Cron object that owns this Market.
 
     OTDB::TradeListMarket* m_pTradeList{nullptr};
 
-    mapOfOffers m_mapBids;  // The buyers, ordered by price limit
-    mapOfOffers m_mapAsks;  // The sellers, ordered by price limit
+    mapOfPriceLevels m_mapBids;  // The buyers, ordered by price limit
+    mapOfPriceLevels m_mapAsks;  // The sellers, ordered by price limit
+    mapOfOffers::size_type m_lBidCount{0};
+    mapOfOffers::size_type m_lAskCount{0};
+
+    // Only accessed through std::atomic_load / std::atomic_store, so readers
+    // never observe a partially built snapshot.
+    std::shared_ptr<const Snapshot> m_pSnapshot;
+    std::uint64_t m_lSnapshotVersion{0};
 
     mapOfOffersTrnsNum m_mapOffers;  // All of the offers on a single list,
                                      // ordered by transaction number.
@@ -214,6 +250,13 @@ private:
         const Identifier& CURRENCY_TYPE_ID,
         const std::int64_t& lScale);
 
+    void adjust_depth(const OTOffer& theOffer, const std::int64_t lAmount);
+    bool match_offer(
+        const api::Wallet& wallet,
+        OTTrade& theTrade,
+        OTOffer& theOffer);
+    void publish_snapshot();
+    bool remove_from_level(OTOffer& theOffer);
     void rollback_four_accounts(
         Account& p1,
         bool b1,
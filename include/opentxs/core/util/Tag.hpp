@@ -58,8 +58,14 @@ public:
 
     Tag(const std::string& str_name, const char* sztext);
 
+    /** Appends the serialized tag, reserving room for all of it first */
     void output(std::string& str_output) const;
+    /** Appends the serialized tag to an opentxs::String with a single
+     *  amortized copy */
+    void output(String& output) const;
     void outputXML(std::string& str_output) const;
+    /** Exact number of characters outputXML will append */
+    std::size_t size_hint() const;
 };
 
 }  // namespace opentxs
@@ -24,6 +24,14 @@ std::string Print(const proto::HDPath& node);
 class Bip32
 {
 public:
+    /** Derive the node at the specified path and export its public key and
+     *  chain code for watch-only derivation of non-hardened children */
+    EXPORT virtual bool ExtendedPublicKey(
+        const EcdsaCurve& curve,
+        const OTPassword& seed,
+        proto::HDPath& path,
+        Data& publicKey,
+        Data& chainCode) const = 0;
     EXPORT virtual std::shared_ptr<proto::AsymmetricKey> GetChild(
         const proto::AsymmetricKey& parent,
         const std::uint32_t index) const = 0;
@@ -31,6 +39,14 @@ public:
         const EcdsaCurve& curve,
         const OTPassword& seed,
         proto::HDPath& path) const = 0;
+    /** Derive the public key of a non-hardened child from an extended public
+     *  key without access to any private key material */
+    EXPORT virtual bool PublicChild(
+        const EcdsaCurve& curve,
+        const Data& parentKey,
+        const Data& parentChainCode,
+        const std::uint32_t index,
+        Data& childKey) const = 0;
     EXPORT virtual std::string SeedToFingerprint(
         const EcdsaCurve& curve,
         const OTPassword& seed) const = 0;
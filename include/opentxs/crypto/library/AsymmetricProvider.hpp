@@ -11,6 +11,9 @@
 #include "opentxs/Proto.hpp"
 #include "opentxs/Types.hpp"
 
+#include <tuple>
+#include <vector>
+
 namespace opentxs
 {
 namespace crypto
@@ -18,6 +21,14 @@ namespace crypto
 class AsymmetricProvider
 {
 public:
+    /** plaintext, key, signature, hash type */
+    using BatchItem = std::tuple<
+        const Data&,
+        const key::Asymmetric&,
+        const Data&,
+        const proto::HashType>;
+    using SignatureBatch = std::vector<BatchItem>;
+
     EXPORT static proto::AsymmetricKeyType CurveToKeyType(
         const EcdsaCurve& curve);
     EXPORT static EcdsaCurve KeyTypeToCurve(
@@ -42,6 +53,14 @@ public:
         const Data& signature,
         const proto::HashType hashType,
         const OTPasswordData* pPWData = nullptr) const = 0;
+    /** Verifies a set of independent signatures, spreading the work across
+     *  the available cores
+     *
+     *  Returns true only if every signature in the batch verifies.
+     */
+    EXPORT virtual bool VerifyBatch(
+        const SignatureBatch& batch,
+        const OTPasswordData* pPWData = nullptr) const = 0;
     EXPORT virtual bool VerifyContractSignature(
         const String& strContractToVerify,
         const key::Asymmetric& theKey,
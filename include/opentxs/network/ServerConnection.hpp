@@ -20,12 +20,6 @@ namespace network
 class ServerConnection
 {
 public:
-    EXPORT static OTServerConnection Factory(
-        const api::Core& api,
-        const api::network::ZMQ& zmq,
-        const zeromq::PublishSocket& updates,
-        const std::shared_ptr<const ServerContract>& contract);
-
     EXPORT virtual bool ChangeAddressType(const proto::AddressType type) = 0;
     EXPORT virtual bool ClearProxy() = 0;
     EXPORT virtual bool EnableProxy() = 0;
@@ -160,6 +160,7 @@
 #include <opentxs/ui/ContactSection.hpp>
 #include <opentxs/ui/ContactSubsection.hpp>
 #include <opentxs/ui/IssuerItem.hpp>
+#include <opentxs/ui/List.hpp>
 #include <opentxs/ui/ListRow.hpp>
 #include <opentxs/ui/MessagableList.hpp>
 #include <opentxs/ui/PayableList.hpp>
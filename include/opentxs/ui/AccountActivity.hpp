@@ -8,7 +8,7 @@
 
 #include "opentxs/Forward.hpp"
 
-#include "opentxs/ui/Widget.hpp"
+#include "opentxs/ui/List.hpp"
 
 #ifdef SWIG
 // clang-format off
@@ -20,11 +20,14 @@ namespace opentxs
 {
 namespace ui
 {
-class AccountActivity : virtual public Widget
+class AccountActivity : virtual public List
 {
 public:
     EXPORT virtual Amount Balance() const = 0;
     EXPORT virtual std::string DisplayBalance() const = 0;
+    EXPORT virtual opentxs::SharedPimpl<opentxs::ui::BalanceItem> At(
+        const std::size_t index,
+        const std::uint64_t version) const = 0;
     EXPORT virtual opentxs::SharedPimpl<opentxs::ui::BalanceItem> First()
         const = 0;
     EXPORT virtual opentxs::SharedPimpl<opentxs::ui::BalanceItem> Next()
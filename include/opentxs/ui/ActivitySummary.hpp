@@ -8,7 +8,7 @@
 
 #include "opentxs/Forward.hpp"
 
-#include "opentxs/ui/Widget.hpp"
+#include "opentxs/ui/List.hpp"
 
 #ifdef SWIG
 // clang-format off
@@ -20,9 +20,12 @@ namespace opentxs
 {
 namespace ui
 {
-class ActivitySummary : virtual public Widget
+class ActivitySummary : virtual public List
 {
 public:
+    EXPORT virtual opentxs::SharedPimpl<opentxs::ui::ActivitySummaryItem> At(
+        const std::size_t index,
+        const std::uint64_t version) const = 0;
     EXPORT virtual opentxs::SharedPimpl<opentxs::ui::ActivitySummaryItem>
     First() const = 0;
     EXPORT virtual opentxs::SharedPimpl<opentxs::ui::ActivitySummaryItem> Next()
@@ -8,7 +8,7 @@
 
 #include "opentxs/Forward.hpp"
 
-#include "opentxs/ui/Widget.hpp"
+#include "opentxs/ui/List.hpp"
 #include "opentxs/Proto.hpp"
 
 #include <string>
@@ -31,15 +31,23 @@ namespace opentxs
 {
 namespace ui
 {
-class ActivityThread : virtual public Widget
+class ActivityThread : virtual public List
 {
 public:
     EXPORT virtual std::string DisplayName() const = 0;
+    EXPORT virtual opentxs::SharedPimpl<opentxs::ui::ActivityThreadItem> At(
+        const std::size_t index,
+        const std::uint64_t version) const = 0;
     EXPORT virtual opentxs::SharedPimpl<opentxs::ui::ActivityThreadItem> First()
         const = 0;
     EXPORT virtual opentxs::SharedPimpl<opentxs::ui::ActivityThreadItem> Next()
         const = 0;
     EXPORT virtual std::string GetDraft() const = 0;
+    /** Adds the next page of older items to the list
+     *
+     *  Returns false if there were no older items left to load
+     */
+    EXPORT virtual bool LoadMore() const = 0;
     EXPORT virtual std::string Participants() const = 0;
     EXPORT virtual std::string PaymentCode(
         const proto::ContactItemType currency) const = 0;
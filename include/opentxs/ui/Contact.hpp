@@ -8,7 +8,7 @@
 
 #include "opentxs/Forward.hpp"
 
-#include "opentxs/ui/Widget.hpp"
+#include "opentxs/ui/List.hpp"
 #include "opentxs/Proto.hpp"
 
 #include <string>
@@ -23,11 +23,14 @@ namespace opentxs
 {
 namespace ui
 {
-class Contact : virtual public Widget
+class Contact : virtual public List
 {
 public:
     EXPORT virtual std::string ContactID() const = 0;
     EXPORT virtual std::string DisplayName() const = 0;
+    EXPORT virtual opentxs::SharedPimpl<opentxs::ui::ContactSection> At(
+        const std::size_t index,
+        const std::uint64_t version) const = 0;
     EXPORT virtual opentxs::SharedPimpl<opentxs::ui::ContactSection> First()
         const = 0;
     EXPORT virtual opentxs::SharedPimpl<opentxs::ui::ContactSection> Next()
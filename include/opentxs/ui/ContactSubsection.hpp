@@ -8,6 +8,7 @@
 
 #include "opentxs/Forward.hpp"
 
+#include "opentxs/ui/List.hpp"
 #include "opentxs/ui/ListRow.hpp"
 #include "opentxs/Proto.hpp"
 
@@ -32,10 +33,13 @@ namespace opentxs
 {
 namespace ui
 {
-class ContactSubsection : virtual public ListRow
+class ContactSubsection : virtual public List, virtual public ListRow
 {
 public:
     EXPORT virtual std::string Name(const std::string& lang) const = 0;
+    EXPORT virtual opentxs::SharedPimpl<opentxs::ui::ContactItem> At(
+        const std::size_t index,
+        const std::uint64_t version) const = 0;
     EXPORT virtual opentxs::SharedPimpl<opentxs::ui::ContactItem> First()
         const = 0;
     EXPORT virtual opentxs::SharedPimpl<opentxs::ui::ContactItem> Next()
@@ -10,6 +10,7 @@
 
 #include <string>
 
+#include "List.hpp"
 #include "ListRow.hpp"
 
 #ifdef SWIG
@@ -23,11 +24,14 @@ namespace opentxs
 {
 namespace ui
 {
-class IssuerItem : virtual public ListRow
+class IssuerItem : virtual public List, virtual public ListRow
 {
 public:
     EXPORT virtual bool ConnectionState() const = 0;
     EXPORT virtual std::string Debug() const = 0;
+    EXPORT virtual opentxs::SharedPimpl<opentxs::ui::AccountSummaryItem> At(
+        const std::size_t index,
+        const std::uint64_t version) const = 0;
     EXPORT virtual opentxs::SharedPimpl<opentxs::ui::AccountSummaryItem> First()
         const = 0;
     EXPORT virtual std::string Name() const = 0;
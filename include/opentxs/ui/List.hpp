@@ -0,0 +1,75 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef OPENTXS_UI_LIST_HPP
+#define OPENTXS_UI_LIST_HPP
+
+#include "opentxs/Forward.hpp"
+
+#include "opentxs/ui/Widget.hpp"
+
+#include <cstdint>
+#include <set>
+
+#ifdef SWIG
+// clang-format off
+%ignore opentxs::ui::List::Changes;
+%ignore opentxs::ui::List::ChangeSet;
+%rename(UIList) opentxs::ui::List;
+// clang-format on
+#endif  // SWIG
+
+namespace opentxs
+{
+namespace ui
+{
+/** Random access to the rows of a list widget
+ *
+ *  Every insertion, removal or reordering of a row increments Version().
+ *  Rows are addressed by their position in the list at a particular version,
+ *  and are identified across versions by a handle which is unique for the
+ *  lifetime of the widget.
+ */
+class List : virtual public Widget
+{
+public:
+    struct ChangeSet {
+        std::uint64_t version_{0};
+        std::set<std::uint64_t> inserted_{};
+        std::set<std::uint64_t> removed_{};
+        std::set<std::uint64_t> moved_{};
+    };
+
+    /** Returns the handles of the rows which were inserted, removed or moved
+     *  after the specified version
+     *
+     *  Returns false if the changes are no longer available, in which case
+     *  the caller should reload its window of rows.
+     */
+    EXPORT virtual bool Changes(
+        const std::uint64_t since,
+        ChangeSet& changes) const = 0;
+    /** Returns the handle of the row at the specified position, or zero if
+     *  the list no longer matches the specified version */
+    EXPORT virtual std::uint64_t Handle(
+        const std::size_t index,
+        const std::uint64_t version) const = 0;
+    EXPORT virtual std::size_t Size() const = 0;
+    EXPORT virtual std::uint64_t Version() const = 0;
+
+    EXPORT virtual ~List() = default;
+
+protected:
+    List() = default;
+
+private:
+    List(const List&) = delete;
+    List(List&&) = delete;
+    List& operator=(const List&) = delete;
+    List& operator=(List&&) = delete;
+};
+}  // namespace ui
+}  // namespace opentxs
+#endif
@@ -8,7 +8,7 @@
 
 #include "opentxs/Forward.hpp"
 
-#include "opentxs/ui/Widget.hpp"
+#include "opentxs/ui/List.hpp"
 
 #ifdef SWIG
 // clang-format off
@@ -20,9 +20,12 @@ namespace opentxs
 {
 namespace ui
 {
-class MessagableList : virtual public Widget
+class MessagableList : virtual public List
 {
 public:
+    EXPORT virtual opentxs::SharedPimpl<opentxs::ui::ContactListItem> At(
+        const std::size_t index,
+        const std::uint64_t version) const = 0;
     EXPORT virtual opentxs::SharedPimpl<opentxs::ui::ContactListItem> First()
         const = 0;
     EXPORT virtual opentxs::SharedPimpl<opentxs::ui::ContactListItem> Next()
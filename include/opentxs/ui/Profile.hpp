@@ -8,7 +8,7 @@
 
 #include "opentxs/Forward.hpp"
 
-#include "opentxs/ui/Widget.hpp"
+#include "opentxs/ui/List.hpp"
 #include "opentxs/Proto.hpp"
 
 #include <string>
@@ -81,7 +81,7 @@ namespace opentxs
 {
 namespace ui
 {
-class Profile : virtual public Widget
+class Profile : virtual public List
 {
 public:
     using ItemType = std::pair<proto::ContactItemType, std::string>;
@@ -105,6 +105,9 @@ public:
         const int type,
         const std::string& claimID) const = 0;
     EXPORT virtual std::string DisplayName() const = 0;
+    EXPORT virtual opentxs::SharedPimpl<opentxs::ui::ProfileSection> At(
+        const std::size_t index,
+        const std::uint64_t version) const = 0;
     EXPORT virtual opentxs::SharedPimpl<opentxs::ui::ProfileSection> First()
         const = 0;
     EXPORT virtual std::string ID() const = 0;
@@ -8,6 +8,7 @@
 
 #include "opentxs/Forward.hpp"
 
+#include "opentxs/ui/List.hpp"
 #include "opentxs/ui/ListRow.hpp"
 #include "opentxs/Proto.hpp"
 
@@ -87,7 +88,7 @@ namespace opentxs
 {
 namespace ui
 {
-class ProfileSection : virtual public ListRow
+class ProfileSection : virtual public List, virtual public ListRow
 {
 public:
     using ItemType = std::pair<proto::ContactItemType, std::string>;
@@ -106,6 +107,9 @@ public:
         const = 0;
     EXPORT virtual ItemTypeList Items(const std::string& lang) const = 0;
     EXPORT virtual std::string Name(const std::string& lang) const = 0;
+    EXPORT virtual opentxs::SharedPimpl<opentxs::ui::ProfileSubsection> At(
+        const std::size_t index,
+        const std::uint64_t version) const = 0;
     EXPORT virtual opentxs::SharedPimpl<opentxs::ui::ProfileSubsection> First()
         const = 0;
     EXPORT virtual opentxs::SharedPimpl<opentxs::ui::ProfileSubsection> Next()
@@ -8,6 +8,7 @@
 
 #include "opentxs/Forward.hpp"
 
+#include "opentxs/ui/List.hpp"
 #include "opentxs/ui/ListRow.hpp"
 #include "opentxs/Proto.hpp"
 
@@ -32,7 +33,7 @@ namespace opentxs
 {
 namespace ui
 {
-class ProfileSubsection : virtual public ListRow
+class ProfileSubsection : virtual public List, virtual public ListRow
 {
 public:
     EXPORT virtual bool AddItem(
@@ -40,6 +41,9 @@ public:
         const bool primary,
         const bool active) const = 0;
     EXPORT virtual bool Delete(const std::string& claimID) const = 0;
+    EXPORT virtual opentxs::SharedPimpl<opentxs::ui::ProfileItem> At(
+        const std::size_t index,
+        const std::uint64_t version) const = 0;
     EXPORT virtual opentxs::SharedPimpl<opentxs::ui::ProfileItem> First()
         const = 0;
     EXPORT virtual std::string Name(const std::string& lang) const = 0;
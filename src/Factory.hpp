@@ -48,6 +48,7 @@ public:
         const Flag& running);
     static ui::ActivityThread* ActivityThread(
         const api::client::Manager& api,
+        const api::internal::Timer& timer,
         const network::zeromq::PublishSocket& publisher,
         const Identifier& nymID,
         const Identifier& threadID);
@@ -64,7 +65,8 @@ public:
 #if OT_CRYPTO_SUPPORTED_KEY_HD
     static api::client::Blockchain* Blockchain(
         const api::Core& api,
-        const api::client::Activity& activity);
+        const api::client::Activity& activity,
+        const api::internal::Timer& timer);
 #endif
     static api::client::Cash* Cash(
         const api::Core& api,
@@ -75,6 +77,7 @@ public:
         const api::Settings& config,
         const api::Crypto& crypto,
         const network::zeromq::Context& context,
+        const api::internal::Timer& timer,
         const std::string& dataFolder,
         const int instance);
     static ui::implementation::ContactListExternalInterface* ContactList(
@@ -114,7 +117,9 @@ public:
         const ui::implementation::ContactSectionRowID& rowID,
         const ui::implementation::ContactSectionSortKey& key,
         const ui::implementation::CustomData& custom);
-    static api::Crypto* Crypto(const api::Settings& settings);
+    static api::Crypto* Crypto(
+        const api::Settings& settings,
+        const api::internal::Timer& timer);
     static api::crypto::Config* CryptoConfig(const api::Settings& settings);
     static api::network::Dht* Dht(
         const bool defaultEnable,
@@ -149,7 +154,8 @@ public:
         const api::storage::Storage& storage,
         const crypto::Bip32& bip32,
         const crypto::Bip39& bip39,
-        const crypto::LegacySymmetricProvider& aes);
+        const crypto::LegacySymmetricProvider& aes,
+        const api::internal::Timer& timer);
 #endif
     static api::Identity* Identity(const api::Core& api);
     static api::client::Issuer* Issuer(
@@ -205,7 +211,8 @@ public:
     static crypto::OpenSSL* OpenSSL(const api::Crypto& crypto);
     static api::client::Pair* Pair(
         const Flag& running,
-        const api::client::Manager& client);
+        const api::client::Manager& client,
+        const api::internal::Timer& timer);
     static ui::implementation::PayableExternalInterface* PayableList(
         const api::client::Manager& api,
         const network::zeromq::PublishSocket& publisher,
@@ -268,12 +275,19 @@ public:
     static api::client::ServerAction* ServerAction(
         const api::client::Manager& api,
         const ContextLockCallback& lockCallback);
+    static network::ServerConnection* ServerConnection(
+        const api::Core& api,
+        const api::network::ZMQ& zmq,
+        const network::zeromq::PublishSocket& updates,
+        const std::shared_ptr<const ServerContract>& contract,
+        const api::internal::Timer& timer);
     static api::server::Manager* ServerManager(
         const Flag& running,
         const ArgList& args,
         const api::Crypto& crypto,
         const api::Settings& config,
         const network::zeromq::Context& context,
+        const api::internal::Timer& timer,
         const std::string& dataFolder,
         const int instance);
     static api::Settings* Settings();
@@ -334,10 +348,14 @@ public:
         const api::client::Manager& api,
         OTClient& otclient,
         const ContextLockCallback& lockCallback);
-    static crypto::Trezor* Trezor(const api::Crypto& crypto);
+    static api::internal::Timer* Timer();
+    static crypto::Trezor* Trezor(
+        const api::Crypto& crypto,
+        const api::internal::Timer& timer);
     static api::client::UI* UI(
         const api::client::Manager& api,
-        const Flag& running);
+        const Flag& running,
+        const api::internal::Timer& timer);
     static api::Wallet* Wallet(const api::client::Manager& client);
     static api::Wallet* Wallet(const api::server::Manager& server);
     static api::client::Workflow* Workflow(
@@ -345,6 +363,9 @@ public:
         const api::client::Activity& activity,
         const api::client::Contacts& contact);
     static api::network::ZAP* ZAP(const network::zeromq::Context& context);
-    static api::network::ZMQ* ZMQ(const api::Core& api, const Flag& running);
+    static api::network::ZMQ* ZMQ(
+        const api::Core& api,
+        const Flag& running,
+        const api::internal::Timer& timer);
 };
 }  // namespace opentxs
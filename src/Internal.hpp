@@ -44,6 +44,7 @@ namespace internal
 {
 struct Log;
 struct Native;
+struct Timer;
 }  // namespace internal
 
 namespace server
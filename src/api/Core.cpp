@@ -29,11 +29,12 @@ Core::Core(
     const api::Crypto& crypto,
     const api::Settings& config,
     const opentxs::network::zeromq::Context& zmq,
+    const api::internal::Timer& timer,
     const std::string& dataFolder,
     const int instance,
     const bool dhtDefault)
     : StorageParent(running, args, crypto, config, dataFolder)
-    , Scheduler(running)
+    , Scheduler(running, timer)
     , zmq_context_(zmq)
     , instance_(instance)
     , endpoints_(opentxs::Factory::Endpoints(zmq_context_, instance_))
@@ -43,7 +44,8 @@ Core::Core(
           *storage_,
           crypto_.BIP32(),
           crypto_.BIP39(),
-          crypto_.AES()))
+          crypto_.AES(),
+          timer))
 #endif
     , factory_(opentxs::Factory::FactoryAPI(*this))
     , wallet_(nullptr)
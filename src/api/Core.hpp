@@ -61,6 +61,7 @@ protected:
         const api::Crypto& crypto,
         const api::Settings& config,
         const opentxs::network::zeromq::Context& zmq,
+        const api::internal::Timer& timer,
         const std::string& dataFolder,
         const int instance,
         const bool dhtDefault);
@@ -21,10 +21,17 @@
 #include "opentxs/crypto/Bip32.hpp"
 #include "opentxs/crypto/Bip39.hpp"
 
+#include "core/ExpiringCache.hpp"
+#include "internal/api/Internal.hpp"
+
+#include <chrono>
 #include <iomanip>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <tuple>
 
 #include "HDSeed.hpp"
 
@@ -37,10 +44,11 @@ api::HDSeed* Factory::HDSeed(
     const api::storage::Storage& storage,
     const crypto::Bip32& bip32,
     const crypto::Bip39& bip39,
-    const crypto::LegacySymmetricProvider& aes)
+    const crypto::LegacySymmetricProvider& aes,
+    const api::internal::Timer& timer)
 {
     return new api::implementation::HDSeed(
-        symmetric, storage, bip32, bip39, aes);
+        symmetric, storage, bip32, bip39, aes, timer);
 }
 }  // namespace opentxs
 
@@ -49,21 +57,33 @@ namespace opentxs::api::implementation
 const proto::SymmetricMode HDSeed::DEFAULT_ENCRYPTION_MODE =
     proto::SMODE_CHACHA20POLY1305;
 const std::string HDSeed::DEFAULT_PASSPHRASE = "";
+const std::chrono::seconds HDSeed::SEED_CACHE_TIMEOUT{300};
+const std::chrono::seconds HDSeed::SEED_CACHE_PURGE_INTERVAL{30};
+const std::size_t HDSeed::SEED_CACHE_LIMIT{64};
 
 HDSeed::HDSeed(
     const api::crypto::Symmetric& symmetric,
     const api::storage::Storage& storage,
     const opentxs::crypto::Bip32& bip32,
     const opentxs::crypto::Bip39& bip39,
-    const opentxs::crypto::LegacySymmetricProvider& aes)
+    const opentxs::crypto::LegacySymmetricProvider& aes,
+    const api::internal::Timer& timer)
     : symmetric_(symmetric)
     , storage_(storage)
     , bip32_(bip32)
     , bip39_(bip39)
     , aes_(aes)
+    , timer_(timer)
+    , seeds_(SEED_CACHE_LIMIT, SEED_CACHE_TIMEOUT)
+    , purge_seeds_(timer_.Schedule(
+          SEED_CACHE_PURGE_INTERVAL,
+          SEED_CACHE_PURGE_INTERVAL,
+          [this]() -> void { seeds_.Purge(); }))
 {
 }
 
+HDSeed::~HDSeed() { timer_.Cancel(purge_seeds_); }
+
 std::shared_ptr<proto::AsymmetricKey> HDSeed::AccountChildKey(
     const proto::HDPath& rootPath,
     const BIP44Chain internal,
@@ -85,6 +105,27 @@ std::shared_ptr<proto::AsymmetricKey> HDSeed::AccountChildKey(
     return bip32_.GetHDKey(EcdsaCurve::SECP256K1, *seed, path);
 }
 
+bool HDSeed::AccountChainPublicKey(
+    const proto::HDPath& rootPath,
+    const BIP44Chain internal,
+    Data& publicKey,
+    Data& chainCode) const
+{
+    auto path = rootPath;
+    auto fingerprint = rootPath.root();
+    std::uint32_t notUsed = 0;
+    auto seed = Seed(fingerprint, notUsed);
+    path.set_root(fingerprint);
+
+    if (false == bool(seed)) { return false; }
+
+    const std::uint32_t change = internal ? 1 : 0;
+    path.add_child(change);
+
+    return bip32_.ExtendedPublicKey(
+        EcdsaCurve::SECP256K1, *seed, path, publicKey, chainCode);
+}
+
 std::string HDSeed::Bip32Root(const std::string& fingerprint) const
 {
     // TODO: make fingerprint non-const
@@ -147,6 +188,27 @@ bool HDSeed::DecryptSeed(
     return true;
 }
 
+void HDSeed::cache_seed(
+    const std::string& fingerprint,
+    const std::uint32_t index,
+    const std::shared_ptr<OTPassword>& seed) const
+{
+    seeds_.Insert(fingerprint, CachedSeed{index, seed});
+}
+
+std::shared_ptr<OTPassword> HDSeed::cached_seed(
+    const std::string& fingerprint,
+    std::uint32_t& index) const
+{
+    CachedSeed cached{};
+
+    if (false == seeds_.Find(fingerprint, cached)) { return {}; }
+
+    index = cached.first;
+
+    return cached.second;
+}
+
 std::string HDSeed::DefaultSeed() const { return storage_.DefaultSeed(); }
 
 std::shared_ptr<proto::AsymmetricKey> HDSeed::GetPaymentCode(
@@ -320,6 +382,14 @@ std::shared_ptr<OTPassword> HDSeed::Seed(
     std::string& fingerprint,
     std::uint32_t& index) const
 {
+    if (fingerprint.empty()) { fingerprint = storage_.DefaultSeed(); }
+
+    if (false == fingerprint.empty()) {
+        auto cached = cached_seed(fingerprint, index);
+
+        if (cached) { return cached; }
+    }
+
     auto output = aes_.InstantiateBinarySecretSP();
 
     OT_ASSERT(output);
@@ -339,6 +409,7 @@ std::shared_ptr<OTPassword> HDSeed::Seed(
 
         if (extracted) {
             output.reset(seed.release());
+            cache_seed(fingerprint, index, output);
         } else {
             OT_FAIL;
         }
@@ -394,7 +465,13 @@ bool HDSeed::UpdateIndex(std::string& seed, const std::uint32_t index) const
 
     if (serialized->version() < 2) { serialized->set_version(2); }
 
-    return storage_.Store(*serialized, seed);
+    if (false == storage_.Store(*serialized, seed)) { return false; }
+
+    seeds_.Modify(seed, [&](CachedSeed& cached) -> void {
+        cached.first = index;
+    });
+
+    return true;
 }
 
 std::string HDSeed::Words(const std::string& fingerprint) const
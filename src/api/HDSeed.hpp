@@ -14,6 +14,11 @@ public:
         const proto::HDPath& path,
         const BIP44Chain internal,
         const std::uint32_t index) const override;
+    bool AccountChainPublicKey(
+        const proto::HDPath& path,
+        const BIP44Chain internal,
+        Data& publicKey,
+        Data& chainCode) const override;
     std::string Bip32Root(const std::string& fingerprint = "") const override;
     std::string DefaultSeed() const override;
     std::shared_ptr<proto::AsymmetricKey> GetPaymentCode(
@@ -33,19 +38,36 @@ public:
         const override;
     std::string Words(const std::string& fingerprint = "") const override;
 
-    virtual ~HDSeed() = default;
+    virtual ~HDSeed();
 
 private:
     friend opentxs::Factory;
 
+    /** index, decrypted seed */
+    using CachedSeed = std::pair<std::uint32_t, std::shared_ptr<OTPassword>>;
+
     static const std::string DEFAULT_PASSPHRASE;
     static const proto::SymmetricMode DEFAULT_ENCRYPTION_MODE;
+    static const std::chrono::seconds SEED_CACHE_TIMEOUT;
+    static const std::chrono::seconds SEED_CACHE_PURGE_INTERVAL;
+    static const std::size_t SEED_CACHE_LIMIT;
 
     const api::crypto::Symmetric& symmetric_;
     const api::storage::Storage& storage_;
     const opentxs::crypto::Bip32& bip32_;
     const opentxs::crypto::Bip39& bip39_;
     const opentxs::crypto::LegacySymmetricProvider& aes_;
+    const api::internal::Timer& timer_;
+    mutable ExpiringCache<std::string, CachedSeed> seeds_;
+    api::internal::Timer::TimerID purge_seeds_;
+
+    std::shared_ptr<OTPassword> cached_seed(
+        const std::string& fingerprint,
+        std::uint32_t& index) const;
+    void cache_seed(
+        const std::string& fingerprint,
+        const std::uint32_t index,
+        const std::shared_ptr<OTPassword>& seed) const;
 
     bool DecryptSeed(
         const proto::Seed& seed,
@@ -66,7 +88,8 @@ private:
         const api::storage::Storage& storage,
         const opentxs::crypto::Bip32& bip32,
         const opentxs::crypto::Bip39& bip39,
-        const opentxs::crypto::LegacySymmetricProvider& aes);
+        const opentxs::crypto::LegacySymmetricProvider& aes,
+        const api::internal::Timer& timer);
     HDSeed() = delete;
     HDSeed(const HDSeed&) = delete;
     HDSeed(HDSeed&&) = delete;
@@ -337,6 +337,7 @@ Native::Native(
     , signal_handler_lock_()
     , config_()
     , zmq_context_(opentxs::network::zeromq::Context::Factory())
+    , timer_(opentxs::Factory::Timer())
     , signal_handler_(nullptr)
     , log_(opentxs::Factory::Log(zmq_context_))
     , crypto_(nullptr)
@@ -354,6 +355,7 @@ Native::Native(
     // NOTE: OT_ASSERT is not available until Init() has been called
     assert(legacy_);
     assert(log_);
+    assert(timer_);
     assert(zap_);
 
     if (nullptr == external_password_callback_) {
@@ -459,8 +461,10 @@ void Native::Init()
 
 void Native::Init_Crypto()
 {
-    crypto_.reset(
-        opentxs::Factory::Crypto(Config(legacy_->CryptoConfigFilePath())));
+    OT_ASSERT(timer_)
+
+    crypto_.reset(opentxs::Factory::Crypto(
+        Config(legacy_->CryptoConfigFilePath()), *timer_));
 }
 
 void Native::Init_Log()
@@ -558,6 +562,7 @@ void Native::start_client(const Lock& lock, const ArgList& args) const
         Config(legacy_->ClientConfigFilePath(next)),
         *crypto_,
         zmq_context_,
+        *timer_,
         legacy_->ClientDataFolder(next),
         instance));
 }
@@ -596,6 +601,7 @@ void Native::start_server(const Lock& lock, const ArgList& args) const
         *crypto_,
         Config(legacy_->ServerConfigFilePath(next)),
         zmq_context_,
+        *timer_,
         legacy_->ServerDataFolder(next),
         instance));
 }
@@ -629,6 +635,13 @@ const api::server::Manager& Native::StartServer(
     return *output;
 }
 
+const api::internal::Timer& Native::Timer() const
+{
+    OT_ASSERT(timer_)
+
+    return *timer_;
+}
+
 const api::network::ZAP& Native::ZAP() const
 {
     OT_ASSERT(zap_);
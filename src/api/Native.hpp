@@ -44,6 +44,7 @@ public:
 
     INTERNAL_PASSWORD_CALLBACK* GetInternalPasswordCallback() const override;
     OTCaller& GetPasswordCaller() const override;
+    const api::internal::Timer& Timer() const override;
 
 private:
     friend opentxs::Factory;
@@ -60,6 +61,7 @@ private:
     mutable std::mutex signal_handler_lock_;
     mutable ConfigMap config_;
     OTZMQContext zmq_context_;
+    std::unique_ptr<api::internal::Timer> timer_;
     mutable std::unique_ptr<Signals> signal_handler_;
     std::unique_ptr<api::internal::Log> log_;
     std::unique_ptr<api::Crypto> crypto_;
@@ -10,17 +10,27 @@
 #include "opentxs/core/Flag.hpp"
 #include "opentxs/core/Nym.hpp"
 
+#include "internal/api/Internal.hpp"
+
+#include <algorithm>
+#include <chrono>
 #include <ctime>
 #include <functional>
 #include <limits>
 
 #include "Scheduler.hpp"
 
+#define OT_DHT_SLICE_SIZE 32
+#define OT_DHT_SLICE_INTERVAL_MILLISECONDS 1000
+#define OT_STORAGE_GC_CHECK_MILLISECONDS 1000
+// Intervals longer than this are treated as never
+#define OT_SCHEDULER_MAXIMUM_INTERVAL_HOURS (24 * 365 * 100)
+
 //#define OT_METHOD "opentxs::api::implementation::Scheduler::"
 
 namespace opentxs::api::implementation
 {
-Scheduler::Scheduler(const Flag& running)
+Scheduler::Scheduler(const Flag& running, const api::internal::Timer& timer)
     : Lockable()
     , nym_publish_interval_{std::numeric_limits<std::int64_t>::max()}
     , nym_refresh_interval_{std::numeric_limits<std::int64_t>::max()}
@@ -29,19 +39,47 @@ Scheduler::Scheduler(const Flag& running)
     , unit_publish_interval_{std::numeric_limits<std::int64_t>::max()}
     , unit_refresh_interval_{std::numeric_limits<std::int64_t>::max()}
     , running_{running}
-    , periodic_task_list_{}
-    , periodic_{nullptr}
+    , timer_(timer)
+    , timers_{}
+    , walk_list_{}
 {
 }
 
+void Scheduler::add_timer(
+    const std::chrono::milliseconds delay,
+    const std::chrono::milliseconds interval,
+    const PeriodicTask& task) const
+{
+    // Garbage collection, DHT walks and the periodic tasks of clients may
+    // all take a long time
+    const auto id = timer_.ScheduleLong(delay, interval, [=]() -> void {
+        if (running_) { task(); }
+    });
+    Lock lock(lock_);
+    timers_.push_back(id);
+}
+
 void Scheduler::Schedule(
     const std::chrono::seconds& interval,
     const PeriodicTask& task,
     const std::chrono::seconds& last) const
 {
-    Lock lock(lock_);
-    periodic_task_list_.push_back(
-        TaskItem{last.count(), interval.count(), task});
+    const auto limit = std::chrono::hours(OT_SCHEDULER_MAXIMUM_INTERVAL_HOURS);
+
+    if (interval > limit) { return; }
+
+    const auto now = std::chrono::seconds(std::time(nullptr));
+    const auto delay = std::max(last + interval - now, std::chrono::seconds(0));
+    add_timer(delay, interval, task);
+}
+
+void Scheduler::schedule_walk(
+    const std::chrono::seconds& interval,
+    const SliceTask& task,
+    const std::chrono::seconds& last)
+{
+    walk_list_.push_back(
+        WalkItem{last.count(), interval.count(), "", false, task});
 }
 
 void Scheduler::Start(
@@ -53,101 +91,114 @@ void Scheduler::Start(
 
     const auto now = std::chrono::seconds(std::time(nullptr));
 
-    Schedule(
+    schedule_walk(
         std::chrono::seconds(nym_publish_interval_),
-        [=]() -> void {
+        [=](const std::string& after, const std::size_t limit) -> std::string {
             NymLambda nymLambda(
                 [=](const serializedCredentialIndex& nym) -> void {
                     dht->Insert(nym);
                 });
-            storage->MapPublicNyms(nymLambda);
+
+            return storage->MapPublicNyms(nymLambda, after, limit);
         },
         now);
 
-    Schedule(
+    schedule_walk(
         std::chrono::seconds(nym_refresh_interval_),
-        [=]() -> void {
+        [=](const std::string& after, const std::size_t limit) -> std::string {
             NymLambda nymLambda(
                 [=](const serializedCredentialIndex& nym) -> void {
                     dht->GetPublicNym(nym.nymid());
                 });
-            storage->MapPublicNyms(nymLambda);
+
+            return storage->MapPublicNyms(nymLambda, after, limit);
         },
         (now - std::chrono::seconds(nym_refresh_interval_) / 2));
 
-    Schedule(
+    schedule_walk(
         std::chrono::seconds(server_publish_interval_),
-        [=]() -> void {
+        [=](const std::string& after, const std::size_t limit) -> std::string {
             ServerLambda serverLambda(
                 [=](const proto::ServerContract& server) -> void {
                     dht->Insert(server);
                 });
-            storage->MapServers(serverLambda);
+
+            return storage->MapServers(serverLambda, after, limit);
         },
         now);
 
-    Schedule(
+    schedule_walk(
         std::chrono::seconds(server_refresh_interval_),
-        [=]() -> void {
+        [=](const std::string& after, const std::size_t limit) -> std::string {
             ServerLambda serverLambda(
                 [=](const proto::ServerContract& server) -> void {
                     dht->GetServerContract(server.id());
                 });
-            storage->MapServers(serverLambda);
+
+            return storage->MapServers(serverLambda, after, limit);
         },
         (now - std::chrono::seconds(server_refresh_interval_) / 2));
 
-    Schedule(
+    schedule_walk(
         std::chrono::seconds(unit_publish_interval_),
-        [=]() -> void {
+        [=](const std::string& after, const std::size_t limit) -> std::string {
             UnitLambda unitLambda(
                 [=](const proto::UnitDefinition& unit) -> void {
                     dht->Insert(unit);
                 });
-            storage->MapUnitDefinitions(unitLambda);
+
+            return storage->MapUnitDefinitions(unitLambda, after, limit);
         },
         now);
 
-    Schedule(
+    schedule_walk(
         std::chrono::seconds(unit_refresh_interval_),
-        [=]() -> void {
+        [=](const std::string& after, const std::size_t limit) -> std::string {
             UnitLambda unitLambda(
                 [=](const proto::UnitDefinition& unit) -> void {
                     dht->GetUnitDefinition(unit.id());
                 });
-            storage->MapUnitDefinitions(unitLambda);
+
+            return storage->MapUnitDefinitions(unitLambda, after, limit);
         },
         (now - std::chrono::seconds(unit_refresh_interval_) / 2));
 
-    periodic_.reset(new std::thread(&Scheduler::thread, this));
+    add_timer(
+        std::chrono::milliseconds(0),
+        std::chrono::milliseconds(OT_DHT_SLICE_INTERVAL_MILLISECONDS),
+        [=]() -> void { this->walk(std::time(nullptr)); });
+    // Storage has its own interval checking.
+    add_timer(
+        std::chrono::milliseconds(0),
+        std::chrono::milliseconds(OT_STORAGE_GC_CHECK_MILLISECONDS),
+        [=]() -> void { this->storage_gc_hook(); });
 }
 
-void Scheduler::thread()
+// Advances every active walk by one slice per slice interval, so that a walk
+// over a large storage tree is spread out over time instead of loading every
+// object at once
+void Scheduler::walk(const std::time_t now)
 {
-    while (running_) {
-        std::time_t now = std::time(nullptr);
-
-        Lock lock(lock_);
-
-        for (auto& [last, interval, task] : periodic_task_list_) {
-            if ((now - last) > interval) {
-                last = now;
-                std::thread taskThread{task};
-                taskThread.detach();
-            }
+    for (auto& [last, interval, cursor, active, task] : walk_list_) {
+        if ((false == active) && ((now - last) > interval)) {
+            last = now;
+            cursor.clear();
+            active = true;
         }
 
-        lock.unlock();
+        if (false == active) { continue; }
 
-        // Storage has its own interval checking.
-        storage_gc_hook();
-
-        Log::Sleep(std::chrono::milliseconds(100));
+        cursor = task(cursor, OT_DHT_SLICE_SIZE);
+        active = (false == cursor.empty());
     }
 }
 
 Scheduler::~Scheduler()
 {
-    if (periodic_) { periodic_->join(); }
+    Lock lock(lock_);
+    const auto timers = timers_;
+    lock.unlock();
+
+    for (const auto& id : timers) { timer_.Cancel(id); }
 }
 }  // namespace opentxs::api::implementation
@@ -10,11 +10,14 @@
 #include "opentxs/core/util/Common.hpp"
 #include "opentxs/core/Lockable.hpp"
 
+#include <chrono>
 #include <cstdint>
+#include <ctime>
+#include <functional>
 #include <list>
-#include <memory>
+#include <string>
 #include <tuple>
-#include <thread>
+#include <vector>
 
 namespace opentxs::api::implementation
 {
@@ -41,15 +44,21 @@ protected:
         const api::storage::Storage* const storage,
         const api::network::Dht* const dht);
 
-    Scheduler(const Flag& running);
+    Scheduler(const Flag& running, const api::internal::Timer& timer);
 
 private:
-    /** Last performed, Interval, Task */
-    using TaskItem = std::tuple<time64_t, time64_t, PeriodicTask>;
-    using TaskList = std::list<TaskItem>;
+    /** Visits at most limit objects after the specified id and returns the id
+     *  of the last object visited */
+    using SliceTask = std::function<
+        std::string(const std::string& after, const std::size_t limit)>;
+    /** Last started, Interval, Cursor, Active, Task */
+    using WalkItem =
+        std::tuple<time64_t, time64_t, std::string, bool, SliceTask>;
+    using WalkList = std::list<WalkItem>;
 
-    mutable TaskList periodic_task_list_;
-    std::unique_ptr<std::thread> periodic_;
+    const api::internal::Timer& timer_;
+    mutable std::vector<std::uint64_t> timers_;
+    WalkList walk_list_;
 
     virtual void storage_gc_hook() = 0;
 
@@ -59,6 +68,14 @@ private:
     Scheduler& operator=(const Scheduler&) = delete;
     Scheduler& operator=(Scheduler&&) = delete;
 
-    void thread();
+    void add_timer(
+        const std::chrono::milliseconds delay,
+        const std::chrono::milliseconds interval,
+        const PeriodicTask& task) const;
+    void schedule_walk(
+        const std::chrono::seconds& interval,
+        const SliceTask& task,
+        const std::chrono::seconds& last);
+    void walk(const std::time_t now);
 };
 }  // namespace opentxs::api::implementation
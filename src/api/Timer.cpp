@@ -0,0 +1,347 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "stdafx.hpp"
+
+#include "internal/api/Internal.hpp"
+
+#include <algorithm>
+
+#include "Timer.hpp"
+
+#define OT_TIMER_TICK_MILLISECONDS 10
+#define OT_TIMER_MINIMUM_WORKERS 2
+#define OT_TIMER_LONG_WORKERS 2
+// Bits of the tick count covered by the innermost wheel and by each of the
+// outer levels
+#define OT_TIMER_WHEEL_BITS 8
+#define OT_TIMER_LEVEL_BITS 6
+
+//#define OT_METHOD "opentxs::api::implementation::Timer::"
+
+namespace opentxs
+{
+api::internal::Timer* Factory::Timer()
+{
+    return new api::implementation::Timer();
+}
+}  // namespace opentxs
+
+namespace opentxs::api::implementation
+{
+thread_local Timer::TimerID Timer::running_task_{0};
+
+Timer::Timer()
+    : start_(Clock::now())
+    , lock_()
+    , driver_()
+    , workers_()
+    , finished_()
+    , running_(true)
+    , next_id_(0)
+    , current_tick_(0)
+    , entries_()
+    , wheel_()
+    , levels_()
+    , ready_()
+    , driver_thread_()
+    , worker_threads_()
+{
+    const auto workers = std::max<unsigned int>(
+        OT_TIMER_MINIMUM_WORKERS, std::thread::hardware_concurrency());
+
+    for (unsigned int i = 0; i < workers; ++i) {
+        worker_threads_.emplace_back(&Timer::work, this, false);
+    }
+
+    for (unsigned int i = 0; i < OT_TIMER_LONG_WORKERS; ++i) {
+        worker_threads_.emplace_back(&Timer::work, this, true);
+    }
+
+    driver_thread_ = std::thread(&Timer::drive, this);
+}
+
+// Moves the timer one tick forward, cascading entries from the outer levels
+// whenever the inner wheel wraps around, and queues every entry which is due
+void Timer::advance(const Lock& lock) const
+{
+    const auto tick = ++current_tick_;
+    const Tick wheelMask = (1 << OT_TIMER_WHEEL_BITS) - 1;
+    const Tick levelMask = (1 << OT_TIMER_LEVEL_BITS) - 1;
+
+    if (0 == (tick & wheelMask)) {
+        std::size_t level{0};
+        auto position = tick >> OT_TIMER_WHEEL_BITS;
+
+        while ((level + 1 < levels_.size()) && (0 == (position & levelMask))) {
+            position >>= OT_TIMER_LEVEL_BITS;
+            ++level;
+        }
+
+        // Outer levels first, so that their entries can continue to cascade
+        // into the slots which are emptied below
+        for (auto i = level + 1; i > 0; --i) { cascade(lock, i - 1); }
+    }
+
+    Slot due{};
+    due.swap(wheel_[tick & wheelMask]);
+
+    for (auto& [entry, generation] : due) {
+        if (entry->cancelled_ || (generation != entry->generation_)) {
+            continue;
+        }
+
+        if (entry->deadline_ > tick) {
+            insert(lock, entry);
+        } else {
+            queue(lock, {entry, generation});
+        }
+    }
+}
+
+void Timer::Cancel(const TimerID id) const
+{
+    Lock lock(lock_);
+    auto it = entries_.find(id);
+
+    if (entries_.end() == it) { return; }
+
+    auto entry = it->second;
+    entries_.erase(it);
+    entry->cancelled_ = true;
+
+    if (running_task_ == id) { return; }
+
+    finished_.wait(lock, [&]() -> bool { return false == entry->running_; });
+}
+
+void Timer::cascade(const Lock& lock, const std::size_t level) const
+{
+    const auto shift = OT_TIMER_WHEEL_BITS + (level * OT_TIMER_LEVEL_BITS);
+    const Tick levelMask = (1 << OT_TIMER_LEVEL_BITS) - 1;
+    Slot slot{};
+    slot.swap(levels_.at(level)[(current_tick_ >> shift) & levelMask]);
+
+    for (auto& [entry, generation] : slot) {
+        if (entry->cancelled_ || (generation != entry->generation_)) {
+            continue;
+        }
+
+        if (entry->deadline_ <= current_tick_) {
+            queue(lock, {entry, generation});
+        } else {
+            insert(lock, entry);
+        }
+    }
+}
+
+void Timer::drive() const
+{
+    Lock lock(lock_);
+
+    while (running_.load()) {
+        const auto now = elapsed();
+
+        while (current_tick_ < now) { advance(lock); }
+
+        for (std::size_t i = 0; i < ready_.size(); ++i) {
+            if (false == ready_[i].empty()) { workers_[i].notify_all(); }
+        }
+
+        if (entries_.empty()) {
+            driver_.wait(lock);
+
+            continue;
+        }
+
+        const auto wakeup = std::chrono::milliseconds(
+            next_wakeup(lock) * OT_TIMER_TICK_MILLISECONDS);
+        driver_.wait_until(lock, start_ + wakeup);
+    }
+}
+
+Timer::Tick Timer::elapsed() const
+{
+    const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+        Clock::now() - start_);
+
+    return duration.count() / OT_TIMER_TICK_MILLISECONDS;
+}
+
+void Timer::insert(const Lock& lock, std::shared_ptr<Entry>& entry) const
+{
+    const Tick wheelSize = 1 << OT_TIMER_WHEEL_BITS;
+    const Tick levelMask = (1 << OT_TIMER_LEVEL_BITS) - 1;
+    const auto generation = ++entry->generation_;
+    // Entries beyond the range of the outermost level are parked in its last
+    // slot and inserted again when that slot cascades
+    const Tick range = wheelSize << (OT_TIMER_LEVEL_BITS * levels_.size());
+    const auto deadline = std::min(
+        std::max(entry->deadline_, current_tick_ + 1),
+        current_tick_ + range - 1);
+    const auto distance = deadline - current_tick_;
+
+    if (distance < wheelSize) {
+        wheel_[deadline & (wheelSize - 1)].emplace_back(entry, generation);
+
+        return;
+    }
+
+    for (std::size_t level = 0; level < levels_.size(); ++level) {
+        const auto shift = OT_TIMER_WHEEL_BITS + (level * OT_TIMER_LEVEL_BITS);
+
+        if (distance < (wheelSize << (OT_TIMER_LEVEL_BITS * (level + 1)))) {
+            levels_[level][(deadline >> shift) & levelMask].emplace_back(
+                entry, generation);
+
+            return;
+        }
+    }
+}
+
+// Returns the next tick with a non-empty inner wheel slot, or the tick at
+// which the inner wheel wraps around and the outer levels must cascade
+Timer::Tick Timer::next_wakeup(const Lock& lock) const
+{
+    const Tick wheelMask = (1 << OT_TIMER_WHEEL_BITS) - 1;
+    const auto boundary = (current_tick_ | wheelMask) + 1;
+
+    for (auto tick = current_tick_ + 1; tick < boundary; ++tick) {
+        if (false == wheel_[tick & wheelMask].empty()) { return tick; }
+    }
+
+    return boundary;
+}
+
+void Timer::queue(const Lock& lock, const Item& item) const
+{
+    ready_[item.first->long_ ? 1 : 0].emplace_back(item);
+}
+
+bool Timer::Reschedule(const TimerID id, const std::chrono::milliseconds delay)
+    const
+{
+    Lock lock(lock_);
+    auto it = entries_.find(id);
+
+    if (entries_.end() == it) { return false; }
+
+    auto& entry = it->second;
+    entry->deadline_ = elapsed() + ticks(delay);
+
+    if (entry->running_) {
+        entry->rescheduled_ = true;
+    } else {
+        insert(lock, entry);
+        driver_.notify_one();
+    }
+
+    return true;
+}
+
+Timer::TimerID Timer::Schedule(
+    const std::chrono::milliseconds delay,
+    const std::chrono::milliseconds interval,
+    const Task& task) const
+{
+    return schedule(delay, interval, task, false);
+}
+
+Timer::TimerID Timer::schedule(
+    const std::chrono::milliseconds delay,
+    const std::chrono::milliseconds interval,
+    const Task& task,
+    const bool isLong) const
+{
+    Lock lock(lock_);
+    const auto id = ++next_id_;
+    auto entry = std::make_shared<Entry>(id, task, ticks(interval), isLong);
+    entry->deadline_ = elapsed() + ticks(delay);
+    entries_.emplace(id, entry);
+    insert(lock, entry);
+    driver_.notify_one();
+
+    return id;
+}
+
+Timer::TimerID Timer::ScheduleLong(
+    const std::chrono::milliseconds delay,
+    const std::chrono::milliseconds interval,
+    const Task& task) const
+{
+    return schedule(delay, interval, task, true);
+}
+
+Timer::Tick Timer::ticks(const std::chrono::milliseconds duration)
+{
+    if (0 >= duration.count()) { return 0; }
+
+    return (duration.count() + OT_TIMER_TICK_MILLISECONDS - 1) /
+           OT_TIMER_TICK_MILLISECONDS;
+}
+
+void Timer::work(const bool isLong) const
+{
+    auto& ready = ready_[isLong ? 1 : 0];
+    auto& workers = workers_[isLong ? 1 : 0];
+    Lock lock(lock_);
+
+    while (true) {
+        workers.wait(lock, [&]() -> bool {
+            return (false == running_.load()) || (false == ready.empty());
+        });
+
+        if (false == running_.load()) { return; }
+
+        auto [entry, generation] = ready.front();
+        ready.pop_front();
+
+        if (entry->cancelled_ || (generation != entry->generation_)) {
+            continue;
+        }
+
+        entry->running_ = true;
+        entry->rescheduled_ = false;
+        lock.unlock();
+        running_task_ = entry->id_;
+        entry->task_();
+        running_task_ = 0;
+        lock.lock();
+        entry->running_ = false;
+        finished_.notify_all();
+
+        if (entry->cancelled_) { continue; }
+
+        if (entry->rescheduled_) {
+            insert(lock, entry);
+        } else if (0 < entry->interval_) {
+            entry->deadline_ = elapsed() + entry->interval_;
+            insert(lock, entry);
+        } else {
+            entries_.erase(entry->id_);
+
+            continue;
+        }
+
+        driver_.notify_one();
+    }
+}
+
+Timer::~Timer()
+{
+    Lock lock(lock_);
+    running_.store(false);
+    lock.unlock();
+    driver_.notify_all();
+
+    for (auto& workers : workers_) { workers.notify_all(); }
+
+    if (driver_thread_.joinable()) { driver_thread_.join(); }
+
+    for (auto& thread : worker_threads_) {
+        if (thread.joinable()) { thread.join(); }
+    }
+}
+}  // namespace opentxs::api::implementation
@@ -0,0 +1,119 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Internal.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace opentxs::api::implementation
+{
+class Timer final : virtual public api::internal::Timer
+{
+public:
+    void Cancel(const TimerID id) const override;
+    bool Reschedule(const TimerID id, const std::chrono::milliseconds delay)
+        const override;
+    TimerID Schedule(
+        const std::chrono::milliseconds delay,
+        const std::chrono::milliseconds interval,
+        const Task& task) const override;
+    TimerID ScheduleLong(
+        const std::chrono::milliseconds delay,
+        const std::chrono::milliseconds interval,
+        const Task& task) const override;
+
+    ~Timer();
+
+private:
+    friend opentxs::Factory;
+
+    using Clock = std::chrono::steady_clock;
+    using Tick = std::uint64_t;
+
+    struct Entry {
+        const TimerID id_;
+        const Task task_;
+        const Tick interval_;
+        const bool long_;
+        // Incremented whenever the entry is moved, which invalidates any
+        // earlier position of the entry in the wheel
+        std::uint64_t generation_{0};
+        Tick deadline_{0};
+        bool running_{false};
+        bool cancelled_{false};
+        bool rescheduled_{false};
+
+        Entry(
+            const TimerID id,
+            const Task& task,
+            const Tick interval,
+            const bool isLong)
+            : id_(id)
+            , task_(task)
+            , interval_(interval)
+            , long_(isLong)
+        {
+        }
+    };
+
+    /** Entry, generation at the time the entry was queued */
+    using Item = std::pair<std::shared_ptr<Entry>, std::uint64_t>;
+    using Slot = std::vector<Item>;
+    using Level = std::array<Slot, 64>;
+
+    static thread_local TimerID running_task_;
+
+    const Clock::time_point start_;
+    mutable std::mutex lock_;
+    mutable std::condition_variable driver_;
+    // Short and long tasks have separate queues and workers
+    mutable std::array<std::condition_variable, 2> workers_;
+    mutable std::condition_variable finished_;
+    mutable std::atomic<bool> running_;
+    mutable TimerID next_id_;
+    mutable Tick current_tick_;
+    mutable std::map<TimerID, std::shared_ptr<Entry>> entries_;
+    mutable std::array<Slot, 256> wheel_;
+    mutable std::array<Level, 3> levels_;
+    mutable std::array<std::deque<Item>, 2> ready_;
+    std::thread driver_thread_;
+    std::vector<std::thread> worker_threads_;
+
+    static Tick ticks(const std::chrono::milliseconds duration);
+
+    void advance(const Lock& lock) const;
+    void cascade(const Lock& lock, const std::size_t level) const;
+    void drive() const;
+    Tick elapsed() const;
+    void insert(const Lock& lock, std::shared_ptr<Entry>& entry) const;
+    Tick next_wakeup(const Lock& lock) const;
+    void queue(const Lock& lock, const Item& item) const;
+    TimerID schedule(
+        const std::chrono::milliseconds delay,
+        const std::chrono::milliseconds interval,
+        const Task& task,
+        const bool isLong) const;
+    void work(const bool isLong) const;
+
+    Timer();
+    Timer(const Timer&) = delete;
+    Timer(Timer&&) = delete;
+    Timer& operator=(const Timer&) = delete;
+    Timer& operator=(Timer&&) = delete;
+};
+}  // namespace opentxs::api::implementation
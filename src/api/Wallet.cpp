@@ -124,8 +124,9 @@ Wallet::AccountLock& Wallet::account(
     auto& pAccount = std::get<1>(row);
 
     if (pAccount) {
-        otInfo << OT_METHOD << __FUNCTION__ << ": Account " << account.str()
-               << " already exists in map." << std::endl;
+        OT_LOG_IF(otInfo) << OT_METHOD << __FUNCTION__ << ": Account "
+                          << account.str() << " already exists in map."
+                          << std::endl;
 
         return row;
     }
@@ -143,8 +144,9 @@ Wallet::AccountLock& Wallet::account(
         api_.Storage().Load(account.str(), serialized, alias, true);
 
     if (loaded) {
-        otInfo << OT_METHOD << __FUNCTION__ << ": Account " << account.str()
-               << " loaded from storage." << std::endl;
+        OT_LOG_IF(otInfo) << OT_METHOD << __FUNCTION__ << ": Account "
+                          << account.str() << " loaded from storage."
+                          << std::endl;
         pAccount.reset(account_factory(account, alias, serialized));
 
         OT_ASSERT(pAccount);
@@ -27,9 +27,20 @@
 #endif
 #include "opentxs/crypto/Bip32.hpp"
 
+#include "internal/api/Internal.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <set>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
 
 #include "Blockchain.hpp"
 
@@ -62,9 +73,10 @@ namespace opentxs
 {
 api::client::Blockchain* Factory::Blockchain(
     const api::Core& api,
-    const api::client::Activity& activity)
+    const api::client::Activity& activity,
+    const api::internal::Timer& timer)
 {
-    return new api::client::implementation::Blockchain(api, activity);
+    return new api::client::implementation::Blockchain(api, activity, timer);
 }
 }  // namespace opentxs
 
@@ -72,12 +84,19 @@ namespace opentxs::api::client::implementation
 {
 Blockchain::Blockchain(
     const api::Core& api,
-    const api::client::Activity& activity)
+    const api::client::Activity& activity,
+    const api::internal::Timer& timer)
     : api_(api)
     , activity_(activity)
+    , timer_(timer)
     , lock_()
     , nym_lock_()
     , account_lock_()
+    , chain_key_lock_()
+    , chain_keys_()
+    , address_index_lock_()
+    , address_index_()
+    , indexed_accounts_()
 {
     // WARNING: do not access api_.Wallet() during construction
 }
@@ -95,8 +114,12 @@ std::shared_ptr<proto::Bip44Account> Blockchain::Account(
     if (false == bool(account)) {
         otErr << OT_METHOD << __FUNCTION__ << ": Account does not exist."
               << std::endl;
+
+        return account;
     }
 
+    merge_transactions(*account);
+
     return account;
 }
 
@@ -224,11 +247,133 @@ std::unique_ptr<proto::Bip44Address> Blockchain::AllocateAddress(
         return output;
     }
 
+    index_address(sNymID, type, sAccountID, chain, newAddress);
     output.reset(new proto::Bip44Address(newAddress));
 
     return output;
 }
 
+std::uint32_t Blockchain::AllocateAddresses(
+    const Identifier& nymID,
+    const Identifier& accountID,
+    const std::uint32_t gap,
+    const BIP44Chain chain) const
+{
+    LOCK_ACCOUNT()
+
+    const std::string sNymID = nymID.str();
+    const std::string sAccountID = accountID.str();
+    auto account = load_account(accountLock, sNymID, sAccountID);
+
+    if (false == bool(account)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Account does not exist."
+              << std::endl;
+
+        return 0;
+    }
+
+    const auto& addresses =
+        chain ? account->internaladdress() : account->externaladdress();
+    std::uint32_t firstUnused{0};
+
+    for (const auto& address : addresses) {
+        if (false == incoming(sAccountID, chain, address).empty()) {
+            firstUnused = std::max(firstUnused, address.index() + 1);
+        }
+    }
+
+    const std::uint32_t allocated =
+        chain ? account->internalindex() : account->externalindex();
+    const std::uint64_t target =
+        std::min<std::uint64_t>(std::uint64_t(firstUnused) + gap, MAX_INDEX);
+
+    if (target <= allocated) { return 0; }
+
+    const auto count = static_cast<std::uint32_t>(target - allocated);
+    auto publicKey = Data::Factory();
+    auto chainCode = Data::Factory();
+
+    if (false == chain_key(*account, chain, publicKey, chainCode)) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Unable to obtain extended public key." << std::endl;
+
+        return 0;
+    }
+
+    // The calling thread derives addresses alongside the timer's workers, so
+    // the job finishes even if no worker is free. Tasks which start after
+    // every index has been claimed return without touching this object.
+    struct Derivation {
+        std::vector<std::string> addresses_;
+        std::atomic<std::uint32_t> next_{0};
+        std::uint32_t finished_{0};
+        std::mutex lock_;
+        std::condition_variable done_;
+    };
+    auto job = std::make_shared<Derivation>();
+    job->addresses_.resize(count);
+    const auto derive = [this, job, account, chain, allocated, count]() {
+        for (auto i = job->next_++; i < count; i = job->next_++) {
+            auto address = calculate_address(*account, chain, allocated + i);
+            Lock lock(job->lock_);
+            job->addresses_[i] = std::move(address);
+
+            if (count == ++job->finished_) { job->done_.notify_all(); }
+        }
+    };
+    const auto threads =
+        std::max(1u, std::min(std::thread::hardware_concurrency(), count));
+
+    for (std::uint32_t thread = 1; thread < threads; ++thread) {
+        timer_.Schedule(
+            std::chrono::milliseconds(0), std::chrono::milliseconds(0), derive);
+    }
+
+    derive();
+
+    {
+        Lock lock(job->lock_);
+        job->done_.wait(
+            lock, [&]() -> bool { return count == job->finished_; });
+    }
+
+    const auto& derived = job->addresses_;
+
+    for (std::uint32_t i = 0; i < count; ++i) {
+        if (derived[i].empty()) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Failed to derive address "
+                  << allocated + i << "." << std::endl;
+
+            return 0;
+        }
+    }
+
+    std::vector<proto::Bip44Address> added{};
+
+    for (std::uint32_t i = 0; i < count; ++i) {
+        auto& newAddress = add_address(allocated + i, *account, chain);
+        newAddress.set_version(BLOCKCHAIN_VERSION);
+        newAddress.set_index(allocated + i);
+        newAddress.set_address(derived[i]);
+        added.emplace_back(newAddress);
+    }
+
+    const auto saved = api_.Storage().Store(sNymID, account->type(), *account);
+
+    if (false == saved) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to save account."
+              << std::endl;
+
+        return 0;
+    }
+
+    for (const auto& address : added) {
+        index_address(sNymID, account->type(), sAccountID, chain, address);
+    }
+
+    return count;
+}
+
 bool Blockchain::AssignAddress(
     const Identifier& nymID,
     const Identifier& accountID,
@@ -263,9 +408,10 @@ bool Blockchain::AssignAddress(
 
     auto& address = find_address(index, chain, *account);
     const auto& existing = address.contact();
+    const auto transactions = incoming(sAccountID, chain, address);
 
     if (false == existing.empty()) {
-        move_transactions(nymID, address, existing, sContactID);
+        move_transactions(nymID, transactions, existing, sContactID);
     }
 
     address.set_contact(sContactID);
@@ -285,7 +431,7 @@ bool Blockchain::AssignAddress(
         std::shared_ptr<proto::StorageThread> thread =
             activity_.Thread(nymID, contactID);
         OT_ASSERT(thread);
-        for (const std::string& txID : address.incoming()) {
+        for (const std::string& txID : transactions) {
             bool exists = false;
             for (const auto activity : thread->item())
                 if (txID.compare(activity.id()) == 0) exists = true;
@@ -301,7 +447,7 @@ bool Blockchain::AssignAddress(
         }
     } else {
         // create the thread and add the transactions
-        for (const auto txID : address.incoming()) {
+        for (const auto txID : transactions) {
             activity_.AddBlockchainTransaction(
                 nymID,
                 contactID,
@@ -365,39 +511,22 @@ std::string Blockchain::calculate_address(
     const BIP44Chain chain,
     const std::uint32_t index) const
 {
-    const auto& path = account.path();
-    auto fingerprint = path.root();
-    auto serialized = api_.Seeds().AccountChildKey(path, chain, index);
-
-    if (false == bool(serialized)) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Unable to derive key."
-              << std::endl;
-
-        return {};
-    }
+    auto publicKey = Data::Factory();
+    auto chainCode = Data::Factory();
 
-    const auto key{opentxs::crypto::key::Asymmetric::Factory(*serialized)};
-    const opentxs::crypto::key::Secp256k1* ecKey{
-        dynamic_cast<const opentxs::crypto::key::Secp256k1*>(&key.get())};
-
-    if (false == bool(key.get())) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Unable to instantiate key."
-              << std::endl;
-
-        return {};
-    }
-
-    if (nullptr == ecKey) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Incorrect key type."
-              << std::endl;
+    if (false == chain_key(account, chain, publicKey, chainCode)) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Unable to obtain extended public key." << std::endl;
 
         return {};
     }
 
     auto pubkey = Data::Factory();
+    const bool derived = api_.Crypto().BIP32().PublicChild(
+        EcdsaCurve::SECP256K1, publicKey, chainCode, index, pubkey);
 
-    if (false == ecKey->GetPublicKey(pubkey)) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Unable to extract public key."
+    if (false == derived) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to derive key."
               << std::endl;
 
         return {};
@@ -441,6 +570,33 @@ std::string Blockchain::calculate_address(
     return api_.Crypto().Encode().IdentifierEncode(preimage);
 }
 
+bool Blockchain::chain_key(
+    const proto::Bip44Account& account,
+    const BIP44Chain chain,
+    Data& publicKey,
+    Data& chainCode) const
+{
+    Lock lock(chain_key_lock_);
+    const ChainKeyID id{account.id(), chain};
+    auto it = chain_keys_.find(id);
+
+    if (chain_keys_.end() == it) {
+        auto key = Data::Factory();
+        auto code = Data::Factory();
+        const bool exported = api_.Seeds().AccountChainPublicKey(
+            account.path(), chain, key, code);
+
+        if (false == exported) { return false; }
+
+        it = chain_keys_.emplace(id, ChainKey{key, code}).first;
+    }
+
+    publicKey.Assign(it->second.first);
+    chainCode.Assign(it->second.second);
+
+    return true;
+}
+
 proto::Bip44Address& Blockchain::find_address(
     const std::uint32_t index,
     const BIP44Chain chain,
@@ -464,6 +620,52 @@ proto::Bip44Address& Blockchain::find_address(
     OT_FAIL;
 }
 
+std::set<std::string> Blockchain::incoming(
+    const std::string& accountID,
+    const BIP44Chain chain,
+    const proto::Bip44Address& address) const
+{
+    // Older accounts recorded transactions directly in the address
+    auto output = api_.Storage().BlockchainAddressTransactions(
+        accountID, chain, address.index());
+    output.insert(address.incoming().begin(), address.incoming().end());
+
+    return output;
+}
+
+void Blockchain::index_account(
+    const std::string& nymID,
+    const proto::Bip44Account& account) const
+{
+    Lock lock(address_index_lock_);
+
+    if (0 < indexed_accounts_.count(account.id())) { return; }
+
+    for (const auto& address : account.internaladdress()) {
+        address_index_[AddressKey{nymID, account.type(), address.address()}] =
+            AddressLocation{account.id(), INTERNAL_CHAIN, address.index()};
+    }
+
+    for (const auto& address : account.externaladdress()) {
+        address_index_[AddressKey{nymID, account.type(), address.address()}] =
+            AddressLocation{account.id(), EXTERNAL_CHAIN, address.index()};
+    }
+
+    indexed_accounts_.emplace(account.id());
+}
+
+void Blockchain::index_address(
+    const std::string& nymID,
+    const proto::ContactItemType type,
+    const std::string& accountID,
+    const BIP44Chain chain,
+    const proto::Bip44Address& address) const
+{
+    Lock lock(address_index_lock_);
+    address_index_[AddressKey{nymID, type, address.address()}] =
+        AddressLocation{accountID, chain, address.index()};
+}
+
 void Blockchain::init_path(
     const std::string& root,
     const proto::ContactItemType chain,
@@ -502,6 +704,8 @@ std::shared_ptr<proto::Bip44Account> Blockchain::load_account(
     std::shared_ptr<proto::Bip44Account> account{nullptr};
     api_.Storage().Load(nymID, accountID, account);
 
+    if (account) { index_account(nymID, *account); }
+
     return account;
 }
 
@@ -537,19 +741,88 @@ std::unique_ptr<proto::Bip44Address> Blockchain::LoadAddress(
 
     auto& address = find_address(index, chain, *account);
     output.reset(new proto::Bip44Address(address));
+    merge_transactions(sAccountID, chain, *output);
 
     return output;
 }
 
+bool Blockchain::LookupAddress(
+    const Identifier& nymID,
+    const proto::ContactItemType type,
+    const std::string& address,
+    Identifier& accountID,
+    BIP44Chain& chain,
+    std::uint32_t& index) const
+{
+    // Addresses are only found in accounts belonging to the specified nym on
+    // the specified chain
+    const AddressKey key{nymID.str(), type, address};
+    Lock lock(address_index_lock_);
+    auto it = address_index_.find(key);
+
+    if (address_index_.end() == it) {
+        lock.unlock();
+
+        // Loading an account adds its addresses to the index
+        for (const auto& id : AccountList(nymID, type)) { Account(nymID, id); }
+
+        lock.lock();
+        it = address_index_.find(key);
+    }
+
+    if (address_index_.end() == it) { return false; }
+
+    const auto& [account, addressChain, addressIndex] = it->second;
+    accountID.SetString(account);
+    chain = addressChain;
+    index = addressIndex;
+
+    return true;
+}
+
+void Blockchain::merge_transactions(proto::Bip44Account& account) const
+{
+    for (auto& address : *account.mutable_internaladdress()) {
+        merge_transactions(account.id(), INTERNAL_CHAIN, address);
+    }
+
+    for (auto& address : *account.mutable_externaladdress()) {
+        merge_transactions(account.id(), EXTERNAL_CHAIN, address);
+    }
+
+    std::set<std::string> existing{
+        account.outgoing().begin(), account.outgoing().end()};
+
+    for (const auto& txid :
+         api_.Storage().BlockchainOutgoingTransactions(account.id())) {
+        if (existing.emplace(txid).second) { account.add_outgoing(txid); }
+    }
+}
+
+void Blockchain::merge_transactions(
+    const std::string& accountID,
+    const BIP44Chain chain,
+    proto::Bip44Address& address) const
+{
+    std::set<std::string> existing{
+        address.incoming().begin(), address.incoming().end()};
+    const auto indexed = api_.Storage().BlockchainAddressTransactions(
+        accountID, chain, address.index());
+
+    for (const auto& txid : indexed) {
+        if (existing.emplace(txid).second) { address.add_incoming(txid); }
+    }
+}
+
 bool Blockchain::move_transactions(
     const Identifier& nymID,
-    const proto::Bip44Address& address,
+    const std::set<std::string>& transactions,
     const std::string& fromContact,
     const std::string& toContact) const
 {
     bool output{true};
 
-    for (const auto& txid : address.incoming()) {
+    for (const auto& txid : transactions) {
         output &= activity_.MoveIncomingBlockchainTransaction(
             nymID,
             Identifier::Factory(fromContact),
@@ -642,6 +915,14 @@ bool Blockchain::StoreIncoming(
     const std::uint32_t index,
     const BIP44Chain chain,
     const proto::BlockchainTransaction& transaction) const
+{
+    return StoreIncoming(nymID, accountID, {{chain, index, transaction}});
+}
+
+bool Blockchain::StoreIncoming(
+    const Identifier& nymID,
+    const Identifier& accountID,
+    const IncomingTransactions& transactions) const
 {
     LOCK_ACCOUNT()
 
@@ -656,52 +937,40 @@ bool Blockchain::StoreIncoming(
         return false;
     }
 
-    const auto allocatedIndex =
-        chain ? account->internalindex() : account->externalindex();
-
-    if (index > allocatedIndex) {
-        otErr << OT_METHOD << __FUNCTION__
-              << ": Address has not been allocated." << std::endl;
+    for (const auto& [chain, index, transaction] : transactions) {
+        const auto allocatedIndex =
+            chain ? account->internalindex() : account->externalindex();
 
-        return false;
-    }
-
-    auto& address = find_address(index, chain, *account);
-    bool exists = false;
+        if (index >= allocatedIndex) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Address " << index
+                  << " has not been allocated." << std::endl;
 
-    for (const auto& txid : address.incoming()) {
-        if (txid == transaction.txid()) {
-            exists = true;
-            break;
+            return false;
         }
     }
 
-    if (false == exists) { address.add_incoming(transaction.txid()); }
-
-    auto saved = api_.Storage().Store(sNymID, account->type(), *account);
+    const auto saved = api_.Storage().Store(sAccountID, transactions);
 
     if (false == saved) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Failed to save account."
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to save transactions."
               << std::endl;
 
         return false;
     }
 
-    saved = api_.Storage().Store(transaction);
-
-    if (false == saved) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Failed to save transaction."
-              << std::endl;
+    bool output{true};
 
-        return false;
-    }
+    for (const auto& [chain, index, transaction] : transactions) {
+        const auto& address = find_address(index, chain, *account);
 
-    if (address.contact().empty()) { return true; }
+        if (address.contact().empty()) { continue; }
 
-    const auto contactID = Identifier::Factory(address.contact());
+        const auto contactID = Identifier::Factory(address.contact());
+        output &= activity_.AddBlockchainTransaction(
+            nymID, contactID, StorageBox::INCOMINGBLOCKCHAIN, transaction);
+    }
 
-    return activity_.AddBlockchainTransaction(
-        nymID, contactID, StorageBox::INCOMINGBLOCKCHAIN, transaction);
+    return output;
 }
 
 bool Blockchain::StoreOutgoing(
@@ -723,18 +992,7 @@ bool Blockchain::StoreOutgoing(
         return false;
     }
 
-    const auto& txid = transaction.txid();
-    account->add_outgoing(txid);
-    auto saved = api_.Storage().Store(sNymID, account->type(), *account);
-
-    if (false == saved) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Failed to save account."
-              << std::endl;
-
-        return false;
-    }
-
-    saved = api_.Storage().Store(transaction);
+    const auto saved = api_.Storage().Store(sAccountID, transaction);
 
     if (false == saved) {
         otErr << OT_METHOD << __FUNCTION__ << ": Failed to save transaction."
@@ -22,6 +22,11 @@ public:
         const Identifier& accountID,
         const std::string& label = "",
         const BIP44Chain chain = EXTERNAL_CHAIN) const override;
+    std::uint32_t AllocateAddresses(
+        const Identifier& nymID,
+        const Identifier& accountID,
+        const std::uint32_t gap,
+        const BIP44Chain chain = EXTERNAL_CHAIN) const override;
     bool AssignAddress(
         const Identifier& nymID,
         const Identifier& accountID,
@@ -33,6 +38,13 @@ public:
         const Identifier& accountID,
         const std::uint32_t index,
         const BIP44Chain chain) const override;
+    bool LookupAddress(
+        const Identifier& nymID,
+        const proto::ContactItemType type,
+        const std::string& address,
+        Identifier& accountID,
+        BIP44Chain& chain,
+        std::uint32_t& index) const override;
     OTIdentifier NewAccount(
         const Identifier& nymID,
         const BlockchainAccountType standard,
@@ -43,6 +55,10 @@ public:
         const std::uint32_t index,
         const BIP44Chain chain,
         const proto::BlockchainTransaction& transaction) const override;
+    bool StoreIncoming(
+        const Identifier& nymID,
+        const Identifier& accountID,
+        const IncomingTransactions& transactions) const override;
     bool StoreOutgoing(
         const Identifier& senderNymID,
         const Identifier& accountID,
@@ -55,14 +71,31 @@ public:
 
 private:
     typedef std::map<OTIdentifier, std::mutex> IDLock;
+    /** accountID, chain */
+    using ChainKeyID = std::pair<std::string, BIP44Chain>;
+    /** public key, chain code */
+    using ChainKey = std::pair<OTData, OTData>;
+    /** nymID, chain type, address */
+    using AddressKey =
+        std::tuple<std::string, proto::ContactItemType, std::string>;
+    /** accountID, chain, index */
+    using AddressLocation = std::tuple<std::string, BIP44Chain, std::uint32_t>;
 
     friend opentxs::Factory;
 
     const api::Core& api_;
     const api::client::Activity& activity_;
+    const api::internal::Timer& timer_;
     mutable std::mutex lock_;
     mutable IDLock nym_lock_;
     mutable IDLock account_lock_;
+    mutable std::mutex chain_key_lock_;
+    mutable std::map<ChainKeyID, ChainKey> chain_keys_;
+    mutable std::mutex address_index_lock_;
+    /** In-memory cache rebuilt from the stored accounts as they are loaded */
+    mutable std::map<AddressKey, AddressLocation> address_index_;
+    mutable std::set<std::string> indexed_accounts_;
+
     proto::Bip44Address& add_address(
         const std::uint32_t index,
         proto::Bip44Account& account,
@@ -74,10 +107,28 @@ private:
         const proto::Bip44Account& account,
         const BIP44Chain chain,
         const std::uint32_t index) const;
+    bool chain_key(
+        const proto::Bip44Account& account,
+        const BIP44Chain chain,
+        Data& publicKey,
+        Data& chainCode) const;
     proto::Bip44Address& find_address(
         const std::uint32_t index,
         const BIP44Chain chain,
         proto::Bip44Account& account) const;
+    std::set<std::string> incoming(
+        const std::string& accountID,
+        const BIP44Chain chain,
+        const proto::Bip44Address& address) const;
+    void index_account(
+        const std::string& nymID,
+        const proto::Bip44Account& account) const;
+    void index_address(
+        const std::string& nymID,
+        const proto::ContactItemType type,
+        const std::string& accountID,
+        const BIP44Chain chain,
+        const proto::Bip44Address& address) const;
     void init_path(
         const std::string& root,
         const proto::ContactItemType chain,
@@ -88,13 +139,21 @@ private:
         const Lock& lock,
         const std::string& nymID,
         const std::string& accountID) const;
+    void merge_transactions(proto::Bip44Account& account) const;
+    void merge_transactions(
+        const std::string& accountID,
+        const BIP44Chain chain,
+        proto::Bip44Address& address) const;
     bool move_transactions(
         const Identifier& nymID,
-        const proto::Bip44Address& address,
+        const std::set<std::string>& transactions,
         const std::string& fromContact,
         const std::string& toContact) const;
 
-    Blockchain(const api::Core& api, const api::client::Activity& activity);
+    Blockchain(
+        const api::Core& api,
+        const api::client::Activity& activity,
+        const api::internal::Timer& timer);
     Blockchain() = delete;
     Blockchain(const Blockchain&) = delete;
     Blockchain(Blockchain&&) = delete;
@@ -52,11 +52,12 @@ api::client::internal::Manager* Factory::ClientManager(
     const api::Settings& config,
     const api::Crypto& crypto,
     const network::zeromq::Context& context,
+    const api::internal::Timer& timer,
     const std::string& dataFolder,
     const int instance)
 {
     return new api::client::implementation::Manager(
-        running, args, config, crypto, context, dataFolder, instance);
+        running, args, config, crypto, context, timer, dataFolder, instance);
 }
 }  // namespace opentxs
 
@@ -68,15 +69,25 @@ Manager::Manager(
     const api::Settings& config,
     const api::Crypto& crypto,
     const opentxs::network::zeromq::Context& context,
+    const api::internal::Timer& timer,
     const std::string& dataFolder,
     const int instance)
-    : Core(running, args, crypto, config, context, dataFolder, instance, false)
-    , zeromq_(opentxs::Factory::ZMQ(*this, running_))
+    : Core(
+          running,
+          args,
+          crypto,
+          config,
+          context,
+          timer,
+          dataFolder,
+          instance,
+          false)
+    , zeromq_(opentxs::Factory::ZMQ(*this, running_, timer))
     , identity_(opentxs::Factory::Identity(*this))
     , contacts_(opentxs::Factory::Contacts(*this))
     , activity_(opentxs::Factory::Activity(*this, *contacts_))
 #if OT_CRYPTO_SUPPORTED_KEY_HD
-    , blockchain_(opentxs::Factory::Blockchain(*this, *activity_))
+    , blockchain_(opentxs::Factory::Blockchain(*this, *activity_, timer))
 #endif
     , workflow_(opentxs::Factory::Workflow(*this, *activity_, *contacts_))
     , ot_api_(new OT_API(
@@ -103,8 +114,8 @@ Manager::Manager(
           *this,
           *ot_api_->m_pClient,
           std::bind(&Manager::get_lock, this, std::placeholders::_1)))
-    , pair_(opentxs::Factory::Pair(running_, *this))
-    , ui_(opentxs::Factory::UI(*this, running_))
+    , pair_(opentxs::Factory::Pair(running_, *this, timer))
+    , ui_(opentxs::Factory::UI(*this, running_, timer))
     , lock_()
     , map_lock_()
     , context_locks_()
@@ -70,6 +70,7 @@ private:
         const api::Settings& config,
         const api::Crypto& crypto,
         const opentxs::network::zeromq::Context& context,
+        const api::internal::Timer& timer,
         const std::string& dataFolder,
         const int instance);
     Manager() = delete;
@@ -31,6 +31,8 @@
 #include "opentxs/network/zeromq/Context.hpp"
 #include "opentxs/network/zeromq/PublishSocket.hpp"
 
+#include "internal/api/Internal.hpp"
+
 #include <atomic>
 #include <memory>
 #include <map>
@@ -41,6 +43,7 @@
 #include "Pair.hpp"
 
 #define MINIMUM_UNUSED_BAILMENTS 3
+#define OT_PAIR_REFRESH_MILLISECONDS 100
 
 #define SHUTDOWN()                                                             \
     {                                                                          \
@@ -57,9 +60,10 @@ namespace opentxs
 {
 api::client::Pair* Factory::Pair(
     const Flag& running,
-    const api::client::Manager& client)
+    const api::client::Manager& client,
+    const api::internal::Timer& timer)
 {
-    return new api::client::implementation::Pair(running, client);
+    return new api::client::implementation::Pair(running, client, timer);
 }
 }  // namespace opentxs
 
@@ -73,21 +77,28 @@ Pair::Cleanup::Cleanup(Flag& run)
 
 Pair::Cleanup::~Cleanup() { run_.Off(); }
 
-Pair::Pair(const Flag& running, const api::client::Manager& client)
+Pair::Pair(
+    const Flag& running,
+    const api::client::Manager& client,
+    const api::internal::Timer& timer)
     : running_(running)
     , client_(client)
     , status_lock_()
     , pairing_(Flag::Factory(false))
     , last_refresh_(0)
     , pairing_thread_(nullptr)
-    , refresh_thread_(nullptr)
+    , timer_(timer)
+    , refresh_timer_(0)
     , pair_status_()
     , update_()
     , pair_event_(client.ZeroMQ().PublishSocket())
     , pending_bailment_(client.ZeroMQ().PublishSocket())
 {
     // WARNING: do not access client_.Wallet() during construction
-    refresh_thread_.reset(new std::thread(&Pair::check_refresh, this));
+    refresh_timer_ = timer_.Schedule(
+        std::chrono::milliseconds(0),
+        std::chrono::milliseconds(OT_PAIR_REFRESH_MILLISECONDS),
+        [this]() -> void { this->check_refresh(); });
     pair_event_->Start(client_.Endpoints().PairEvent());
     pending_bailment_->Start(client_.Endpoints().PendingBailment());
 }
@@ -165,19 +176,16 @@ void Pair::check_pairing() const
 
 void Pair::check_refresh() const
 {
+    if (false == running_) { return; }
+
     auto taskID = Identifier::Factory();
     bool update{false};
+    const auto current = client_.Sync().RefreshCount();
+    const auto previous = last_refresh_.exchange(current);
 
-    while (running_) {
-        const auto current = client_.Sync().RefreshCount();
-        const auto previous = last_refresh_.exchange(current);
-
-        if (previous != current) { refresh(); }
+    if (previous != current) { refresh(); }
 
-        if (update_.Pop(taskID, update)) { refresh(); }
-
-        Log::Sleep(std::chrono::milliseconds(100));
-    }
+    if (update_.Pop(taskID, update)) { refresh(); }
 }
 
 std::map<OTIdentifier, std::set<OTIdentifier>> Pair::create_issuer_map() const
@@ -923,10 +931,7 @@ Pair::~Pair()
 {
     if (pairing_.get()) { Log::Sleep(std::chrono::milliseconds(250)); }
 
-    if (refresh_thread_) {
-        refresh_thread_->join();
-        refresh_thread_.reset();
-    }
+    timer_.Cancel(refresh_timer_);
 
     if (pairing_thread_) {
         pairing_thread_->join();
@@ -60,7 +60,8 @@ private:
     mutable OTFlag pairing_;
     mutable std::atomic<std::uint64_t> last_refresh_{0};
     mutable std::unique_ptr<std::thread> pairing_thread_{nullptr};
-    mutable std::unique_ptr<std::thread> refresh_thread_{nullptr};
+    const api::internal::Timer& timer_;
+    std::uint64_t refresh_timer_{0};
     mutable std::map<IssuerID, std::pair<Status, bool>> pair_status_{};
     mutable UniqueQueue<bool> update_;
     OTZMQPublishSocket pair_event_;
@@ -133,7 +134,10 @@ private:
     void update_pairing() const;
     void update_peer() const;
 
-    Pair(const Flag& running, const api::client::Manager& client);
+    Pair(
+        const Flag& running,
+        const api::client::Manager& client,
+        const api::internal::Timer& timer);
     Pair() = delete;
     Pair(const Pair&) = delete;
     Pair(Pair&&) = delete;
@@ -441,7 +441,8 @@ bool ServerAction::GetTransactionNumbers(
             lock_callback_({localNymID.str(), serverID.str()}),
             api_,
             localNymID,
-            serverID));
+            serverID,
+            quantity));
         auto response = action->Run();
         if (response.empty()) {
             otErr << OT_METHOD << __FUNCTION__ << ": Failed to obtain "
@@ -42,17 +42,22 @@ namespace opentxs
 {
 api::client::UI* Factory::UI(
     const api::client::Manager& api,
-    const Flag& running)
+    const Flag& running,
+    const api::internal::Timer& timer)
 {
-    return new api::client::implementation::UI(api, running);
+    return new api::client::implementation::UI(api, running, timer);
 }
 }  // namespace opentxs
 
 namespace opentxs::api::client::implementation
 {
-UI::UI(const api::client::Manager& api, const Flag& running)
+UI::UI(
+    const api::client::Manager& api,
+    const Flag& running,
+    const api::internal::Timer& timer)
     : api_(api)
     , running_(running)
+    , timer_(timer)
     , accounts_()
     , accounts_summaries_()
     , activity_summaries_()
@@ -126,7 +131,7 @@ const ui::ActivityThread& UI::ActivityThread(
 
     if (false == bool(output)) {
         output.reset(opentxs::Factory::ActivityThread(
-            api_, widget_update_publisher_, nymID, threadID));
+            api_, timer_, widget_update_publisher_, nymID, threadID));
     }
 
     OT_ASSERT(output)
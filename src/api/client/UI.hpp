@@ -62,6 +62,7 @@ private:
 
     const api::client::Manager& api_;
     const Flag& running_;
+    const api::internal::Timer& timer_;
     mutable AccountActivityMap accounts_{};
     mutable AccountSummaryMap accounts_summaries_{};
     mutable ActivitySummaryMap activity_summaries_{};
@@ -73,7 +74,10 @@ private:
     mutable ProfileMap profiles_{};
     OTZMQPublishSocket widget_update_publisher_;
 
-    UI(const api::client::Manager& api, const Flag& running);
+    UI(
+        const api::client::Manager& api,
+        const Flag& running,
+        const api::internal::Timer& timer);
     UI() = delete;
     UI(const UI&) = delete;
     UI(UI&&) = delete;
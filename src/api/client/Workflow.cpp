@@ -20,6 +20,7 @@
 #include "opentxs/core/OTTransaction.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
 #include "opentxs/network/zeromq/Frame.hpp"
+#include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/network/zeromq/PublishSocket.hpp"
 #include "opentxs/Proto.hpp"
 
@@ -929,7 +930,13 @@ bool Workflow::save_workflow(
 
     OT_ASSERT(saved)
 
-    if (false == accountID.empty()) { account_publisher_->Publish(accountID); }
+    if (false == accountID.empty()) {
+        // Subscribers only need to reload the workflow which changed
+        auto message = opentxs::network::zeromq::Message::Factory();
+        message->AddFrame(accountID);
+        message->AddFrame(workflow.id());
+        account_publisher_->Publish(message);
+    }
 
     return valid && saved;
 }
@@ -59,15 +59,19 @@ template class opentxs::Pimpl<opentxs::crypto::key::Symmetric>;
 
 namespace opentxs
 {
-api::Crypto* Factory::Crypto(const api::Settings& settings)
+api::Crypto* Factory::Crypto(
+    const api::Settings& settings,
+    const api::internal::Timer& timer)
 {
-    return new api::implementation::Crypto(settings);
+    return new api::implementation::Crypto(settings, timer);
 }
 }  // namespace opentxs
 
 namespace opentxs::api::implementation
 {
-Crypto::Crypto(const api::Settings& settings)
+Crypto::Crypto(
+    const api::Settings& settings,
+    [[maybe_unused]] const api::internal::Timer& timer)
     : cached_key_lock_()
     , primary_key_(nullptr)
     , cached_keys_()
@@ -76,7 +80,7 @@ Crypto::Crypto(const api::Settings& settings)
     , bitcoin_(opentxs::Factory::Bitcoin(*this))
 #endif
 #if OT_CRYPTO_USING_TREZOR
-    , trezor_(opentxs::Factory::Trezor(*this))
+    , trezor_(opentxs::Factory::Trezor(*this, timer))
 #endif
     , sodium_(opentxs::Factory::Sodium(*this))
 #if OT_CRYPTO_USING_OPENSSL
@@ -104,7 +104,9 @@ private:
     void Init();
     void Cleanup();
 
-    Crypto(const api::Settings& settings);
+    Crypto(
+        const api::Settings& settings,
+        const api::internal::Timer& timer);
     Crypto() = delete;
     Crypto(const Crypto&) = delete;
     Crypto(Crypto&&) = delete;
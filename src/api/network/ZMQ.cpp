@@ -39,17 +39,24 @@ template class opentxs::Pimpl<opentxs::network::ServerConnection>;
 
 namespace opentxs
 {
-api::network::ZMQ* Factory::ZMQ(const api::Core& api, const Flag& running)
+api::network::ZMQ* Factory::ZMQ(
+    const api::Core& api,
+    const Flag& running,
+    const api::internal::Timer& timer)
 {
-    return new api::network::implementation::ZMQ(api, running);
+    return new api::network::implementation::ZMQ(api, running, timer);
 }
 }  // namespace opentxs
 
 namespace opentxs::api::network::implementation
 {
-ZMQ::ZMQ(const api::Core& api, const Flag& running)
+ZMQ::ZMQ(
+    const api::Core& api,
+    const Flag& running,
+    const api::internal::Timer& timer)
     : api_(api)
     , running_(running)
+    , timer_(timer)
     , linger_(std::chrono::seconds(CLIENT_SOCKET_LINGER_SECONDS))
     , receive_timeout_(std::chrono::seconds(CLIENT_RECV_TIMEOUT))
     , send_timeout_(std::chrono::seconds(CLIENT_SEND_TIMEOUT))
@@ -167,8 +174,8 @@ opentxs::network::ServerConnection& ZMQ::Server(const std::string& id) const
 
     auto [it, created] = server_connections_.emplace(
         id,
-        opentxs::network::ServerConnection::Factory(
-            api_, *this, status_publisher_, contract));
+        OTServerConnection(opentxs::Factory::ServerConnection(
+            api_, *this, status_publisher_, contract, timer_)));
     auto& connection = it->second;
 
     OT_ASSERT(created);
@@ -35,6 +35,7 @@ private:
 
     const api::Core& api_;
     const Flag& running_;
+    const api::internal::Timer& timer_;
     mutable std::atomic<std::chrono::seconds> linger_;
     mutable std::atomic<std::chrono::seconds> receive_timeout_;
     mutable std::atomic<std::chrono::seconds> send_timeout_;
@@ -48,7 +49,9 @@ private:
 
     void init(const Lock& lock) const;
 
-    ZMQ(const api::Core& api, const Flag& running);
+    ZMQ(const api::Core& api,
+        const Flag& running,
+        const api::internal::Timer& timer);
     ZMQ() = delete;
     ZMQ(const ZMQ&) = delete;
     ZMQ(ZMQ&&) = delete;
@@ -61,11 +61,12 @@ api::server::Manager* Factory::ServerManager(
     const api::Crypto& crypto,
     const api::Settings& config,
     const opentxs::network::zeromq::Context& context,
+    const api::internal::Timer& timer,
     const std::string& dataFolder,
     const int instance)
 {
     return new api::server::implementation::Manager(
-        running, args, crypto, config, context, dataFolder, instance);
+        running, args, crypto, config, context, timer, dataFolder, instance);
 }
 }  // namespace opentxs
 
@@ -77,13 +78,26 @@ Manager::Manager(
     const api::Crypto& crypto,
     const api::Settings& config,
     const opentxs::network::zeromq::Context& context,
+    const api::internal::Timer& timer,
     const std::string& dataFolder,
     const int instance)
-    : Core(running, args, crypto, config, context, dataFolder, instance, true)
+    : Core(
+          running,
+          args,
+          crypto,
+          config,
+          context,
+          timer,
+          dataFolder,
+          instance,
+          true)
     , server_p_(new opentxs::server::Server(*this))
     , server_(*server_p_)
-    , message_processor_p_(
-          new opentxs::server::MessageProcessor(server_, context, running_))
+    , message_processor_p_(new opentxs::server::MessageProcessor(
+          server_,
+          context,
+          timer,
+          running_))
     , message_processor_(*message_processor_p_)
 #if OT_CASH
     , mint_thread_(nullptr)
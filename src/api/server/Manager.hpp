@@ -104,6 +104,7 @@ private:
         const api::Crypto& crypto,
         const api::Settings& config,
         const opentxs::network::zeromq::Context& context,
+        const api::internal::Timer& timer,
         const std::string& dataFolder,
         const int instance);
     Manager() = delete;
@@ -153,6 +153,12 @@ api::storage::StorageInternal* Factory::Storage(
         defaultGcInterval,
         configGcInterval,
         notUsed);
+    config.CheckSet_bool(
+        STORAGE_CONFIG_KEY,
+        STORAGE_CONFIG_ASYNC_BACKUP_KEY,
+        storageConfig.async_backup_,
+        storageConfig.async_backup_,
+        notUsed);
     config.CheckSet_str(
         STORAGE_CONFIG_KEY,
         "path",
@@ -561,6 +567,23 @@ std::string Storage::BlockchainAddressOwner(
     return Root().Tree().ContactNode().AddressOwner(chain, address);
 }
 
+std::set<std::string> Storage::BlockchainAddressTransactions(
+    const std::string& accountID,
+    const BIP44Chain chain,
+    const std::uint32_t index) const
+{
+    return Root().Tree().BlockchainNode().IndexedTransactions(
+        opentxs::storage::BlockchainTransactions::AddressKey(
+            accountID, chain, index));
+}
+
+std::set<std::string> Storage::BlockchainOutgoingTransactions(
+    const std::string& accountID) const
+{
+    return Root().Tree().BlockchainNode().IndexedTransactions(
+        opentxs::storage::BlockchainTransactions::OutgoingKey(accountID));
+}
+
 ObjectList Storage::BlockchainTransactionList() const
 {
 
@@ -1057,6 +1080,15 @@ void Storage::MapPublicNyms(NymLambda& lambda) const
     bgMap.detach();
 }
 
+// Applies a lambda to one slice of the public nyms in the calling thread.
+std::string Storage::MapPublicNyms(
+    NymLambda& lambda,
+    const std::string& after,
+    const std::size_t limit) const
+{
+    return Root().Tree().NymNode().Map(lambda, after, limit);
+}
+
 // Applies a lambda to all server contracts in the database in a detached
 // thread.
 void Storage::MapServers(ServerLambda& lambda) const
@@ -1065,6 +1097,16 @@ void Storage::MapServers(ServerLambda& lambda) const
     bgMap.detach();
 }
 
+// Applies a lambda to one slice of the server contracts in the calling
+// thread.
+std::string Storage::MapServers(
+    ServerLambda& lambda,
+    const std::string& after,
+    const std::size_t limit) const
+{
+    return Root().Tree().ServerNode().Map(lambda, after, limit);
+}
+
 // Applies a lambda to all unit definitions in the database in a detached
 // thread.
 void Storage::MapUnitDefinitions(UnitLambda& lambda) const
@@ -1073,6 +1115,16 @@ void Storage::MapUnitDefinitions(UnitLambda& lambda) const
     bgMap.detach();
 }
 
+// Applies a lambda to one slice of the unit definitions in the calling
+// thread.
+std::string Storage::MapUnitDefinitions(
+    UnitLambda& lambda,
+    const std::string& after,
+    const std::size_t limit) const
+{
+    return Root().Tree().UnitNode().Map(lambda, after, limit);
+}
+
 opentxs::storage::Root* Storage::root() const
 {
     Lock lock(write_lock_);
@@ -1877,6 +1929,48 @@ bool Storage::Store(const proto::BlockchainTransaction& data) const
         .Store(data);
 }
 
+bool Storage::Store(
+    const std::string& accountID,
+    const BlockchainIncoming& incoming) const
+{
+    std::vector<opentxs::storage::BlockchainTransactions::IndexedTransaction>
+        transactions{};
+
+    for (const auto& [chain, index, transaction] : incoming) {
+        transactions.emplace_back(
+            opentxs::storage::BlockchainTransactions::AddressKey(
+                accountID, chain, index),
+            &transaction);
+    }
+
+    return mutable_Root()
+        .It()
+        .mutable_Tree()
+        .It()
+        .mutable_Blockchain()
+        .It()
+        .Store(transactions);
+}
+
+bool Storage::Store(
+    const std::string& accountID,
+    const proto::BlockchainTransaction& outgoing) const
+{
+    const std::vector<
+        opentxs::storage::BlockchainTransactions::IndexedTransaction>
+        transactions{
+            {opentxs::storage::BlockchainTransactions::OutgoingKey(accountID),
+             &outgoing}};
+
+    return mutable_Root()
+        .It()
+        .mutable_Tree()
+        .It()
+        .mutable_Blockchain()
+        .It()
+        .Store(transactions);
+}
+
 bool Storage::Store(const proto::Contact& data) const
 {
     return mutable_Root()
@@ -85,6 +85,12 @@ public:
     std::string BlockchainAddressOwner(
         proto::ContactItemType chain,
         std::string address) const override;
+    std::set<std::string> BlockchainAddressTransactions(
+        const std::string& accountID,
+        const BIP44Chain chain,
+        const std::uint32_t index) const override;
+    std::set<std::string> BlockchainOutgoingTransactions(
+        const std::string& accountID) const override;
     ObjectList BlockchainTransactionList() const override;
     std::string ContactAlias(const std::string& id) const override;
     ObjectList ContactList() const override;
@@ -213,8 +219,20 @@ public:
         const bool checking = false) const override;
     const std::set<std::string> LocalNyms() const override;
     void MapPublicNyms(NymLambda& lambda) const override;
+    std::string MapPublicNyms(
+        NymLambda& lambda,
+        const std::string& after,
+        const std::size_t limit) const override;
     void MapServers(ServerLambda& lambda) const override;
+    std::string MapServers(
+        ServerLambda& lambda,
+        const std::string& after,
+        const std::size_t limit) const override;
     void MapUnitDefinitions(UnitLambda& lambda) const override;
+    std::string MapUnitDefinitions(
+        UnitLambda& lambda,
+        const std::string& after,
+        const std::size_t limit) const override;
     bool MoveThreadItem(
         const std::string& nymId,
         const std::string& fromThreadID,
@@ -299,6 +317,11 @@ public:
         const proto::Bip47Channel& data,
         Identifier& channelID) const override;
     bool Store(const proto::BlockchainTransaction& data) const override;
+    bool Store(const std::string& accountID, const BlockchainIncoming& incoming)
+        const override;
+    bool Store(
+        const std::string& accountID,
+        const proto::BlockchainTransaction& outgoing) const override;
     bool Store(const proto::Contact& data) const override;
     bool Store(const proto::Context& data) const override;
     bool Store(const proto::Credential& data) const override;
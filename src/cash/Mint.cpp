@@ -535,10 +535,7 @@ void Mint::UpdateContents()
         }
     }
 
-    std::string str_result;
-    tag.output(str_result);
-
-    m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    tag.output(m_xmlUnsigned);
 }
 
 // return -1 if error, 0 if nothing, and 1 if the node was processed.
@@ -783,10 +783,7 @@ void Purse::UpdateContents()  // Before transmission or serialization, this is
         tag.add_tag("token", m_dequeTokens[i]->Get());
     }
 
-    std::string str_result;
-    tag.output(str_result);
-
-    m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    tag.output(m_xmlUnsigned);
 }
 
 std::int32_t Purse::ProcessXMLNode(irr::io::IrrXMLReader*& xml)
@@ -249,6 +249,22 @@ OTAPI_Func::OTAPI_Func(
     }
 }
 
+OTAPI_Func::OTAPI_Func(
+    OTAPI_Func_Type theType,
+    std::recursive_mutex& apilock,
+    const api::client::Manager& api,
+    const Identifier& nymID,
+    const Identifier& serverID,
+    const std::size_t quantity)
+    : OTAPI_Func(apilock, api, nymID, serverID, theType)
+{
+    if (theType == GET_TRANSACTION_NUMBERS) {
+        quantity_ = static_cast<Amount>(quantity);
+    } else {
+        OT_FAIL
+    }
+}
+
 OTAPI_Func::OTAPI_Func(
     OTAPI_Func_Type theType,
     std::recursive_mutex& apilock,
@@ -1512,7 +1528,8 @@ void OTAPI_Func::run()
                 isPrimary_);
         } break;
         case GET_TRANSACTION_NUMBERS: {
-            last_attempt_ = api_.OTAPI().getTransactionNumbers(context_);
+            last_attempt_ = api_.OTAPI().getTransactionNumbers(
+                context_, static_cast<std::size_t>(quantity_));
         } break;
         default: {
             otErr << OT_METHOD << __FUNCTION__ << ": Error: unhandled function "
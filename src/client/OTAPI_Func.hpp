@@ -93,6 +93,13 @@ public:
         const Identifier& nymID,
         const Identifier& serverID,
         const bool resync);
+    explicit OTAPI_Func(
+        OTAPI_Func_Type theType,
+        std::recursive_mutex& apilock,
+        const api::client::Manager& api,
+        const Identifier& nymID,
+        const Identifier& serverID,
+        const std::size_t quantity);
     explicit OTAPI_Func(
         OTAPI_Func_Type theType,
         std::recursive_mutex& apilock,
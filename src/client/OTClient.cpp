@@ -1094,6 +1094,55 @@ bool OTClient::init_new_account(
     return true;
 }
 
+std::unique_ptr<OTTransaction> OTClient::instantiate_box_receipt(
+    const String& serialized,
+    const TransactionNumber expected,
+    const Nym& serverNym,
+    const Identifier& nymID) const
+{
+    std::unique_ptr<OTTransactionType> pTransType;
+
+    if (serialized.Exists()) {
+        pTransType = api_.Factory().Transaction(serialized);
+    }
+
+    if (nullptr == dynamic_cast<OTTransaction*>(pTransType.get())) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to instantiate box "
+              << "receipt " << expected << ":\n\n"
+              << serialized << std::endl;
+
+        return {};
+    }
+
+    std::unique_ptr<OTTransaction> output{
+        dynamic_cast<OTTransaction*>(pTransType.release())};
+
+    // Account ID and Notary ID are verified by VerifyAccount()
+    if (false == output->VerifyAccount(serverNym)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Box receipt " << expected
+              << " fails VerifyAccount()." << std::endl;
+
+        return {};
+    }
+
+    if (output->GetTransactionNum() != expected) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Box receipt " << expected
+              << " has transaction number " << output->GetTransactionNum()
+              << std::endl;
+
+        return {};
+    }
+
+    if (output->GetNymID() != nymID) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Box receipt " << expected
+              << " belongs to a different nym." << std::endl;
+
+        return {};
+    }
+
+    return output;
+}
+
 void OTClient::load_str_trans_add_to_ledger(
     const Identifier& the_nym_id,        // the_nym's ID, used only for logging.
     const String& str_trans_to_add,      // (In string form so we're forced to
@@ -2558,6 +2607,9 @@ bool OTClient::processServerReply(
     if (theReply.m_strCommand.Compare("getBoxReceiptResponse")) {
         return processServerReplyGetBoxReceipt(theReply, pNymbox, context);
     }
+    if (theReply.m_strCommand.Compare("getBoxReceiptsResponse")) {
+        return processServerReplyGetBoxReceipts(theReply, context);
+    }
     if ((theReply.m_strCommand.Compare("processInboxResponse") ||
          theReply.m_strCommand.Compare("processNymboxResponse"))) {
 
@@ -2910,62 +2962,21 @@ bool OTClient::processServerReplyGetBoxReceipt(
         // base64-Decode the server reply's payload into strTransaction
         //
         const String strTransTypeObject(theReply.m_ascPayload);
-        std::unique_ptr<OTTransactionType> pTransType;
+        auto pBoxReceipt = instantiate_box_receipt(
+            strTransTypeObject, theReply.m_lTransactionNum, serverNym, nymID);
 
-        if (strTransTypeObject.Exists())
-            pTransType = api_.Factory().Transaction(strTransTypeObject);
-
-        if (false == bool(pTransType))
+        if (false == bool(pBoxReceipt)) {
             otErr << OT_METHOD << __FUNCTION__
-                  << ": getBoxReceiptResponse: Error instantiating transaction "
-                     "type based on decoded theReply.m_ascPayload:\n\n"
-                  << strTransTypeObject << "\n";
-        else {
-            OTTransaction* pBoxReceipt =
-                dynamic_cast<OTTransaction*>(pTransType.get());
-
-            if (nullptr == pBoxReceipt)
-                otErr << OT_METHOD << __FUNCTION__
-                      << ": getBoxReceiptResponse: Error dynamic_cast from "
-                         "transaction type to transaction, based on "
-                         "decoded theReply.m_ascPayload:\n\n"
-                      << strTransTypeObject << "\n\n";
-            else if (!pBoxReceipt->VerifyAccount(serverNym))
-                otErr << OT_METHOD << __FUNCTION__
-                      << ": getBoxReceiptResponse: Error: Box Receipt "
-                      << pBoxReceipt->GetTransactionNum() << " in "
-                      << ((theReply.m_lDepth == 0)
-                              ? "nymbox"
-                              : ((theReply.m_lDepth == 1) ? "inbox" : "outbox"))
-                      << " fails VerifyAccount().\n";  // outbox is 2.);
-            else if (
-                pBoxReceipt->GetTransactionNum() != theReply.m_lTransactionNum)
-                otErr << OT_METHOD << __FUNCTION__
-                      << ": getBoxReceiptResponse: Error: Transaction Number "
-                         "doesn't match on the box receipt itself ("
-                      << pBoxReceipt->GetTransactionNum()
-                      << "), versus the one listed in the reply message ("
-                      << theReply.m_lTransactionNum << ").\n";
-            // Note: Account ID and Notary ID were already verified, in
-            // VerifyAccount().
-            else if (pBoxReceipt->GetNymID() != nymID) {
-                const String strPurportedNymID(pBoxReceipt->GetNymID());
-                otErr
-                    << __FUNCTION__
-                    << ": getBoxReceiptResponse: Error: NymID doesn't match on "
-                       "the box receipt itself ("
-                    << strPurportedNymID
-                    << "), versus the one listed in the reply message ("
-                    << theReply.m_strNymID << ").\n";
-            } else {
-                return processServerReplyGetBoxReceipt(
-                    *pBoxReceipt,
-                    context,
-                    strTransTypeObject,
-                    theReply.m_lDepth);
-            }
-        }  // Success loading the boxReceipt from the server reply
-    }      // No error condition.
+                  << ": getBoxReceiptResponse: Invalid box receipt in "
+                  << ((theReply.m_lDepth == 0)
+                          ? "nymbox"
+                          : ((theReply.m_lDepth == 1) ? "inbox" : "outbox"))
+                  << " for nym " << theReply.m_strNymID << ".\n";
+        } else {
+            return processServerReplyGetBoxReceipt(
+                *pBoxReceipt, context, strTransTypeObject, theReply.m_lDepth);
+        }
+    }  // No error condition.
     else {
         otErr
             << __FUNCTION__
@@ -3158,6 +3169,56 @@ bool OTClient::processServerReplyGetBoxReceipt(
     return true;
 }
 
+bool OTClient::processServerReplyGetBoxReceipts(
+    const Message& theReply,
+    ServerContext& context)
+{
+    setRecentHash(theReply, false, context);
+    const auto& nymID = context.Nym()->ID();
+    const auto& serverNym = context.RemoteNym();
+    const auto boxType = theReply.m_lDepth;
+
+    otInfo << "Received server response to getBoxReceipts request ("
+           << (theReply.m_bSuccess ? "success" : "failure") << ")\n";
+
+    if ((0 > boxType) || (2 < boxType)) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Unknown box type: " << boxType << std::endl;
+
+        return true;
+    }
+
+    if (false == theReply.m_bSuccess) { return true; }
+
+    if (false == theReply.m_ascPayload.Exists()) { return true; }
+
+    std::unique_ptr<OTDB::Storable> pStorable(OTDB::DecodeObject(
+        OTDB::STORED_OBJ_STRING_MAP, String(theReply.m_ascPayload).Get()));
+    auto receipts = dynamic_cast<OTDB::StringMap*>(pStorable.get());
+
+    if (nullptr == receipts) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Unable to decode box receipts." << std::endl;
+
+        return true;
+    }
+
+    // Each receipt gets the same checks as a getBoxReceiptResponse. Invalid
+    // receipts are skipped so the caller can request them individually.
+    for (const auto& [number, serialized] : receipts->the_map) {
+        const String strReceipt(serialized.c_str());
+        auto receipt = instantiate_box_receipt(
+            strReceipt, String(number.c_str()).ToLong(), serverNym, nymID);
+
+        if (false == bool(receipt)) { continue; }
+
+        processServerReplyGetBoxReceipt(
+            *receipt, context, strReceipt, boxType);
+    }
+
+    return true;
+}
+
 bool OTClient::processServerReplyGetInstrumentDefinition(
     const Message& theReply,
     ServerContext& context)
@@ -7292,6 +7353,7 @@ std::int32_t OTClient::ProcessUserCommand(
 
             // (1) Set up member variables
             theMessage.m_strCommand = "getTransactionNumbers";
+            theMessage.m_lDepth = lTransactionAmount;  // Requested block size
             theMessage.SetAcknowledgments(context);
             auto NYMBOX_HASH = Identifier::Factory(context.LocalNymboxHash());
             NYMBOX_HASH->GetString(theMessage.m_strNymboxHash);
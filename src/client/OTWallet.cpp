@@ -233,9 +233,7 @@ bool OTWallet::save_contract(const Lock& lock, String& strContract)
                      "key to wallet.\n";
     }
 
-    std::string str_result;
-    tag.output(str_result);
-    strContract.Concatenate("%s", str_result.c_str());
+    tag.output(strContract);
 
     return true;
 }
@@ -8239,7 +8239,9 @@ CommandResult OT_API::exchangeBasket(
     return output;
 }
 
-CommandResult OT_API::getTransactionNumbers(ServerContext& context) const
+CommandResult OT_API::getTransactionNumbers(
+    ServerContext& context,
+    const std::size_t quantity) const
 {
     rLock lock(
         lock_callback_({context.Nym()->ID().str(), context.Server().str()}));
@@ -8255,7 +8257,7 @@ CommandResult OT_API::getTransactionNumbers(ServerContext& context) const
     // time.)
     const std::size_t nMaxCount = 50;
 
-    if (nCount > nMaxCount) {
+    if ((nCount > nMaxCount) && (nCount >= quantity)) {
         otErr << "OT_API::getTransactionNumbers: Failure: That Nym already "
                  "has "
               << "more than " << nMaxCount << " transaction numbers signed out."
@@ -8272,7 +8274,8 @@ CommandResult OT_API::getTransactionNumbers(ServerContext& context) const
         context,
         *message,
         Identifier::Factory(),
-        Identifier::Factory());
+        Identifier::Factory(),
+        static_cast<Amount>(quantity));
 
     if (1 > requestNum) {
         otErr << OT_METHOD << __FUNCTION__ << ": Error processing "
@@ -11208,6 +11211,49 @@ CommandResult OT_API::getBoxReceipt(
     return output;
 }
 
+CommandResult OT_API::getBoxReceipts(
+    ServerContext& context,
+    const Identifier& ACCOUNT_ID,
+    std::int32_t nBoxType,
+    const NumList& known) const
+{
+    rLock lock(
+        lock_callback_({context.Nym()->ID().str(), context.Server().str()}));
+    CommandResult output{};
+    auto& [requestNum, transactionNum, result] = output;
+    auto& [status, reply] = result;
+    requestNum = -1;
+    transactionNum = 0;
+    status = SendResult::ERROR;
+    reply.reset();
+    const auto& nym = *context.Nym();
+    const auto& nymID = nym.ID();
+
+    if (nymID != ACCOUNT_ID) {
+        auto account = api_.Wallet().Account(ACCOUNT_ID);
+
+        if (false == bool(account)) { return output; }
+    }
+
+    auto [newRequestNumber, message] = context.InitializeServerCommand(
+        MessageType::getBoxReceipts, requestNum);
+    requestNum = newRequestNumber;
+
+    if (false == bool(message)) { return output; }
+
+    message->m_strAcctID = String::Factory(ACCOUNT_ID);
+    message->m_lDepth = static_cast<std::int64_t>(nBoxType);
+    String strKnown;
+
+    if (known.Output(strKnown)) { message->m_ascPayload.SetString(strKnown); }
+
+    if (false == context.FinalizeServerCommand(*message)) { return output; }
+
+    result = send_message({}, context, *message);
+
+    return output;
+}
+
 CommandResult OT_API::getAccountData(
     ServerContext& context,
     const Identifier& accountID) const
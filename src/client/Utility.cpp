@@ -17,6 +17,9 @@
 #include "opentxs/core/Ledger.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/Message.hpp"
+#include "opentxs/core/NumList.hpp"
+#include "opentxs/core/OTTransaction.hpp"
+#include "opentxs/core/String.hpp"
 
 #include <ostream>
 
@@ -1448,6 +1451,49 @@ bool Utility::getBoxReceiptLowLevel(
     return false;
 }
 
+// called by download_box_receipts
+bool Utility::getBoxReceiptsLowLevel(
+    const std::string& accountID,
+    std::int32_t nBoxType,
+    const NumList& known,
+    bool& bWasSent,
+    bool& bMore)
+{
+    bWasSent = false;
+    bMore = false;
+
+    auto [nRequestNum, transactionNum, result] = api_.OTAPI().getBoxReceipts(
+        context_, Identifier::Factory(accountID), nBoxType, known);
+    const auto& [status, reply] = result;
+    [[maybe_unused]] const auto& notUsed1 = transactionNum;
+    [[maybe_unused]] const auto& notUsed3 = nRequestNum;
+
+    switch (status) {
+        case SendResult::VALID_REPLY: {
+            bWasSent = true;
+            bMore = reply->m_bBool;
+            setLastReplyReceived(String(*reply).Get());
+
+            return reply->m_bSuccess;
+        } break;
+        case SendResult::TIMEOUT: {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Failed to send getBoxReceipts message due to error."
+                  << std::endl;
+            setLastReplyReceived("");
+
+            return false;
+        } break;
+        default: {
+        }
+    }
+
+    otErr << OT_METHOD << __FUNCTION__ << ": Error" << std::endl;
+    setLastReplyReceived("");
+
+    return false;
+}
+
 // called by insureHaveAllBoxReceipts     DONE
 bool Utility::getBoxReceiptWithErrorCorrection(
     const std::string& notaryID,
@@ -1488,6 +1534,72 @@ bool Utility::getBoxReceiptWithErrorCorrection(
     return false;
 }
 
+// Requests the missing receipts from the box with getBoxReceipts until none
+// are missing, the server has no more to send, or a request stops making
+// progress.
+void Utility::download_box_receipts(
+    const Identifier& notaryID,
+    const Identifier& nymID,
+    const Identifier& accountID,
+    const std::int32_t nBoxType,
+    const Ledger& box)
+{
+    std::size_t previous{0};
+
+    for (;;) {
+        NumList known{};
+        std::size_t missing{0};
+
+        for (const auto& [number, transaction] : box.GetTransactionMap()) {
+            if ((0 >= number) || (nullptr == transaction)) { continue; }
+
+            if (should_download_box_receipt(notaryID, nymID, *transaction) &&
+                (false == api_.OTAPI().DoesBoxReceiptExist(
+                              notaryID, nymID, accountID, nBoxType, number))) {
+                ++missing;
+            } else {
+                known.Add(number);
+            }
+        }
+
+        if (0 == missing) { return; }
+
+        if ((0 < previous) && (missing >= previous)) {
+            otWarn << OT_METHOD << __FUNCTION__ << ": " << missing
+                   << " receipts were not delivered in bulk." << std::endl;
+
+            return;
+        }
+
+        previous = missing;
+        bool bWasSent{false};
+        bool bMore{false};
+
+        if (false == getBoxReceiptsLowLevel(
+                         accountID.str(), nBoxType, known, bWasSent, bMore)) {
+            return;
+        }
+
+        if (false == bMore) { return; }
+    }
+}
+
+// A replyNotice only needs to be downloaded if the reply hasn't already been
+// seen.
+bool Utility::should_download_box_receipt(
+    const Identifier& notaryID,
+    const Identifier& nymID,
+    const OTTransaction& receipt) const
+{
+    if (transactionType::replyNotice != receipt.GetType()) { return true; }
+
+    const RequestNumber lRequestNum = receipt.GetRequestNum();
+
+    return (0 < lRequestNum) &&
+           (false ==
+            api_.OTAPI().HaveAlreadySeenReply(notaryID, nymID, lRequestNum));
+}
+
 // This function assumes you just downloaded the latest version of the box
 // (inbox, outbox, or nymbox)
 // and its job is to make sure all the related box receipts are downloaded as
@@ -1563,6 +1675,11 @@ bool Utility::insureHaveAllBoxReceipts(
         return false;
     }
     // ----------------------------------------------------------------
+    // Fetch as many of the missing receipts as possible in bulk. Anything
+    // that doesn't arrive this way is downloaded individually below.
+    download_box_receipts(
+        theNotaryID, theNymID, theAccountID, nBoxType, *pLedger);
+    // ----------------------------------------------------------------
     bool bReturnValue = true;  // Assuming an empty box, we return success;
 
     // At this point, the box is definitely loaded.
@@ -1585,16 +1702,8 @@ bool Utility::insureHaveAllBoxReceipts(
             continue;
         }
 
-        const bool bIsReplyNotice =
-            (transactionType::replyNotice == pTransaction->GetType());
-
-        const RequestNumber lRequestNum =
-            bIsReplyNotice ? pTransaction->GetRequestNum() : 0;
-
         const bool bShouldDownload =
-            (!bIsReplyNotice || (bIsReplyNotice && (0 < lRequestNum) &&
-                                 !api_.OTAPI().HaveAlreadySeenReply(
-                                     theNotaryID, theNymID, lRequestNum)));
+            should_download_box_receipt(theNotaryID, theNymID, *pTransaction);
 
         // This block executes if we should download it (assuming we
         // haven't already, which it also checks for.)
@@ -13,6 +13,10 @@
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/Nym.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
 #define CURRENT_VERSION 1
 
 #define OT_METHOD "ClientContext::"
@@ -205,31 +209,41 @@ bool ClientContext::Verify(
                << "the context. " << std::endl;
     }
 
-    for (const auto& number : statement.Issued()) {
-        const bool found = (1 == effective.count(number));
+    // Both sets are sorted, so they can be compared in a single pass
+    const auto& issued = statement.Issued();
 
-        if (!found) {
-            otOut << OT_METHOD << __FUNCTION__ << ": Issued transaction # "
-                  << number << " from statement not found on context."
-                  << std::endl;
+    if (effective == issued) { return true; }
 
-            return false;
-        }
+    std::vector<TransactionNumber> difference{};
+    std::set_difference(
+        issued.begin(),
+        issued.end(),
+        effective.begin(),
+        effective.end(),
+        std::back_inserter(difference));
+
+    if (false == difference.empty()) {
+        otOut << OT_METHOD << __FUNCTION__ << ": Issued transaction # "
+              << difference.front() << " from statement not found on context."
+              << std::endl;
+
+        return false;
     }
 
-    for (const auto& number : effective) {
-        const bool found = (1 == statement.Issued().count(number));
+    std::set_difference(
+        effective.begin(),
+        effective.end(),
+        issued.begin(),
+        issued.end(),
+        std::back_inserter(difference));
 
-        if (!found) {
-            otOut << OT_METHOD << __FUNCTION__ << ": Issued transaction # "
-                  << number << " from context not found on statement."
-                  << std::endl;
+    OT_ASSERT(false == difference.empty())
 
-            return false;
-        }
-    }
+    otOut << OT_METHOD << __FUNCTION__ << ": Issued transaction # "
+          << difference.front() << " from context not found on statement."
+          << std::endl;
 
-    return true;
+    return false;
 }
 
 bool ClientContext::VerifyCronItem(const TransactionNumber number) const
@@ -20,6 +20,10 @@
 #include "opentxs/core/String.hpp"
 #include "opentxs/network/ServerConnection.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
 #define CURRENT_VERSION 2
 #define DEFAULT_NODE_NAME "Stash Node Pro"
 
@@ -880,17 +884,21 @@ RequestNumber ServerContext::UpdateRequestNumber(bool& sendStatus)
 bool ServerContext::Verify(const TransactionStatement& statement) const
 {
     Lock lock(lock_);
+    const auto& issued = statement.Issued();
+    std::vector<TransactionNumber> missing{};
+    std::set_difference(
+        issued_transaction_numbers_.begin(),
+        issued_transaction_numbers_.end(),
+        issued.begin(),
+        issued.end(),
+        std::back_inserter(missing));
+
+    if (false == missing.empty()) {
+        otOut << OT_METHOD << __FUNCTION__ << ": Issued transaction # "
+              << missing.front() << " on context not found on statement."
+              << std::endl;
 
-    for (const auto& number : issued_transaction_numbers_) {
-        const bool missing = (1 != statement.Issued().count(number));
-
-        if (missing) {
-            otOut << OT_METHOD << __FUNCTION__ << ": Issued transaction # "
-                  << number << " on context not found on statement."
-                  << std::endl;
-
-            return false;
-        }
+        return false;
     }
 
     // Getting here means that, though issued numbers may have been removed from
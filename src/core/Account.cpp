@@ -841,10 +841,7 @@ void Account::UpdateContents()
             "THIS ACCOUNT HAS BEEN MARKED FOR DELETION AT ITS OWN REQUEST");
     }
 
-    std::string str_result;
-    tag.output(str_result);
-
-    m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    tag.output(m_xmlUnsigned);
 }
 
 // return -1 if error, 0 if nothing, and 1 if the node was processed.
@@ -7,6 +7,8 @@
 
 #include "opentxs/core/Contract.hpp"
 
+#include "opentxs/api/crypto/Crypto.hpp"
+#include "opentxs/api/crypto/Hash.hpp"
 #include "opentxs/api/Core.hpp"
 #include "opentxs/api/Wallet.hpp"
 #include "opentxs/core/crypto/OTPasswordData.hpp"
@@ -27,22 +29,195 @@
 #include "opentxs/crypto/library/HashingProvider.hpp"
 #include "opentxs/Proto.hpp"
 
+#include "core/InternalCore.hpp"
+
 #include <irrxml/irrXML.hpp>
 
 #include <array>
 #include <cstdint>
 #include <cstring>
 #include <fstream>
+#include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 using namespace irr;
 using namespace io;
 
 #define OT_METHOD "opentxs::Contract::"
 
+namespace opentxs::internal
+{
+bool next_line(
+    const std::string_view text,
+    std::size_t& position,
+    std::string_view& line)
+{
+    static const std::size_t limit{2047};
+
+    line = {};
+
+    if (position >= text.size()) { return false; }
+
+    const auto start = position;
+
+    while ((position < text.size()) && ((position - start) < limit)) {
+        if ('\n' == text[position]) {
+            line = text.substr(start, position - start);
+            ++position;
+
+            return position < text.size();
+        }
+
+        ++position;
+    }
+
+    line = text.substr(start, position - start);
+
+    return position < text.size();
+}
+}  // namespace opentxs::internal
+
+namespace
+{
+/** key type, hash type, signer key id, content digest, signature */
+using SignatureCacheKey = std::
+    tuple<std::int32_t, std::int32_t, std::string, std::string, std::string>;
+
+/** Remembers which signatures have already been verified successfully, so
+ *  that receipts which are loaded repeatedly are only checked by the crypto
+ *  provider once. Failed verifications are never remembered. When the limit is
+ *  reached the least recently used entry is discarded.
+ */
+class VerifiedSignatures
+{
+public:
+    static const std::size_t LIMIT;
+
+    bool Check(const SignatureCacheKey& key)
+    {
+        opentxs::Lock lock(lock_);
+        const auto it = index_.find(key);
+
+        if (index_.end() == it) {
+            ++stats_.misses_;
+
+            return false;
+        }
+
+        order_.splice(order_.begin(), order_, it->second);
+        ++stats_.hits_;
+
+        return true;
+    }
+
+    void Clear()
+    {
+        opentxs::Lock lock(lock_);
+        order_.clear();
+        index_.clear();
+        stats_ = {};
+    }
+
+    void Insert(const SignatureCacheKey& key)
+    {
+        opentxs::Lock lock(lock_);
+        const auto [it, added] = index_.emplace(key, order_.end());
+
+        if (false == added) {
+            order_.splice(order_.begin(), order_, it->second);
+
+            return;
+        }
+
+        order_.emplace_front(&it->first);
+        it->second = order_.begin();
+        ++stats_.inserts_;
+
+        while (LIMIT < index_.size()) {
+            const auto oldest = index_.find(*order_.back());
+
+            OT_ASSERT(index_.end() != oldest);
+
+            order_.pop_back();
+            index_.erase(oldest);
+            ++stats_.evictions_;
+        }
+    }
+
+    opentxs::Contract::SignatureCacheStatistics Statistics() const
+    {
+        opentxs::Lock lock(lock_);
+        auto output = stats_;
+        output.size_ = index_.size();
+        output.limit_ = LIMIT;
+
+        return output;
+    }
+
+private:
+    using Order = std::list<const SignatureCacheKey*>;
+
+    mutable std::mutex lock_{};
+    // Most recently used entries are at the front
+    Order order_{};
+    std::map<SignatureCacheKey, Order::iterator> index_{};
+    opentxs::Contract::SignatureCacheStatistics stats_{};
+};
+
+const std::size_t VerifiedSignatures::LIMIT{16384};
+
+VerifiedSignatures& verified_signatures()
+{
+    static VerifiedSignatures cache{};
+
+    return cache;
+}
+
+/** Returns false if the signer key can not be identified, in which case the
+ *  verification result must not be cached. */
+bool signature_cache_key(
+    const opentxs::api::Core& api,
+    const opentxs::crypto::key::Asymmetric& key,
+    const opentxs::OTSignature& signature,
+    const opentxs::proto::HashType hashType,
+    const opentxs::String& contents,
+    SignatureCacheKey& output)
+{
+    // The key computes its id once and caches it, so the public key is not
+    // exported again for every signature it verifies
+    if (false == key.IsPublic()) { return false; }
+
+    const auto& hash = api.Crypto().Hash();
+    auto keyID = opentxs::Identifier::Factory();
+
+    if (false == key.CalculateID(keyID)) { return false; }
+
+    auto contentDigest = opentxs::Data::Factory();
+    const auto type = opentxs::proto::HASHTYPE_BLAKE2B256;
+
+    if (false == hash.Digest(type, contents, contentDigest.get())) {
+        return false;
+    }
+
+    output = SignatureCacheKey{
+        static_cast<std::int32_t>(key.keyType()),
+        static_cast<std::int32_t>(hashType),
+        std::string(static_cast<const char*>(keyID->data()), keyID->size()),
+        std::string(
+            static_cast<const char*>(contentDigest->data()),
+            contentDigest->size()),
+        std::string(signature.Get(), signature.GetLength())};
+
+    return true;
+}
+}  // namespace
+
 namespace opentxs
 {
 OTString trim(const String& str)
@@ -755,9 +930,15 @@ bool Contract::VerifySignature(
 
     OTPasswordData thePWData("Contract::VerifySignature 2");
     const auto& engine = theKey.engine();
+    const auto contents = trim(m_xmlUnsigned);
+    SignatureCacheKey cacheKey{};
+    const bool cacheable = signature_cache_key(
+        api_, theKey, theSignature, hashType, contents, cacheKey);
+
+    if (cacheable && verified_signatures().Check(cacheKey)) { return true; }
 
     if (false == engine.VerifyContractSignature(
-                     trim(m_xmlUnsigned),
+                     contents,
                      theKey,
                      theSignature,
                      hashType,
@@ -769,9 +950,149 @@ bool Contract::VerifySignature(
         return false;
     }
 
+    if (cacheable) { verified_signatures().Insert(cacheKey); }
+
     return true;
 }
 
+bool Contract::VerifySignatures(
+    const std::vector<const Contract*>& contracts,
+    const Nym& theNym,
+    const OTPasswordData* pPWData)
+{
+    using Batch = crypto::AsymmetricProvider::SignatureBatch;
+
+    OTPasswordData thePWData("Contract::VerifySignatures");
+    const auto* password = (nullptr != pPWData) ? pPWData : &thePWData;
+    auto strNymID = String::Factory(theNym.ID());
+    char cNymID = '0';
+    std::uint32_t uIndex = 3;
+    const bool bNymID = strNymID->At(uIndex, cNymID);
+    // Each batch also holds the cache keys of its members, which are
+    // remembered if the whole batch verifies
+    std::map<
+        const crypto::AsymmetricProvider*,
+        std::tuple<
+            Batch,
+            std::vector<const Contract*>,
+            std::vector<SignatureCacheKey>>>
+        batches{};
+    std::vector<const Contract*> individual{};
+    // The batches hold references to these, so they must not reallocate
+    std::vector<OTData> plaintexts{};
+    std::vector<OTData> signatures{};
+    plaintexts.reserve(contracts.size());
+    signatures.reserve(contracts.size());
+
+    for (const auto* contract : contracts) {
+        OT_ASSERT(nullptr != contract);
+
+        // Only the first signature which might belong to this nym, and the
+        // first key which might have produced it, go into the batch. Other
+        // combinations are tried by the individual verification below.
+        const OTSignature* pSig{nullptr};
+
+        for (const auto* it : contract->m_listSignatures) {
+            OT_ASSERT(nullptr != it);
+
+            if (bNymID && it->getMetaData().HasMetadata() &&
+                (it->getMetaData().FirstCharNymID() != cNymID)) {
+                continue;
+            }
+
+            pSig = it;
+            break;
+        }
+
+        if (nullptr == pSig) {
+            individual.emplace_back(contract);
+
+            continue;
+        }
+
+        crypto::key::Keypair::Keys candidates{};
+
+        if (0 >= theNym.GetPublicKeysBySignature(candidates, *pSig, 'S')) {
+            candidates.emplace_back(&theNym.GetPublicSignKey());
+        }
+
+        const crypto::key::Asymmetric* pKey{nullptr};
+
+        for (const auto* key : candidates) {
+            OT_ASSERT(nullptr != key);
+
+            const auto* metadata = key->GetMetadata();
+
+            if ((nullptr != metadata) && metadata->HasMetadata() &&
+                pSig->getMetaData().HasMetadata() &&
+                (pSig->getMetaData() != *metadata)) {
+                continue;
+            }
+
+            pKey = key;
+            break;
+        }
+
+        if (nullptr == pKey) {
+            individual.emplace_back(contract);
+
+            continue;
+        }
+
+        const auto contents = trim(contract->m_xmlUnsigned);
+        SignatureCacheKey cacheKey{};
+        const bool cacheable = signature_cache_key(
+            contract->api_,
+            *pKey,
+            *pSig,
+            contract->m_strSigHashType,
+            contents,
+            cacheKey);
+
+        if (cacheable && verified_signatures().Check(cacheKey)) { continue; }
+
+        auto& plaintext = plaintexts.emplace_back(Data::Factory(
+            contents->Get(),
+            contents->GetLength() + 1));  // include null terminator
+        auto& signature = signatures.emplace_back(Data::Factory());
+        pSig->GetData(signature);
+        auto& [batch, members, keys] = batches[&pKey->engine()];
+        batch.emplace_back(
+            plaintext.get(),
+            *pKey,
+            signature.get(),
+            contract->m_strSigHashType);
+        members.emplace_back(contract);
+
+        if (cacheable) { keys.emplace_back(std::move(cacheKey)); }
+    }
+
+    for (const auto& [engine, group] : batches) {
+        const auto& [batch, members, keys] = group;
+
+        if (engine->VerifyBatch(batch, password)) {
+            for (const auto& key : keys) { verified_signatures().Insert(key); }
+        } else {
+            individual.insert(individual.end(), members.begin(), members.end());
+        }
+    }
+
+    for (const auto* contract : individual) {
+        if (false == contract->VerifySignature(theNym, password)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void Contract::ClearSignatureCache() { verified_signatures().Clear(); }
+
+Contract::SignatureCacheStatistics Contract::SignatureCache()
+{
+    return verified_signatures().Statistics();
+}
+
 void Contract::ReleaseSignatures()
 {
 
@@ -948,13 +1269,25 @@ bool Contract::AddBookendsAroundContent(
 {
     auto strTemp = String::Factory();
     auto strHashType = crypto::HashingProvider::HashTypeToString(hashType);
+    // Bookends and signature headers are well under 256 bytes each
+    std::uint64_t size = 256 + strContents.GetLength();
+
+    for (const auto& it : listSignatures) {
+        OT_ASSERT(nullptr != it);
+
+        size += 256 + it->GetLength();
+    }
+
+    if (size < (MAX_STRING_LENGTH - 10)) {
+        strTemp->Reserve(static_cast<std::uint32_t>(size));
+    }
 
     strTemp->Concatenate(
         "-----BEGIN SIGNED %s-----\nHash: %s\n\n",
         strContractType.Get(),
         strHashType->Get());
 
-    strTemp->Concatenate("%s", strContents.Get());
+    strTemp->Concatenate(strContents);
 
     for (const auto& it : listSignatures) {
         OTSignature* pSig = it;
@@ -976,9 +1309,7 @@ bool Contract::AddBookendsAroundContent(
                 pSig->getMetaData().FirstCharMasterCredID(),
                 pSig->getMetaData().FirstCharChildCredID());
 
-        strTemp->Concatenate(
-            "%s",
-            pSig->Get());  // <=== *** THE SIGNATURE ITSELF ***
+        strTemp->Concatenate(*pSig);  // <=== *** THE SIGNATURE ITSELF ***
         strTemp->Concatenate(
             "\n-----END %s SIGNATURE-----\n\n", strContractType.Get());
     }
@@ -1154,21 +1485,22 @@ bool Contract::LoadContractFromString(const String& theStr)
         return false;
     }
 
-    auto strContract = String::Factory(theStr.Get());
+    // Decode in place rather than through a temporary copy of the input
+    m_strRawFile->Set(theStr);
 
-    if (false == strContract->DecodeIfArmored())  // bEscapedIsAllowed=true by
-                                                  // default.
+    if (false == m_strRawFile->DecodeIfArmored())  // bEscapedIsAllowed=true
+                                                   // by default.
     {
         otErr << __FUNCTION__
               << ": ERROR: Input string apparently was encoded "
                  "and then failed decoding. "
                  "Contents: \n"
               << theStr << "\n";
+        m_strRawFile->Release();
+
         return false;
     }
 
-    m_strRawFile->Set(strContract);
-
     // This populates m_xmlUnsigned with the contents of m_strRawFile (minus
     // bookends, signatures, etc. JUST the XML.)
     bool bSuccess =
@@ -1195,10 +1527,10 @@ bool Contract::LoadContractFromString(const String& theStr)
 
 bool Contract::ParseRawFile()
 {
-    char buffer1[2100];  // a bit bigger than 2048, just for safety reasons.
     OTSignature* pSig = nullptr;
-
-    std::string line;
+    const std::string_view newline{"\n"};
+    std::string_view line{};
+    std::string_view skipped{};
 
     bool bSignatureMode = false;           // "currently in signature mode"
     bool bContentMode = false;             // "currently in content mode"
@@ -1212,26 +1544,32 @@ bool Contract::ParseRawFile()
     }
 
     // This is redundant (I thought) but the problem hasn't cleared up yet.. so
-    // trying to really nail it now.
-    std::string str_Trim(m_strRawFile->Get());
-    std::string str_Trim2 = String::trim(str_Trim);
-    m_strRawFile->Set(str_Trim2.c_str());
+    // trying to really nail it now. Only copy if there is something to trim.
+    {
+        const std::string_view whitespace{" \t\f\v\n\r"};
+        const std::string_view raw(
+            m_strRawFile->Get(), m_strRawFile->GetLength());
+        const auto first = raw.find_first_not_of(whitespace);
+        const auto last = raw.find_last_not_of(whitespace);
+
+        if ((std::string_view::npos != first) &&
+            ((0 != first) || ((last + 1) != raw.size()))) {
+            const std::string trimmed{raw.substr(first, last + 1 - first)};
+            m_strRawFile->Set(trimmed.c_str());
+        }
+    }
 
+    // Every line below is a view into this buffer, which is not modified
+    // until parsing is finished
+    const std::string_view raw(m_strRawFile->Get(), m_strRawFile->GetLength());
+    std::size_t position{0};
     bool bIsEOF = false;
-    m_strRawFile->reset();
+    m_xmlUnsigned.Reserve(m_xmlUnsigned.GetLength() + raw.size());
 
     do {
-        // Just a fresh start at the top of the loop block... probably
-        // unnecessary.
-        memset(buffer1, 0, 2100);  // todo remove this in optimization. (might
-                                   // be removed already...)
-
         // the call returns true if there's more to read, and false if there
         // isn't.
-        bIsEOF = !(m_strRawFile->sgets(buffer1, 2048));
-
-        line = buffer1;
-        const char* pBuf = line.c_str();
+        bIsEOF = !internal::next_line(raw, position, line);
 
         if (line.length() < 2) {
             if (bSignatureMode) continue;
@@ -1321,7 +1659,8 @@ bool Contract::ParseRawFile()
                     if (line.length() < 2) {
                         otLog3 << "Skipping short line...\n";
 
-                        if (bIsEOF || !m_strRawFile->sgets(buffer1, 2048)) {
+                        if (bIsEOF ||
+                            !internal::next_line(raw, position, skipped)) {
                             otOut << "Error in signature for contract "
                                   << m_strFilename
                                   << ": Unexpected EOF after short line.\n";
@@ -1332,7 +1671,8 @@ bool Contract::ParseRawFile()
                     } else if (line.compare(0, 8, "Version:") == 0) {
                         otLog3 << "Skipping version section...\n";
 
-                        if (bIsEOF || !m_strRawFile->sgets(buffer1, 2048)) {
+                        if (bIsEOF ||
+                            !internal::next_line(raw, position, skipped)) {
                             otOut << "Error in signature for contract "
                                   << m_strFilename
                                   << ": Unexpected EOF after \"Version:\"\n";
@@ -1343,7 +1683,8 @@ bool Contract::ParseRawFile()
                     } else if (line.compare(0, 8, "Comment:") == 0) {
                         otLog3 << "Skipping comment section...\n";
 
-                        if (bIsEOF || !m_strRawFile->sgets(buffer1, 2048)) {
+                        if (bIsEOF ||
+                            !internal::next_line(raw, position, skipped)) {
                             otOut << "Error in signature for contract "
                                   << m_strFilename
                                   << ": Unexpected EOF after \"Comment:\"\n";
@@ -1385,7 +1726,8 @@ bool Contract::ParseRawFile()
                             return false;
                         }
 
-                        if (bIsEOF || !m_strRawFile->sgets(buffer1, 2048)) {
+                        if (bIsEOF ||
+                            !internal::next_line(raw, position, skipped)) {
                             otOut << "Error in signature for contract "
                                   << m_strFilename
                                   << ": Unexpected EOF after \"Meta:\"\n";
@@ -1400,7 +1742,7 @@ bool Contract::ParseRawFile()
                         otLog3 << "Collecting message digest algorithm from "
                                   "contract header...\n";
 
-                        std::string strTemp = line.substr(6);
+                        const std::string strTemp{line.substr(6)};
                         auto strHashType = String::Factory(strTemp.c_str());
                         strHashType->ConvertToUpperCase();
 
@@ -1408,7 +1750,8 @@ bool Contract::ParseRawFile()
                             crypto::HashingProvider::StringToHashType(
                                 strHashType);
 
-                        if (bIsEOF || !m_strRawFile->sgets(buffer1, 2048)) {
+                        if (bIsEOF ||
+                            !internal::next_line(raw, position, skipped)) {
                             otOut << "Error in contract " << m_strFilename
                                   << ": Unexpected EOF after \"Hash:\"\n";
                             return false;
@@ -1427,9 +1770,12 @@ bool Contract::ParseRawFile()
                 "processing signature, in "
                 "Contract::ParseRawFile");
 
-            pSig->Concatenate("%s\n", pBuf);
-        } else if (bContentMode)
-            m_xmlUnsigned.Concatenate("%s\n", pBuf);
+            pSig->Concatenate(line);
+            pSig->Concatenate(newline);
+        } else if (bContentMode) {
+            m_xmlUnsigned.Concatenate(line);
+            m_xmlUnsigned.Concatenate(newline);
+        }
     } while (!bIsEOF);
 
     if (!bHaveEnteredContentMode) {
@@ -1745,19 +2091,23 @@ bool Contract::LoadEncodedTextField(IrrXMLReader*& xml, Armored& ascOutput)
     if (EXN_TEXT == xml->getNodeType())  // SHOULD always be true, in fact this
                                          // could be an assert().
     {
-        auto strNodeData = String::Factory(xml->getNodeData());
+        // Read the node data in place rather than copying it into a
+        // temporary String first
+        const char* nodeData = xml->getNodeData();
+        const auto length =
+            (nullptr == nodeData)
+                ? 0
+                : String::safe_strlen(nodeData, MAX_STRING_LENGTH - 1);
 
         // Sometimes the XML reads up the data with a prepended newline.
         // This screws up my own objects which expect a consistent in/out
         // So I'm checking here for that prepended newline, and removing it.
         //
-        char cNewline;
-        if (strNodeData->Exists() && strNodeData->GetLength() > 2 &&
-            strNodeData->At(0, cNewline)) {
-            if ('\n' == cNewline) {
-                ascOutput.Set(strNodeData->Get() + 1);
+        if (length > 2) {
+            if ('\n' == nodeData[0]) {
+                ascOutput.Set(nodeData + 1);
             } else {
-                ascOutput.Set(strNodeData->Get());
+                ascOutput.Set(nodeData);
             }
 
             // SkipAfterLoadingField() only skips ahead if it's not ALREADY
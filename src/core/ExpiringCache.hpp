@@ -0,0 +1,167 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Internal.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <list>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <utility>
+
+namespace opentxs
+{
+/** Bounded least recently used cache whose entries expire a fixed time after
+ *  they are inserted, however often they are read.
+ *
+ *  Expired entries are never returned. Owners holding secrets should also
+ *  call Purge periodically so that entries nobody asks for again are dropped
+ *  on time instead of waiting for the next lookup. */
+template <typename Key, typename Value>
+class ExpiringCache
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    void Clear()
+    {
+        Lock lock(lock_);
+        index_.clear();
+        order_.clear();
+    }
+
+    /** Copies the value for key into output and marks the entry as most
+     *  recently used */
+    bool Find(
+        const Key& key,
+        Value& output,
+        const Clock::time_point now = Clock::now())
+    {
+        Lock lock(lock_);
+        const auto it = index_.find(key);
+
+        if (index_.end() == it) { return false; }
+
+        auto& [expires, value, position] = it->second;
+
+        if (expires <= now) {
+            order_.erase(position);
+            index_.erase(it);
+
+            return false;
+        }
+
+        order_.splice(order_.begin(), order_, position);
+        output = value;
+
+        return true;
+    }
+
+    /** Adds or replaces the value for key, evicting the least recently used
+     *  entry if the cache is full */
+    void Insert(
+        const Key& key,
+        Value&& value,
+        const Clock::time_point now = Clock::now())
+    {
+        Lock lock(lock_);
+        const auto it = index_.find(key);
+
+        if (index_.end() != it) {
+            order_.erase(std::get<2>(it->second));
+            index_.erase(it);
+        }
+
+        while ((false == order_.empty()) && (limit_ <= order_.size())) {
+            index_.erase(order_.back());
+            order_.pop_back();
+        }
+
+        if (0 == limit_) { return; }
+
+        order_.emplace_front(key);
+        index_.emplace(
+            key,
+            Entry{now + timeout_, std::move(value), order_.begin()});
+    }
+
+    /** Changes the value for key in place without refreshing its expiration
+     *  time or its position */
+    template <typename Function>
+    bool Modify(const Key& key, Function modify)
+    {
+        Lock lock(lock_);
+        const auto it = index_.find(key);
+
+        if (index_.end() == it) { return false; }
+
+        modify(std::get<1>(it->second));
+
+        return true;
+    }
+
+    /** Removes every expired entry and returns the number removed */
+    std::size_t Purge(const Clock::time_point now = Clock::now())
+    {
+        Lock lock(lock_);
+        std::size_t output{0};
+
+        for (auto it = index_.begin(); it != index_.end();) {
+            const auto& entry = it->second;
+
+            if (std::get<0>(entry) <= now) {
+                order_.erase(std::get<2>(entry));
+                it = index_.erase(it);
+                ++output;
+            } else {
+                ++it;
+            }
+        }
+
+        return output;
+    }
+
+    std::size_t Size() const
+    {
+        Lock lock(lock_);
+
+        return index_.size();
+    }
+
+    ExpiringCache(const std::size_t limit, const std::chrono::seconds timeout)
+        : limit_(limit)
+        , timeout_(timeout)
+        , lock_()
+        , order_()
+        , index_()
+    {
+    }
+
+    ~ExpiringCache() = default;
+
+private:
+    /** Most recently used first */
+    using Order = std::list<Key>;
+    /** expiration time, value, position in order_ */
+    using Entry =
+        std::tuple<Clock::time_point, Value, typename Order::iterator>;
+
+    const std::size_t limit_;
+    const std::chrono::seconds timeout_;
+    mutable std::mutex lock_;
+    Order order_;
+    std::map<Key, Entry> index_;
+
+    ExpiringCache() = delete;
+    ExpiringCache(const ExpiringCache&) = delete;
+    ExpiringCache(ExpiringCache&&) = delete;
+    ExpiringCache& operator=(const ExpiringCache&) = delete;
+    ExpiringCache& operator=(ExpiringCache&&) = delete;
+};
+}  // namespace opentxs
@@ -9,8 +9,21 @@
 
 #include "opentxs/core/NymFile.hpp"
 
+#include <cstddef>
+#include <string_view>
+
 namespace opentxs::internal
 {
+/** Returns the next line of text exactly as String::sgets would with a 2048
+ *  byte buffer, including splitting lines longer than 2047 characters, so
+ *  that parsed contents and signatures are byte for byte what they were. The
+ *  return value is false once the end of the text has been reached.
+ */
+bool next_line(
+    const std::string_view text,
+    std::size_t& position,
+    std::string_view& line);
+
 struct NymFile : virtual public opentxs::NymFile {
     virtual bool LoadSignedNymFile() = 0;
     virtual bool SaveSignedNymFile() = 0;
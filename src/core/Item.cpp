@@ -1913,10 +1913,7 @@ void Item::UpdateContents()  // Before transmission or serialization, this is
         }
     }
 
-    std::string str_result;
-    tag.output(str_result);
-
-    m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    tag.output(m_xmlUnsigned);
 }
 
 Item::~Item() { Release_Item(); }
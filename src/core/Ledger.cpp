@@ -1766,10 +1766,7 @@ void Ledger::UpdateContents()  // Before transmission or serialization, this is
         }
     }
 
-    std::string str_result;
-    tag.output(str_result);
-
-    m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    tag.output(m_xmlUnsigned);
 }
 
 // LoadContract will call this function at the right time.
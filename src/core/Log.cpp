@@ -134,8 +134,19 @@ OTLogStream::~OTLogStream()
     pBuffer = nullptr;
 }
 
+bool OTLogStream::Enabled() const
+{
+    if (0 > logLevel) { return true; }
+
+    const auto verbosity = LogSource::Verbosity();
+
+    return (-1 != verbosity) && (logLevel <= verbosity);
+}
+
 int OTLogStream::overflow(int c)
 {
+    if (false == Enabled()) { return 0; }
+
     rLock lock(lock_);
 
     pBuffer[next++] = c;
@@ -153,6 +164,17 @@ int OTLogStream::overflow(int c)
     return 0;
 }
 
+std::streamsize OTLogStream::xsputn(const char* s, std::streamsize n)
+{
+    if (false == Enabled()) { return n; }
+
+    rLock lock(lock_);
+
+    for (std::streamsize i = 0; i < n; ++i) { overflow(s[i]); }
+
+    return n;
+}
+
 Log::Log(const api::Settings& config)
     : config_(config)
     , m_strLogFileName(String::Factory())
@@ -10,6 +10,7 @@
 #include "opentxs/api/Native.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/String.hpp"
+#include "opentxs/core/util/Assert.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/network/zeromq/PushSocket.hpp"
@@ -23,6 +24,7 @@ namespace opentxs
 {
 std::atomic<int> LogSource::verbosity_{0};
 std::atomic<bool> LogSource::running_{true};
+std::atomic<std::uint64_t> LogSource::generation_{0};
 std::mutex LogSource::buffer_lock_{};
 std::map<std::thread::id, LogSource::Source> LogSource::buffer_{};
 
@@ -33,11 +35,12 @@ LogSource::LogSource(const int logLevel)
 
 const LogSource& LogSource::operator()(const char* in) const
 {
-    if (verbosity_.load() < level_) { return *this; }
+    if (false == Enabled()) { return *this; }
 
-    std::string id{};
+    const std::string* id{nullptr};
+    auto* source = get_buffer(id);
 
-    if (running_.load()) { std::get<1>(get_buffer(id)) << in; }
+    if (nullptr != source) { std::get<1>(*source) << in; }
 
     return *this;
 }
@@ -54,6 +57,8 @@ const LogSource& LogSource::operator()(const OTString& in) const
 
 const LogSource& LogSource::operator()(const String& in) const
 {
+    if (false == Enabled()) { return *this; }
+
     return operator()(in.Get());
 }
 
@@ -64,53 +69,88 @@ const LogSource& LogSource::operator()(const OTIdentifier& in) const
 
 const LogSource& LogSource::operator()(const Identifier& in) const
 {
+    if (false == Enabled()) { return *this; }
+
     return operator()(in.str().c_str());
 }
 
 void LogSource::Flush() const
 {
-    if (running_.load()) {
-        std::string id{};
-        auto& [socket, buffer] = get_buffer(id);
+    if (false == Enabled()) { return; }
+
+    const std::string* id{nullptr};
+    auto* source = get_buffer(id);
+
+    if (nullptr != source) {
+        auto& [socket, buffer] = *source;
+
+        OT_ASSERT(nullptr != id);
+
         auto message = zmq::Message::Factory();
         message->AddFrame();
         message->AddFrame(std::to_string(level_));
         message->AddFrame(buffer.str());
-        message->AddFrame(id);
+        message->AddFrame(*id);
         socket->Push(message);
-        buffer = std::stringstream{};
+        buffer.str({});
+        buffer.clear();
     }
 }
 
-LogSource::Source& LogSource::get_buffer(std::string& out)
+// Each thread looks up its buffer and formats its id once per generation of
+// buffer_. After that the buffer is reached through thread local storage
+// without locking, and the assembled messages are handed off to the single log
+// sink thread. Returns nullptr once logging has shut down.
+LogSource::Source* LogSource::get_buffer(const std::string*& out)
 {
-    const auto id = std::this_thread::get_id();
-    std::stringstream convert{};
-    convert << id;
-    out = convert.str();
-    auto it = buffer_.find(id);
-
-    if (buffer_.end() == it) {
+    thread_local Source* source{nullptr};
+    thread_local std::uint64_t generation{0};
+    thread_local std::string threadID{};
+
+    if (false == running_.load()) { return nullptr; }
+
+    if ((nullptr == source) || (generation_.load() != generation)) {
+        source = nullptr;
+        const auto id = std::this_thread::get_id();
+        std::stringstream convert{};
+        convert << id;
+        threadID = convert.str();
         Lock lock(buffer_lock_);
-        auto it = buffer_.emplace(
-            id,
-            Source{OT::App().ZMQ().PushSocket(zmq::Socket::Direction::Connect),
-                   std::stringstream{}});
-        auto& source = std::get<0>(it)->second;
-        auto& socket = std::get<0>(source).get();
-        socket.Start(LOG_SINK);
-
-        return source;
+
+        if (false == running_.load()) { return nullptr; }
+
+        generation = generation_.load();
+        auto it = buffer_.find(id);
+
+        if (buffer_.end() == it) {
+            it = buffer_
+                     .emplace(
+                         id,
+                         Source{OT::App().ZMQ().PushSocket(
+                                    zmq::Socket::Direction::Connect),
+                                std::stringstream{}})
+                     .first;
+            auto& socket = std::get<0>(it->second).get();
+            socket.Start(LOG_SINK);
+        }
+
+        source = &it->second;
     }
 
-    return it->second;
+    OT_ASSERT(nullptr != source);
+
+    out = &threadID;
+
+    return source;
 }
 
 void LogSource::SetVerbosity(const int level) { verbosity_.store(level); }
 
 void LogSource::Shutdown()
 {
+    Lock lock(buffer_lock_);
     running_.store(false);
+    ++generation_;
     buffer_.clear();
 }
 
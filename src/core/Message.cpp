@@ -37,6 +37,10 @@
 #include <string>
 #include <utility>
 
+// Messages from this version on announce that their sender parses NumList
+// fields containing runs written as "first-last"
+#define MESSAGE_NUMBER_RANGES_VERSION 3
+
 #define ERROR_STRING "error"
 #define PING_NOTARY "pingNotary"
 #define PING_NOTARY_RESPONSE "pingNotaryResponse"
@@ -68,6 +72,8 @@
 #define GET_NYMBOX_RESPONSE "getNymboxResponse"
 #define GET_BOX_RECEIPT "getBoxReceipt"
 #define GET_BOX_RECEIPT_RESPONSE "getBoxReceiptResponse"
+#define GET_BOX_RECEIPTS "getBoxReceipts"
+#define GET_BOX_RECEIPTS_RESPONSE "getBoxReceiptsResponse"
 #define GET_ACCOUNT_DATA "getAccountData"
 #define GET_ACCOUNT_DATA_RESPONSE "getAccountDataResponse"
 #define PROCESS_NYMBOX "processNymbox"
@@ -149,6 +155,8 @@ const Message::TypeMap Message::message_names_{
     {MessageType::getNymboxResponse, GET_NYMBOX_RESPONSE},
     {MessageType::getBoxReceipt, GET_BOX_RECEIPT},
     {MessageType::getBoxReceiptResponse, GET_BOX_RECEIPT_RESPONSE},
+    {MessageType::getBoxReceipts, GET_BOX_RECEIPTS},
+    {MessageType::getBoxReceiptsResponse, GET_BOX_RECEIPTS_RESPONSE},
     {MessageType::getAccountData, GET_ACCOUNT_DATA},
     {MessageType::getAccountDataResponse, GET_ACCOUNT_DATA_RESPONSE},
     {MessageType::processNymbox, PROCESS_NYMBOX},
@@ -202,6 +210,7 @@ const std::map<MessageType, MessageType> Message::reply_message_{
      MessageType::notarizeTransactionResponse},
     {MessageType::getNymbox, MessageType::getNymboxResponse},
     {MessageType::getBoxReceipt, MessageType::getBoxReceiptResponse},
+    {MessageType::getBoxReceipts, MessageType::getBoxReceiptsResponse},
     {MessageType::getAccountData, MessageType::getAccountDataResponse},
     {MessageType::processNymbox, MessageType::processNymboxResponse},
     {MessageType::processInbox, MessageType::processInboxResponse},
@@ -235,6 +244,7 @@ Message::Message(const api::Core& core)
     , m_lTime(0)
 {
     Contract::m_strContractType->Set("MESSAGE");
+    m_strVersion->Set("3.0");
 }
 
 Message::ReverseTypeMap Message::make_reverse_map()
@@ -392,6 +402,11 @@ bool Message::HarvestTransactionNumbers(
     return true;
 }
 
+bool Message::SupportsNumberRanges() const
+{
+    return MESSAGE_NUMBER_RANGES_VERSION <= m_strVersion->ToLong();
+}
+
 // So the message can get the list of numbers from the Nym, before sending,
 // that should be listed as acknowledged that the server reply has already been
 // seen for those request numbers.
@@ -459,10 +474,7 @@ void Message::UpdateContents()
         }
     }
 
-    std::string str_result;
-    tag.output(str_result);
-
-    m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    tag.output(m_xmlUnsigned);
 }
 
 bool Message::updateContentsByType(Tag& parent)
@@ -2791,6 +2803,175 @@ RegisterStrategy StrategyGetBoxReceiptResponse::reg(
     "getBoxReceiptResponse",
     new StrategyGetBoxReceiptResponse());
 
+class StrategyGetBoxReceipts : public OTMessageStrategy
+{
+public:
+    virtual void writeXml(Message& m, Tag& parent)
+    {
+        TagPtr pTag(new Tag(m.m_strCommand.Get()));
+
+        pTag->add_attribute("requestNum", m.m_strRequestNum.Get());
+        pTag->add_attribute("nymID", m.m_strNymID.Get());
+        pTag->add_attribute("notaryID", m.m_strNotaryID.Get());
+        // If retrieving box receipts for Nymbox, NymID
+        // will appear in this variable.
+        pTag->add_attribute("accountID", m.m_strAcctID.Get());
+        pTag->add_attribute(
+            "boxType",  // outbox is 2.
+            (m.m_lDepth == 0) ? "nymbox"
+                              : ((m.m_lDepth == 1) ? "inbox" : "outbox"));
+        pTag->add_attribute("hasKnown", formatBool(m.m_ascPayload.Exists()));
+
+        // List of the transaction numbers of the receipts the client already
+        // has
+        if (m.m_ascPayload.Exists()) {
+            pTag->add_tag("knownReceipts", m.m_ascPayload.Get());
+        }
+
+        parent.add_tag(pTag);
+    }
+
+    std::int32_t processXml(Message& m, irr::io::IrrXMLReader*& xml)
+    {
+        m.m_strCommand = xml->getNodeName();  // Command
+        m.m_strNymID = xml->getAttributeValue("nymID");
+        m.m_strNotaryID = xml->getAttributeValue("notaryID");
+        m.m_strAcctID = xml->getAttributeValue("accountID");
+        m.m_strRequestNum = xml->getAttributeValue("requestNum");
+        const String strHasKnown = xml->getAttributeValue("hasKnown");
+        const String strBoxType = xml->getAttributeValue("boxType");
+
+        if (strBoxType.Compare("nymbox"))
+            m.m_lDepth = 0;
+        else if (strBoxType.Compare("inbox"))
+            m.m_lDepth = 1;
+        else if (strBoxType.Compare("outbox"))
+            m.m_lDepth = 2;
+        else {
+            m.m_lDepth = 0;
+            otErr << "Error in OTMessage::ProcessXMLNode:\n"
+                     "Expected boxType to be inbox, outbox, or nymbox, in "
+                     "getBoxReceipts\n";
+            return (-1);
+        }
+
+        if (strHasKnown.Compare("true")) {
+            const char* pElementExpected = "knownReceipts";
+            Armored& ascTextExpected = m.m_ascPayload;
+
+            if (!Contract::LoadEncodedTextFieldByName(
+                    xml, ascTextExpected, pElementExpected)) {
+                otErr << "Error in OTMessage::ProcessXMLNode: "
+                         "Expected "
+                      << pElementExpected << " element with text field, for "
+                      << m.m_strCommand << ".\n";
+                return (-1);  // error condition
+            }
+        }
+
+        otWarn << "\n Command: " << m.m_strCommand
+               << " \n NymID:    " << m.m_strNymID
+               << "\n AccountID:    " << m.m_strAcctID
+               << "\n NotaryID: " << m.m_strNotaryID
+               << "\n Request#: " << m.m_strRequestNum << "   boxType: "
+               << ((m.m_lDepth == 0) ? "nymbox"
+                                     : (m.m_lDepth == 1) ? "inbox" : "outbox")
+               << "\n\n";
+
+        return 1;
+    }
+    static RegisterStrategy reg;
+};
+RegisterStrategy StrategyGetBoxReceipts::reg(
+    "getBoxReceipts",
+    new StrategyGetBoxReceipts());
+
+class StrategyGetBoxReceiptsResponse : public OTMessageStrategy
+{
+public:
+    virtual void writeXml(Message& m, Tag& parent)
+    {
+        TagPtr pTag(new Tag(m.m_strCommand.Get()));
+
+        pTag->add_attribute("success", formatBool(m.m_bSuccess));
+        pTag->add_attribute("requestNum", m.m_strRequestNum.Get());
+        pTag->add_attribute("nymID", m.m_strNymID.Get());
+        pTag->add_attribute("notaryID", m.m_strNotaryID.Get());
+        pTag->add_attribute("nymboxHash", m.m_strNymboxHash.Get());
+        pTag->add_attribute("accountID", m.m_strAcctID.Get());
+        pTag->add_attribute(
+            "boxType",  // outbox is 2.
+            (m.m_lDepth == 0) ? "nymbox"
+                              : ((m.m_lDepth == 1) ? "inbox" : "outbox"));
+        // True if the server stopped before sending every missing receipt
+        pTag->add_attribute("more", formatBool(m.m_bBool));
+        pTag->add_attribute(
+            "hasReceipts", formatBool(m.m_ascPayload.Exists()));
+
+        if (m.m_bSuccess && m.m_ascPayload.Exists()) {
+            pTag->add_tag("boxReceipts", m.m_ascPayload.Get());
+        }
+
+        parent.add_tag(pTag);
+    }
+
+    std::int32_t processXml(Message& m, irr::io::IrrXMLReader*& xml)
+    {
+        processXmlSuccess(m, xml);
+
+        m.m_strCommand = xml->getNodeName();  // Command
+        m.m_strRequestNum = xml->getAttributeValue("requestNum");
+        m.m_strNymID = xml->getAttributeValue("nymID");
+        m.m_strNotaryID = xml->getAttributeValue("notaryID");
+        m.m_strNymboxHash = xml->getAttributeValue("nymboxHash");
+        m.m_strAcctID = xml->getAttributeValue("accountID");
+        m.m_bBool = String(xml->getAttributeValue("more")).Compare("true");
+        const String strHasReceipts = xml->getAttributeValue("hasReceipts");
+        const String strBoxType = xml->getAttributeValue("boxType");
+
+        if (strBoxType.Compare("nymbox"))
+            m.m_lDepth = 0;
+        else if (strBoxType.Compare("inbox"))
+            m.m_lDepth = 1;
+        else if (strBoxType.Compare("outbox"))
+            m.m_lDepth = 2;
+        else {
+            m.m_lDepth = 0;
+            otErr << "Error in OTMessage::ProcessXMLNode:\n"
+                     "Expected boxType to be inbox, outbox, or nymbox, in "
+                     "getBoxReceiptsResponse reply\n";
+            return (-1);
+        }
+
+        // An empty reply means the client already has every receipt
+        if (m.m_bSuccess && strHasReceipts.Compare("true")) {
+            const char* pElementExpected = "boxReceipts";
+            Armored& ascTextExpected = m.m_ascPayload;
+
+            if (!Contract::LoadEncodedTextFieldByName(
+                    xml, ascTextExpected, pElementExpected)) {
+                otErr << "Error in OTMessage::ProcessXMLNode: "
+                         "Expected "
+                      << pElementExpected << " element with text field, for "
+                      << m.m_strCommand << ".\n";
+                return (-1);  // error condition
+            }
+        }
+
+        otWarn << "\nCommand: " << m.m_strCommand << "   "
+               << (m.m_bSuccess ? "SUCCESS" : "FAILED")
+               << "\nNymID:    " << m.m_strNymID
+               << "\nAccountID: " << m.m_strAcctID
+               << "\nNotaryID: " << m.m_strNotaryID << "\n\n";
+
+        return 1;
+    }
+    static RegisterStrategy reg;
+};
+RegisterStrategy StrategyGetBoxReceiptsResponse::reg(
+    "getBoxReceiptsResponse",
+    new StrategyGetBoxReceiptsResponse());
+
 class StrategyUnregisterAccount : public OTMessageStrategy
 {
 public:
@@ -3072,6 +3253,10 @@ public:
         pTag->add_attribute("notaryID", m.m_strNotaryID.Get());
         pTag->add_attribute("nymboxHash", m.m_strNymboxHash.Get());
 
+        if (m.m_lDepth > 0) {
+            pTag->add_attribute("count", formatLong(m.m_lDepth));
+        }
+
         parent.add_tag(pTag);
     }
 
@@ -3083,6 +3268,10 @@ public:
         m.m_strNotaryID = xml->getAttributeValue("notaryID");
         m.m_strRequestNum = xml->getAttributeValue("requestNum");
 
+        String strCount = xml->getAttributeValue("count");
+
+        if (strCount.GetLength() > 0) m.m_lDepth = strCount.ToLong();
+
         otWarn << "\n Command: " << m.m_strCommand
                << " \n NymID:    " << m.m_strNymID
                << "\n"
@@ -11,9 +11,13 @@
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/String.hpp"
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstdint>
+#include <iterator>
+#include <limits>
 #include <locale>
+#include <map>
 #include <ostream>
 #include <set>
 #include <string>
@@ -26,10 +30,7 @@ namespace opentxs
 
 NumList::NumList(const std::set<std::int64_t>& theNumbers) { Add(theNumbers); }
 
-NumList::NumList(std::set<std::int64_t>&& theNumbers)
-    : m_setData(std::move(theNumbers))
-{
-}
+NumList::NumList(std::set<std::int64_t>&& theNumbers) { Add(theNumbers); }
 
 NumList::NumList(std::int64_t lInput) { Add(lInput); }
 
@@ -43,7 +44,11 @@ NumList::NumList(const String& strNumbers) { Add(strNumbers); }
 
 NumList::NumList(const std::string& strNumbers) { Add(strNumbers); }
 
-NumList::NumList() {}
+NumList::NumList()
+    : m_mapRanges()
+    , m_lCount(0)
+{
+}
 
 NumList::~NumList() {}
 
@@ -86,6 +91,11 @@ bool NumList::Add(const char* szNumbers)  // if false, means the numbers were
                 // add the number to the list, and it's "0", we'll know it's a
                 // real number we're supposed to add, and not just a default
                 // value.
+    bool bInRange = false;  // Set after the '-' in "first-last"
+    std::int64_t lRangeStart = 0;
+    // The string may come from a peer, so the numbers added by its ranges are
+    // limited to a total which is cheap to expand into a std::set.
+    std::uint64_t lRangeBudget = OT_NUMLIST_MAX_RANGE_NUMBERS;
 
     for (;;)  // We already know it's not null, due to the assert. (So at least
               // one iteration will happen.)
@@ -95,8 +105,21 @@ bool NumList::Add(const char* szNumbers)  // if false, means the numbers were
 
             std::int32_t nDigit = (*pChar - '0');
 
+            if (lNum > (std::numeric_limits<std::int64_t>::max() - nDigit) /
+                           10) {
+                otErr << "OTNumList::Add: Error: Number too large in "
+                         "comma-separated list of longs.\n";
+                bSuccess = false;
+                break;
+            }
+
             lNum *= 10;  // Move it up a decimal place.
             lNum += nDigit;
+        } else if (('-' == *pChar) && bStartedANumber && !bInRange) {
+            bInRange = true;
+            lRangeStart = lNum;
+            lNum = 0;
+            bStartedANumber = false;
         }
         // if separator, or end of string, either way, add lNum to *this.
         else if (
@@ -105,7 +128,31 @@ bool NumList::Add(const char* szNumbers)  // if false, means the numbers were
                                         // done with current number. (On to
                                         // the next.)
         {
-            if ((lNum > 0) || (bStartedANumber && (0 == lNum))) {
+            if (bInRange) {
+                if (!bStartedANumber || (lNum < lRangeStart)) {
+                    otErr << "OTNumList::Add: Error: Invalid range of longs "
+                             "ending at: "
+                          << lNum << "\n";
+                    bSuccess = false;
+                    break;
+                }
+
+                const auto width =
+                    static_cast<std::uint64_t>(lNum - lRangeStart) + 1;
+
+                if (width > lRangeBudget) {
+                    otErr << "OTNumList::Add: Error: Range of longs from "
+                          << lRangeStart << " to " << lNum
+                          << " exceeds the limit of "
+                          << OT_NUMLIST_MAX_RANGE_NUMBERS << " numbers.\n";
+                    bSuccess = false;
+                    break;
+                }
+
+                lRangeBudget -= width;
+
+                if (!add_range(lRangeStart, lNum)) { bSuccess = false; }
+            } else if ((lNum > 0) || (bStartedANumber && (0 == lNum))) {
                 if (!Add(lNum))  // <=========
                 {
                     bSuccess = false;  // We still go ahead and try to add them
@@ -117,6 +164,7 @@ bool NumList::Add(const char* szNumbers)  // if false, means the numbers were
             lNum = 0;  // reset for the next transaction number (in the
                        // comma-separated list.)
             bStartedANumber = false;  // reset
+            bInRange = false;
         } else {
             otErr << "OTNumList::Add: Error: Unexpected character found in "
                      "erstwhile comma-separated list of longs: "
@@ -142,23 +190,58 @@ bool NumList::Add(const std::int64_t& theValue)  // if false, means the value
                                                  // was
                                                  // already there.
 {
-    auto it = m_setData.find(theValue);
+    return add_range(theValue, theValue);
+}
 
-    if (m_setData.end() == it)  // it's not already there, so add it.
-    {
-        m_setData.insert(theValue);
-        return true;
+// Merges [first, last] with every run it overlaps or touches, so that runs
+// never overlap and are never adjacent. That keeps the representation unique,
+// which lets Verify(const NumList&) compare the maps directly.
+bool NumList::add_range(const std::int64_t first, const std::int64_t last)
+{
+    OT_ASSERT(first <= last);
+
+    const auto min = std::numeric_limits<std::int64_t>::min();
+    const auto max = std::numeric_limits<std::int64_t>::max();
+    const std::int64_t before = (min == first) ? first : first - 1;
+    const std::int64_t after = (max == last) ? last : last + 1;
+    std::int64_t newFirst = first;
+    std::int64_t newLast = last;
+    std::size_t existing = 0;
+    auto it = m_mapRanges.upper_bound(first);
+
+    if (m_mapRanges.begin() != it) {
+        auto previous = std::prev(it);
+
+        if (previous->second >= before) { it = previous; }
     }
-    return false;  // it was already there.
+
+    while ((m_mapRanges.end() != it) && (it->first <= after)) {
+        const auto overlapFirst = std::max(it->first, first);
+        const auto overlapLast = std::min(it->second, last);
+
+        if (overlapFirst <= overlapLast) {
+            existing +=
+                static_cast<std::size_t>(overlapLast - overlapFirst) + 1;
+        }
+
+        newFirst = std::min(newFirst, it->first);
+        newLast = std::max(newLast, it->second);
+        it = m_mapRanges.erase(it);
+    }
+
+    m_mapRanges.emplace(newFirst, newLast);
+    m_lCount += (static_cast<std::size_t>(last - first) + 1) - existing;
+
+    return (0 == existing);
 }
 
 bool NumList::Peek(std::int64_t& lPeek) const
 {
-    auto it = m_setData.begin();
+    auto it = m_mapRanges.begin();
 
-    if (m_setData.end() != it)  // it's there.
+    if (m_mapRanges.end() != it)  // it's there.
     {
-        lPeek = *it;
+        lPeek = it->first;
         return true;
     }
     return false;
@@ -166,13 +249,10 @@ bool NumList::Peek(std::int64_t& lPeek) const
 
 bool NumList::Pop()
 {
-    auto it = m_setData.begin();
+    std::int64_t lFirst = 0;
+
+    if (Peek(lFirst)) { return Remove(lFirst); }
 
-    if (m_setData.end() != it)  // it's there.
-    {
-        m_setData.erase(it);
-        return true;
-    }
     return false;
 }
 
@@ -180,23 +260,39 @@ bool NumList::Remove(const std::int64_t& theValue)  // if false, means the value
                                                     // was
                                                     // NOT already there.
 {
-    auto it = m_setData.find(theValue);
+    auto it = m_mapRanges.upper_bound(theValue);
 
-    if (m_setData.end() != it)  // it's there.
-    {
-        m_setData.erase(it);
-        return true;
-    }
-    return false;  // it wasn't there (so how could you remove it then?)
+    if (m_mapRanges.begin() == it) { return false; }
+
+    --it;
+
+    const std::int64_t first = it->first;
+    const std::int64_t last = it->second;
+
+    if (last < theValue) { return false; }  // it wasn't there
+
+    m_mapRanges.erase(it);
+
+    if (first < theValue) { m_mapRanges.emplace(first, theValue - 1); }
+
+    if (theValue < last) { m_mapRanges.emplace(theValue + 1, last); }
+
+    --m_lCount;
+
+    return true;
 }
 
 bool NumList::Verify(const std::int64_t& theValue) const  // returns true/false
                                                           // (whether value is
                                                           // already there.)
 {
-    auto it = m_setData.find(theValue);
+    auto it = m_mapRanges.upper_bound(theValue);
+
+    if (m_mapRanges.begin() == it) { return false; }
 
-    return (m_setData.end() == it) ? false : true;
+    --it;
+
+    return (theValue <= it->second);
 }
 
 // True/False, based on whether values are already there.
@@ -220,34 +316,36 @@ bool NumList::Verify(const std::set<std::int64_t>& theNumbers) const
 ///
 bool NumList::Verify(const NumList& rhs) const
 {
-    // Verify they have the same number of elements.
-    //
-    if (Count() != rhs.Count()) return false;
-
-    // Verify each value on *this is also found on rhs.
+    // Runs are always merged, so equal contents means equal runs.
     //
-    for (auto& it : m_setData) {
-        if (!rhs.Verify(it)) return false;
-    }
-
-    return true;
+    return (m_lCount == rhs.m_lCount) && (m_mapRanges == rhs.m_mapRanges);
 }
 
 /// True/False, based on whether ANY of the numbers in rhs are found in *this.
 ///
 bool NumList::VerifyAny(const NumList& rhs) const
 {
-    return rhs.VerifyAny(m_setData);
+    for (const auto& [first, last] : rhs.m_mapRanges) {
+        auto it = m_mapRanges.upper_bound(last);
+
+        if (m_mapRanges.begin() == it) { continue; }
+
+        --it;
+
+        if (it->second >= first) { return true; }  // the runs overlap
+    }
+
+    return false;
 }
 
 /// Verify whether ANY of the numbers on *this are found in setData.
 ///
 bool NumList::VerifyAny(const std::set<std::int64_t>& setData) const
 {
-    for (const auto& it : m_setData) {
-        auto it_find = setData.find(it);
+    for (const auto& [first, last] : m_mapRanges) {
+        auto it_find = setData.lower_bound(first);
 
-        if (it_find != setData.end())  // found a match.
+        if ((it_find != setData.end()) && (*it_find <= last))  // found a match.
             return true;
     }
 
@@ -258,10 +356,14 @@ bool NumList::Add(const NumList& theNumList)  // if false, means the numbers
                                               // were already there. (At
                                               // least one of them.)
 {
-    std::set<std::int64_t> theOutput;
-    theNumList.Output(theOutput);  // returns false if the numlist was empty.
+    bool bSuccess = true;
 
-    return Add(theOutput);
+    for (const auto& [first, last] : theNumList.m_mapRanges) {
+        if (!add_range(first, last))  // Some were already there.
+            bSuccess = false;
+    }
+
+    return bSuccess;
 }
 
 bool NumList::Add(const std::set<std::int64_t>& theNumbers)  // if false, means
@@ -271,9 +373,16 @@ bool NumList::Add(const std::set<std::int64_t>& theNumbers)  // if false, means
 // of them.)
 {
     bool bSuccess = true;
+    auto it = theNumbers.begin();
 
-    for (const auto& it : theNumbers) {
-        if (!Add(it))  // It must have already been there.
+    // Add consecutive numbers as a single run.
+    while (theNumbers.end() != it) {
+        const std::int64_t first = *it;
+        std::int64_t last = first;
+
+        while ((++it != theNumbers.end()) && (*it == last + 1)) { last = *it; }
+
+        if (!add_range(first, last))  // Some were already there.
             bSuccess = false;
     }
 
@@ -305,38 +414,59 @@ bool NumList::Output(std::set<std::int64_t>& theOutput) const  // returns false
 // the numlist was
 // empty.
 {
-    theOutput = m_setData;
+    theOutput.clear();
+
+    for (const auto& [first, last] : m_mapRanges) {
+        for (std::int64_t number = first;; ++number) {
+            theOutput.emplace_hint(theOutput.end(), number);
+
+            if (number == last) { break; }
+        }
+    }
 
-    return !m_setData.empty();
+    return !m_mapRanges.empty();
 }
 
 // Outputs the numlist as a comma-separated string (for serialization, usually.)
 //
-bool NumList::Output(String& strOutput) const  // returns false if the
-                                               // numlist was empty.
+// Runs are only written as "first-last" if the reader is known to parse
+// them. Older peers only understand the plain comma-separated form.
+bool NumList::Output(String& strOutput, const bool bRanges) const
 {
     std::int32_t nIterationCount = 0;
 
-    for (auto& it : m_setData) {
+    for (const auto& [first, last] : m_mapRanges) {
         nIterationCount++;
 
-        strOutput.Concatenate(
-            "%s%" PRId64,
-            // If first iteration, prepend a blank string (instead of a comma.)
-            // Like this:  "%" PRId64 ""
-            // But for all subsequent iterations, concatenate: ",%" PRId64 ""
-            (1 == nIterationCount) ? "" : ",",
-            it);
+        // If first iteration, prepend a blank string (instead of a comma.)
+        const char* szSeparator = (1 == nIterationCount) ? "" : ",";
+
+        if (bRanges && (first + 1 < last)) {
+            strOutput.Concatenate(
+                "%s%" PRId64 "-%" PRId64, szSeparator, first, last);
+
+            continue;
+        }
+
+        strOutput.Concatenate("%s%" PRId64, szSeparator, first);
+
+        for (std::int64_t number = first; number != last;) {
+            strOutput.Concatenate(",%" PRId64, ++number);
+        }
     }
 
-    return !m_setData.empty();
+    return !m_mapRanges.empty();
 }
 
 std::int32_t NumList::Count() const
 {
-    return static_cast<std::int32_t>(m_setData.size());
+    return static_cast<std::int32_t>(m_lCount);
 }
 
-void NumList::Release() { m_setData.clear(); }
+void NumList::Release()
+{
+    m_mapRanges.clear();
+    m_lCount = 0;
+}
 
 }  // namespace opentxs
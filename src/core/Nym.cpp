@@ -600,10 +600,7 @@ void Nym::GetPrivateCredentials(String& strCredList, String::Map* pmapCredFiles)
 
     SaveCredentialsToTag(tag, nullptr, pmapCredFiles);
 
-    std::string str_result;
-    tag.output(str_result);
-
-    strCredList.Concatenate("%s", str_result.c_str());
+    tag.output(strCredList);
 }
 
 const crypto::key::Asymmetric& Nym::GetPrivateEncrKey(
@@ -704,10 +704,7 @@ bool NymFile::serialize_nymfile(const T& lock, String& strNym) const
         }
     }  // for
 
-    std::string str_result;
-    tag.output(str_result);
-
-    strNym.Concatenate("%s", str_result.c_str());
+    tag.output(strNym);
 
     return true;
 }
@@ -69,6 +69,7 @@ OTTransaction::OTTransaction(const api::Core& core)
     , m_lRequestNumber(0)
     , m_bReplyTransSuccess(false)
     , m_bCancelled(false)
+    , m_bNumberRanges(false)
 {
     InitTransaction();
 }
@@ -100,6 +101,7 @@ OTTransaction::OTTransaction(const api::Core& core, const Ledger& theOwner)
     , m_lRequestNumber(0)
     , m_bReplyTransSuccess(false)
     , m_bCancelled(false)
+    , m_bNumberRanges(false)
 {
     InitTransaction();
 }
@@ -140,6 +142,7 @@ OTTransaction::OTTransaction(
     , m_lRequestNumber(0)
     , m_bReplyTransSuccess(false)
     , m_bCancelled(false)
+    , m_bNumberRanges(false)
 {
     InitTransaction();
 
@@ -176,6 +179,7 @@ OTTransaction::OTTransaction(
     , m_lRequestNumber(0)
     , m_bReplyTransSuccess(false)
     , m_bCancelled(false)
+    , m_bNumberRanges(false)
 {
     InitTransaction();
 
@@ -231,6 +235,7 @@ OTTransaction::OTTransaction(
     , m_lRequestNumber(lRequestNum)
     , m_bReplyTransSuccess(bReplyTransSuccess)
     , m_bCancelled(false)
+    , m_bNumberRanges(false)
 {
     InitTransaction();
 
@@ -3153,6 +3158,8 @@ bool OTTransaction::VerifyItems(const Nym& theNym)
     // if pointer not null, and it's a withdrawal, and it's an acknowledgement
     // (not a rejection or error)
     //
+    std::vector<const Contract*> items{};
+
     for (auto& it : GetItemList()) {
         // loop through the ALL items that make up this transaction and check
         // to see if a response to deposit.
@@ -3163,16 +3170,12 @@ bool OTTransaction::VerifyItems(const Nym& theNym)
 
         if (NYM_ID != pItem->GetNymID()) return false;
 
-        if (!pItem->VerifySignature(theNym))  // NO need to call
-                                              // VerifyAccount since
-                                              // VerifyContractID is
-                                              // ALREADY called and now
-                                              // here's
-                                              // VerifySignature().
-            return false;
+        items.emplace_back(pItem.get());
     }
 
-    return true;
+    // NO need to call VerifyAccount since VerifyContractID is ALREADY called
+    // and now here's VerifySignature(), for all the items at once.
+    return Contract::VerifySignatures(items, theNym);
 }
 
 // all common OTTransaction stuff goes here.
@@ -4141,7 +4144,7 @@ void OTTransaction::UpdateContents()
         // and successNotices.
         if (m_Numlist.Count() > 0) {
             String strNumbers;
-            if (m_Numlist.Output(strNumbers))
+            if (m_Numlist.Output(strNumbers, m_bNumberRanges))
                 tag.add_attribute("totalListOfNumbers", strNumbers.Get());
         }
     }
@@ -4223,9 +4226,7 @@ void OTTransaction::UpdateContents()
         }
     }  // not abbreviated (full details.)
 
-    std::string str_result;
-    tag.output(str_result);
-    m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    tag.output(m_xmlUnsigned);
 }
 
 /*
@@ -4704,7 +4705,8 @@ void OTTransaction::SaveAbbreviatedNymboxRecord(Tag& parent)
                                               // successfully been signed out.
         {
             // This is always 0, except for blanks and successNotices.
-            if (m_Numlist.Count() > 0) m_Numlist.Output(strListOfBlanks);
+            if (m_Numlist.Count() > 0)
+                m_Numlist.Output(strListOfBlanks, m_bNumberRanges);
         }
             [[fallthrough]];
         case transactionType::replyNotice:  // A copy of a server reply to a
@@ -0,0 +1,86 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Internal.hpp"
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <vector>
+
+namespace opentxs
+{
+/** Bounded set of keys ordered by how recently each one was used
+ *
+ *  Owners use it to decide which of many reloadable objects may keep their
+ *  contents in memory. The set is not synchronized. */
+template <typename Key>
+class RecentSet
+{
+public:
+    /** Forgets key without reporting it as evicted */
+    void Erase(const Key& key)
+    {
+        const auto it = index_.find(key);
+
+        if (index_.end() == it) { return; }
+
+        order_.erase(it->second);
+        index_.erase(it);
+    }
+
+    /** Marks key as the most recently used and returns the least recently
+     *  used keys which no longer fit, oldest first */
+    std::vector<Key> Touch(const Key& key)
+    {
+        std::vector<Key> output{};
+        const auto it = index_.find(key);
+
+        if (index_.end() != it) {
+            order_.splice(order_.begin(), order_, it->second);
+
+            return output;
+        }
+
+        order_.emplace_front(key);
+        index_.emplace(key, order_.begin());
+
+        while (limit_ < order_.size()) {
+            output.emplace_back(order_.back());
+            index_.erase(order_.back());
+            order_.pop_back();
+        }
+
+        return output;
+    }
+
+    std::size_t Size() const { return index_.size(); }
+
+    RecentSet(const std::size_t limit)
+        : limit_(limit)
+        , order_()
+        , index_()
+    {
+    }
+
+    ~RecentSet() = default;
+
+private:
+    /** Most recently used first */
+    using Order = std::list<Key>;
+
+    const std::size_t limit_;
+    Order order_;
+    std::map<Key, typename Order::iterator> index_;
+
+    RecentSet() = delete;
+    RecentSet(const RecentSet&) = delete;
+    RecentSet(RecentSet&&) = delete;
+    RecentSet& operator=(const RecentSet&) = delete;
+    RecentSet& operator=(RecentSet&&) = delete;
+};
+}  // namespace opentxs
@@ -27,6 +27,7 @@
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
+#include <algorithm>
 #include <cstdint>
 #include <map>
 #include <sstream>
@@ -316,6 +317,7 @@ String::String()
     : length_(0)
     , position_(0)
     , data_(nullptr)
+    , capacity_(0)
 {
 }
 
@@ -485,6 +487,54 @@ bool String::Compare(const String& strCompare) const
     return true;
 }
 
+void String::append(const char* data, std::uint32_t size)
+{
+    if ((nullptr == data) || (0 == size)) { return; }
+
+    const std::uint64_t needed = std::uint64_t(length_) + size;
+
+    OT_ASSERT_MSG(
+        needed < (MAX_STRING_LENGTH - 10),
+        "ASSERT: String::append: Exceeded MAX_STRING_LENGTH!");
+
+    if ((nullptr == data_) || (needed > capacity_)) {
+        // data may point into our own buffer, so it must stay valid until
+        // it has been copied
+        const std::uint64_t grown =
+            (nullptr == data_) ? capacity_ : 2 * std::uint64_t(capacity_);
+        const std::uint64_t limit = MAX_STRING_LENGTH - 11;
+        const auto target = std::min(std::max(needed, grown), limit);
+        const auto* old = data_;
+        const auto oldLength = length_;
+        const auto oldCapacity = capacity_;
+        char* buffer = new char[target + 1];
+
+        OT_ASSERT(nullptr != buffer);
+
+        if (nullptr != old) {
+            OTPassword::safe_memcpy(buffer, target + 1, old, oldLength);
+        }
+
+        OTPassword::safe_memcpy(
+            buffer + oldLength, target + 1 - oldLength, data, size);
+        buffer[needed] = '\0';
+
+        if (nullptr != old) {
+            OTPassword::zeroMemory(data_, oldCapacity);
+            delete[] data_;
+        }
+
+        data_ = buffer;
+        capacity_ = static_cast<std::uint32_t>(target);
+    } else {
+        OTPassword::safe_memcpy(
+            data_ + length_, capacity_ + 1 - length_, data, size);
+        data_[needed] = '\0';
+    }
+
+    length_ = static_cast<std::uint32_t>(needed);
+}
+
 // append a string at the end of the current buffer.
 void String::Concatenate(const char* fmt, ...)
 {
@@ -497,23 +547,25 @@ void String::Concatenate(const char* fmt, ...)
 
     va_end(vl);
 
-    if (bSuccess) {
-        const String strConcat(str_output);
-
-        Concatenate(strConcat);
-    }
+    if (bSuccess) { Concatenate(str_output); }
 }
 
 // append a string at the end of the current buffer.
 void String::Concatenate(const String& strBuf)
 {
-    std::string str_output;
-
-    if ((length_ > 0) && (nullptr != data_)) str_output += data_;
+    if (strBuf.Exists() && (strBuf.GetLength() > 0)) {
+        append(strBuf.Get(), strBuf.GetLength());
+    }
+}
 
-    if (strBuf.Exists() && (strBuf.GetLength() > 0)) str_output += strBuf.Get();
+void String::Concatenate(const std::string_view data)
+{
+    if (data.empty()) { return; }
 
-    Set(str_output.c_str());
+    // Like Set, stop at an embedded null terminator
+    append(
+        data.data(),
+        static_cast<std::uint32_t>(safe_strlen(data.data(), data.size())));
 }
 
 // Contains is like compare.  True if the substring is there, false if not.
@@ -659,6 +711,7 @@ void String::Initialize()
     length_ = 0;
     position_ = 0;
     data_ = nullptr;
+    capacity_ = 0;
 }
 
 // if nEnforcedMaxLength is 10, then it will actually enforce a string at 9
@@ -711,6 +764,8 @@ void String::LowLevelSet(
             length_ = nLength;
         else
             length_ = 0;
+
+        capacity_ = length_;
     }
 }
 
@@ -731,6 +786,7 @@ void String::LowLevelSetStr(const String& strBuf)
             "causing data corruption.)");  // 10 being a buffer.
 
         data_ = str_dup2(strBuf.data_, length_);
+        capacity_ = (nullptr != data_) ? length_ : 0;
     }
 }
 
@@ -764,6 +820,7 @@ bool String::MemSet(const char* pMem, std::uint32_t theSize)  // if theSize is
     str_new[nLength] = '\0';  // This SHOULD be superfluous as well...
     length_ = nLength;        // the length doesn't count the 0.
     data_ = str_new;
+    capacity_ = theSize;
 
     return true;
 }
@@ -786,13 +843,40 @@ void String::Release_String(void)
 {
     if (nullptr != data_) {
         // for security purposes.
-        OTPassword::zeroMemory(data_, length_);
+        OTPassword::zeroMemory(data_, capacity_);
         delete[] data_;
     }
 
     Initialize();
 }
 
+void String::Reserve(std::uint32_t size)
+{
+    if (size <= capacity_) { return; }
+
+    OT_ASSERT_MSG(
+        size < (MAX_STRING_LENGTH - 10),
+        "ASSERT: String::Reserve: Exceeded MAX_STRING_LENGTH!");
+
+    // Allocating now would make an empty string Exist()
+    if (nullptr == data_) {
+        capacity_ = size;
+
+        return;
+    }
+
+    char* buffer = new char[size + 1];
+
+    OT_ASSERT(nullptr != buffer);
+
+    OTPassword::zeroMemory(buffer, size + 1);
+    OTPassword::safe_memcpy(buffer, size + 1, data_, length_);
+    OTPassword::zeroMemory(data_, capacity_);
+    delete[] data_;
+    data_ = buffer;
+    capacity_ = size;
+}
+
 void String::reset(void) { position_ = 0; }
 
 // new_string MUST be at least nEnforcedMaxLength in size if nEnforcedMaxLength
@@ -904,6 +988,7 @@ void String::swap(String& rhs)
     std::swap(length_, rhs.length_);
     std::swap(position_, rhs.position_);
     std::swap(data_, rhs.data_);
+    std::swap(capacity_, rhs.capacity_);
 }
 
 std::int32_t String::ToInt() const
@@ -345,10 +345,7 @@ void Basket::GenerateContents(OTStringXML& xmlUnsigned, bool bHideAccountID)
         tag.add_tag(tagItem);
     }
 
-    std::string str_result;
-    tag.output(str_result);
-
-    xmlUnsigned.Concatenate("%s", str_result.c_str());
+    tag.output(xmlUnsigned);
 }
 
 // Most contracts calculate their ID by hashing the Raw File (signatures and
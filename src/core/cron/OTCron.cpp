@@ -28,12 +28,19 @@
 
 #include <irrxml/irrXML.hpp>
 #include <string.h>
+#include <algorithm>
+#include <chrono>
 #include <cstdint>
+#include <future>
 #include <map>
 #include <memory>
 #include <ostream>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
+
+#define OT_CRON_FILE "OT-CRON.crn"
 
 namespace opentxs
 {
@@ -58,6 +65,7 @@ Timer OTCron::tCron(true);
 OTCron::OTCron(const api::Core& server)
     : Contract(server)
     , m_mapMarkets()
+    , m_lockMarkets()
     , m_mapCronItems()
     , m_multimapCronItems()
     , m_NOTARY_ID(Identifier::Factory())
@@ -65,6 +73,9 @@ OTCron::OTCron(const api::Core& server)
     , m_bIsActivated(false)
     , m_pServerNym(nullptr)  // just here for convenience, not responsible to
                              // cleanup this pointer.
+    , pending_items_()
+    , pending_markets_()
+    , cron_file_(OT_CRON_FILE)
 {
     InitCron();
     otLog3 << "OTCron::OTCron: Finished calling InitCron 0.\n";
@@ -76,21 +87,151 @@ OTCron::OTCron(const api::Core& server)
 bool OTCron::LoadCron()
 {
     const char* szFoldername = OTFolders::Cron().Get();
-    const char* szFilename = "OT-CRON.crn";  // todo stop hardcoding filenames.
+    const char* szFilename = cron_file_.c_str();
 
     OT_ASSERT(nullptr != GetServerNym());
 
+    const auto start = std::chrono::steady_clock::now();
     bool bSuccess = LoadContract(szFoldername, szFilename);
 
     if (bSuccess) bSuccess = VerifySignature(*(GetServerNym()));
 
+    otOut << "OTCron::LoadCron: Parsed cron file in "
+          << std::chrono::duration_cast<std::chrono::milliseconds>(
+                 std::chrono::steady_clock::now() - start)
+                 .count()
+          << " ms.\n";
+
+    if (bSuccess) bSuccess = load_pending();
+
+    pending_items_.clear();
+    pending_markets_.clear();
+
     return bSuccess;
 }
 
+bool OTCron::load_pending()
+{
+    OT_ASSERT(nullptr != GetServerNym());
+
+    const auto& serverNym = *GetServerNym();
+    const auto start = std::chrono::steady_clock::now();
+    const auto itemCount = pending_items_.size();
+    const auto marketCount = pending_markets_.size();
+    const auto total = itemCount + marketCount;
+    const std::size_t threads =
+        std::max(1u, std::min(std::thread::hardware_concurrency(), 16u));
+    std::vector<std::shared_ptr<OTMarket>> markets(marketCount);
+    std::vector<bool> read(marketCount, false);
+    std::vector<std::shared_ptr<OTCronItem>> items(itemCount);
+
+    // OTDB has no locking of its own, so the market files are fetched here on
+    // one thread and only parsed and verified by the workers.
+    for (std::size_t i = 0; i < marketCount; ++i) {
+        const auto& [unitID, currencyID, scale] = pending_markets_.at(i);
+        markets[i].reset(api_.Factory()
+                             .Market(m_NOTARY_ID, unitID, currencyID, scale)
+                             .release());
+
+        OT_ASSERT(false != bool(markets[i]));
+
+        // This way every Market has a pointer to Cron.
+        markets[i]->SetCronPointer(*this);
+        read[i] = markets[i]->ReadMarket();
+    }
+
+    // Each worker writes only to its own slots in markets and items, so the
+    // results are merged below in the same order as the cron file.
+    auto worker = [&](const std::size_t first) -> void {
+        for (auto i = first; i < total; i += threads) {
+            if (i < marketCount) {
+                auto& market = markets[i];
+
+                if (false == (read[i] && market->ParseMarket())) {
+                    market.reset();
+                    otErr << "OTCron::load_pending: Somehow error while "
+                             "loading or verifying market while loading Cron "
+                             "file.\n";
+                }
+            } else {
+                const auto index = i - marketCount;
+                const auto& strData = pending_items_.at(index).second;
+                std::shared_ptr<OTCronItem> item{
+                    api_.Factory().CronItem(strData).release()};
+
+                if (false == bool(item)) {
+                    otErr << "OTCron::load_pending: Unable to create cron "
+                             "item from data in cron file.\n";
+                } else if (!item->VerifySignature(serverNym)) {
+                    otErr << "OTCron::load_pending: ERROR SECURITY: Server "
+                             "signature failed to verify on a cron item while "
+                             "loading: "
+                          << item->GetTransactionNum() << "\n";
+                } else {
+                    items[index] = item;
+                }
+            }
+        }
+    };
+    std::vector<std::future<void>> jobs{};
+
+    for (std::size_t i = 1; i < std::min(threads, total); ++i) {
+        jobs.emplace_back(std::async(std::launch::async, worker, i));
+    }
+
+    worker(0);
+
+    for (auto& job : jobs) { job.get(); }
+
+    const auto verified = std::chrono::steady_clock::now();
+    bool output{true};
+
+    for (auto& market : markets) {
+        // AddMarket normally saves to file, but we don't want that when
+        // we're LOADING from file, now do we?
+        if (false == bool(market) || !AddMarket(market, false)) {
+            otErr << "OTCron::load_pending: Unable to add market to cron "
+                     "list.\n";
+            output = false;
+
+            break;
+        }
+    }
+
+    for (std::size_t i = 0; output && (i < itemCount); ++i) {
+        auto& item = items.at(i);
+        const auto tDateAdded = pending_items_.at(i).first;
+
+        // bSaveReceipt=false. The receipt is only saved once: When item FIRST
+        // added to cron. Here, the item was ALREADY in cron, and is merely
+        // being loaded from disk.
+        if (false == bool(item) || !AddCronItem(item, false, tDateAdded)) {
+            otErr << "OTCron::load_pending: Unable to add cron item (from "
+                     "cron file) to cron list.\n";
+            output = false;
+        }
+    }
+
+    const auto finished = std::chrono::steady_clock::now();
+    otOut << "OTCron::load_pending: Loaded " << marketCount << " markets and "
+          << itemCount << " cron items using " << threads
+          << " threads. Load and verify: "
+          << std::chrono::duration_cast<std::chrono::milliseconds>(
+                 verified - start)
+                 .count()
+          << " ms, merge: "
+          << std::chrono::duration_cast<std::chrono::milliseconds>(
+                 finished - verified)
+                 .count()
+          << " ms.\n";
+
+    return output;
+}
+
 bool OTCron::SaveCron()
 {
     const char* szFoldername = OTFolders::Cron().Get();
-    const char* szFilename = "OT-CRON.crn";  // todo stop hardcoding filenames.
+    const char* szFilename = cron_file_.c_str();
 
     OT_ASSERT(nullptr != GetServerNym());
 
@@ -122,7 +263,7 @@ bool OTCron::GetNym_OfferList(
         dynamic_cast<OTDB::OfferListNym*>(
             OTDB::CreateObject(OTDB::STORED_OBJ_OFFER_LIST_NYM)));
 
-    for (auto& it : m_mapMarkets) {
+    for (auto& it : get_markets()) {
         auto pMarket = it.second;
         OT_ASSERT(false != bool(pMarket));
 
@@ -198,7 +339,7 @@ bool OTCron::GetMarketList(Armored& ascOutput, std::int32_t& nMarketCount)
         dynamic_cast<OTDB::MarketList*>(
             OTDB::CreateObject(OTDB::STORED_OBJ_MARKET_LIST)));
 
-    for (auto& it : m_mapMarkets) {
+    for (auto& it : get_markets()) {
         auto pMarket = it.second;
         OT_ASSERT(false != bool(pMarket));
 
@@ -206,46 +347,10 @@ bool OTCron::GetMarketList(Armored& ascOutput, std::int32_t& nMarketCount)
             dynamic_cast<OTDB::MarketData*>(
                 OTDB::CreateObject(OTDB::STORED_OBJ_MARKET_DATA)));
 
-        const auto MARKET_ID = Identifier::Factory(*pMarket);
-        const auto str_MARKET_ID = String::Factory(MARKET_ID);
-        const auto str_NotaryID = String::Factory(pMarket->GetNotaryID());
-        const auto str_INSTRUMENT_DEFINITION_ID =
-            String::Factory(pMarket->GetInstrumentDefinitionID());
-        const auto str_CURRENCY_ID = String::Factory(pMarket->GetCurrencyID());
-
-        pMarketData->notary_id = str_NotaryID->Get();
-        pMarketData->market_id = str_MARKET_ID->Get();
-        pMarketData->instrument_definition_id =
-            str_INSTRUMENT_DEFINITION_ID->Get();
-        pMarketData->currency_type_id = str_CURRENCY_ID->Get();
-        // --------------------------------------------
-        const std::int64_t& lScale = pMarket->GetScale();
-
-        pMarketData->scale = to_string<std::int64_t>(lScale);
-
-        const std::uint64_t theCurrentBid = pMarket->GetHighestBidPrice();
-        const std::uint64_t theCurrentAsk = pMarket->GetLowestAskPrice();
-
-        pMarketData->current_bid = to_string<std::uint64_t>(theCurrentBid);
-        pMarketData->current_ask = to_string<std::uint64_t>(theCurrentAsk);
-
-        const std::int64_t& lLastSalePrice = pMarket->GetLastSalePrice();
-        const std::int64_t& lTotalAvailableAssets =
-            pMarket->GetTotalAvailableAssets();
-
-        pMarketData->total_assets =
-            to_string<std::int64_t>(lTotalAvailableAssets);
-        pMarketData->last_sale_price = to_string<std::int64_t>(lLastSalePrice);
-
-        pMarketData->last_sale_date = pMarket->GetLastSaleDate();
-
-        const mapOfOffers::size_type theBidCount = pMarket->GetBidCount();
-        const mapOfOffers::size_type theAskCount = pMarket->GetAskCount();
-
-        pMarketData->number_bids =
-            to_string<mapOfOffers::size_type>(theBidCount);
-        pMarketData->number_asks =
-            to_string<mapOfOffers::size_type>(theAskCount);
+        // The entry is read from the market's published snapshot, so the
+        // order book itself is never touched here. A market which has not
+        // been saved or loaded yet has nothing to report.
+        if (false == pMarket->GetMarketData(*pMarketData)) { continue; }
 
         // In the past 24 hours.
         // (I'm not collecting this data yet, (maybe never), so these values
@@ -396,54 +501,12 @@ std::int32_t OTCron::ProcessXMLNode(irr::io::IrrXMLReader*& xml)
             otErr << "Error in OTCron::ProcessXMLNode: cronItem field without "
                      "value.\n";
             return (-1);  // error condition
-        } else {
-            auto pItem{api_.Factory().CronItem(strData)};
-
-            if (false == bool(pItem)) {
-                otErr
-                    << "Unable to create cron item from data in cron file.\n ";
-                return (-1);
-            }
-
-            // Why not do this here (when loading from storage), as well as when
-            // first adding the item to cron,
-            // and thus save myself the trouble of verifying the signature EVERY
-            // ITERATION of ProcessCron().
-            //
-            std::shared_ptr<OTCronItem> item{pItem.release()};
-            if (!item->VerifySignature(*m_pServerNym)) {
-                otErr << "OTCron::ProcessXMLNode: ERROR SECURITY: Server "
-                         "signature failed to "
-                         "verify on a cron item while loading: "
-                      << item->GetTransactionNum() << "\n";
-                return (-1);
-            } else if (AddCronItem(
-                           item,
-                           false,          // bSaveReceipt=false. The receipt is
-                                           // only saved once: When item FIRST
-                                           // added to cron...
-                           tDateAdded)) {  // ...But here, the item was
-                                           // ALREADY in cron, and is
-                                           // merely being loaded from
-                                           // disk.
-                // Thus, it would be wrong to try to create the "original
-                // record" as if it were brand
-                // new and still had the user's signature on it. (Once added to
-                // Cron, the signatures are
-                // released and the SERVER signs it from there. That's why the
-                // user's version is saved
-                // as a receipt in the first place -- so we have a record of the
-                // user's authorization.)
-                otInfo << "Successfully loaded cron item and added to list.\n";
-            } else {
-                otErr << "OTCron::ProcessXMLNode: Though loaded / verified "
-                         "successfully, "
-                         "unable to add cron item (from cron file) to cron "
-                         " list.\n ";
-                return (-1);
-            }
         }
 
+        // Parsing and signature verification are deferred to load_pending(),
+        // which processes all items from the cron file in parallel.
+        pending_items_.emplace_back(tDateAdded, strData);
+
         nReturnVal = 1;
     } else if (!strcmp("market", xml->getNodeName())) {
         const auto strMarketID =
@@ -462,30 +525,11 @@ std::int32_t OTCron::ProcessXMLNode(irr::io::IrrXMLReader*& xml)
 
         otWarn << "Loaded cron entry for Market:\n" << strMarketID << ".\n";
 
-        // LoadMarket() needs this info to do its thing.
-        auto pMarket{api_.Factory().Market(
-            m_NOTARY_ID, INSTRUMENT_DEFINITION_ID, CURRENCY_ID, lScale)};
+        // LoadMarket() needs this info to do its thing. The market file itself
+        // is loaded and verified by load_pending().
+        pending_markets_.emplace_back(
+            INSTRUMENT_DEFINITION_ID, CURRENCY_ID, lScale);
 
-        OT_ASSERT(false != bool(pMarket));
-
-        pMarket->SetCronPointer(*this);  // This way every Market has a pointer
-                                         // to Cron.
-
-        // AddMarket normally saves to file, but we don't want that when
-        // we're LOADING from file, now do we?
-        std::shared_ptr<OTMarket> market{pMarket.release()};
-        if (!market->LoadMarket() ||
-            !market->VerifySignature(*GetServerNym()) ||
-            !AddMarket(market, false))  // bSaveFile=false: don't save this
-                                        // file WHILE loading it!!!
-        {
-            otErr << "Somehow error while loading, verifying, or adding market "
-                     "while loading Cron file.\n";
-            return (-1);
-        } else {
-            otWarn << "Loaded market entry from cronfile, and also loaded the "
-                      "market file itself.\n";
-        }
         nReturnVal = 1;
     }
 
@@ -506,7 +550,7 @@ void OTCron::UpdateContents()
 
     // Save the Market entries (the markets themselves are saved in a markets
     // folder.)
-    for (auto& it : m_mapMarkets) {
+    for (auto& it : get_markets()) {
         auto pMarket = it.second;
         OT_ASSERT(false != bool(pMarket));
 
@@ -550,10 +594,7 @@ void OTCron::UpdateContents()
         tag.add_tag(tagNumber);
     }  // for
 
-    std::string str_result;
-    tag.output(str_result);
-
-    m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    tag.output(m_xmlUnsigned);
 }
 
 std::int64_t OTCron::computeTimeout()
@@ -922,6 +963,13 @@ std::shared_ptr<OTCronItem> OTCron::GetItemByValidOpeningNum(
     return nullptr;
 }
 
+mapOfMarkets OTCron::get_markets() const
+{
+    Lock lock(m_lockMarkets);
+
+    return m_mapMarkets;
+}
+
 // OTCron IS responsible for cleaning up theMarket, and takes ownership.
 // So make SURE it is allocated on the HEAP before you pass it in here, and
 // also make sure to delete it again if this call fails!
@@ -939,6 +987,7 @@ bool OTCron::AddMarket(
     std::string std_MARKET_ID = str_MARKET_ID->Get();
 
     // See if there's something else already there with the same market ID.
+    Lock lock(m_lockMarkets);
     auto it = m_mapMarkets.find(std_MARKET_ID);
 
     // If it's not already on the list, then add it...
@@ -955,6 +1004,8 @@ bool OTCron::AddMarket(
         }
 
         m_mapMarkets[std_MARKET_ID] = theMarket;
+        // SaveCron lists the markets
+        lock.unlock();
 
         bool bSuccess = true;
 
@@ -1032,6 +1083,7 @@ std::shared_ptr<OTMarket> OTCron::GetMarket(const Identifier& MARKET_ID)
     std::string std_MARKET_ID = str_MARKET_ID->Get();
 
     // See if there's something there with that transaction number.
+    Lock lock(m_lockMarkets);
     auto it = m_mapMarkets.find(std_MARKET_ID);
 
     if (it == m_mapMarkets.end()) {
@@ -1041,6 +1093,7 @@ std::shared_ptr<OTMarket> OTCron::GetMarket(const Identifier& MARKET_ID)
     // Found it!
     else {
         auto pMarket = it->second;
+        lock.unlock();
 
         OT_ASSERT(false != bool(pMarket));
 
@@ -1060,7 +1113,13 @@ std::shared_ptr<OTMarket> OTCron::GetMarket(const Identifier& MARKET_ID)
 
 void OTCron::InitCron() { m_strContractType = String::Factory("CRON"); }
 
-void OTCron::Release() { Contract::Release(); }
+void OTCron::Release()
+{
+    pending_items_.clear();
+    pending_markets_.clear();
+
+    Contract::Release();
+}
 
 OTCron::~OTCron() { m_pServerNym = nullptr; }
 }  // namespace opentxs
@@ -129,10 +129,7 @@ void OTSignedFile::UpdateContents()
         tag.add_tag("filePayload", ascPayload.Get());
     }
 
-    std::string str_result;
-    tag.output(str_result);
-
-    m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    tag.output(m_xmlUnsigned);
 }
 
 std::int32_t OTSignedFile::ProcessXMLNode(irr::io::IrrXMLReader*& xml)
@@ -316,10 +316,7 @@ void OTPaymentPlan::UpdateContents()
         tag.add_tag("merchantSignedCopy", ascTemp.Get());
     }
 
-    std::string str_result;
-    tag.output(str_result);
-
-    m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    tag.output(m_xmlUnsigned);
 }
 
 // *** Set Initial Payment ***  / Make sure to call SetAgreement() first.
@@ -2171,10 +2171,7 @@ void OTScriptable::CalculateContractID(Identifier& newID) const
 
     UpdateContentsToTag(tag, true);
 
-    std::string str_result;
-    tag.output(str_result);
-
-    xmlUnsigned.Concatenate("%s", str_result.c_str());
+    tag.output(xmlUnsigned);
 
     newID.CalculateDigest(xmlUnsigned);
 }
@@ -2258,10 +2255,7 @@ void OTScriptable::UpdateContents()  // Before transmission or serialization,
 
     UpdateContentsToTag(tag, m_bCalculatingID);
 
-    std::string str_result;
-    tag.output(str_result);
-
-    m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    tag.output(m_xmlUnsigned);
 }
 
 // return -1 if error, 0 if nothing, and 1 if the node was processed.
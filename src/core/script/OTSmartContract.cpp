@@ -5123,10 +5123,7 @@ void OTSmartContract::UpdateContents()
         }
     }
 
-    std::string str_result;
-    tag.output(str_result);
-
-    m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    tag.output(m_xmlUnsigned);
 }
 
 // Used internally here.
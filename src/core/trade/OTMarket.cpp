@@ -34,24 +34,249 @@
 #include <irrxml/irrXML.hpp>
 
 #include <cinttypes>
+#include <algorithm>
 #include <cstdint>
 #include <iterator>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 #define OT_METHOD "opentxs::OTMarket::"
 
 namespace opentxs
 {
+class OTMarket::Snapshot
+{
+public:
+    struct Offer {
+        std::int64_t transaction_{0};
+        std::int64_t price_{0};
+        std::int64_t available_{0};
+        std::int64_t increment_{0};
+        time64_t date_{OT_TIME_ZERO};
+    };
+
+    // The market's entry in the reply to getMarketList
+    struct Summary {
+        std::string market_id_{};
+        std::string notary_id_{};
+        std::string unit_id_{};
+        std::string currency_id_{};
+        std::int64_t scale_{0};
+        std::int64_t current_bid_{0};
+        std::int64_t current_ask_{0};
+        std::int64_t last_sale_price_{0};
+        std::string last_sale_date_{};
+        std::int64_t total_assets_{0};
+        mapOfOffers::size_type bid_count_{0};
+        mapOfOffers::size_type ask_count_{0};
+    };
+
+    const std::uint64_t version_{0};
+    const Summary summary_{};
+    // In the same order OTMarket::GetOfferList has always returned them
+    const std::vector<Offer> bids_{};
+    const std::vector<Offer> asks_{};
+    const bool trades_valid_{false};
+    const std::int32_t trade_count_{0};
+    const std::string trades_{};
+
+    bool OfferList(
+        const std::int64_t lDepth,
+        Armored& ascOutput,
+        std::int32_t& nOfferCount) const;
+
+    Snapshot(
+        const std::uint64_t version,
+        Summary&& summary,
+        std::vector<Offer>&& bids,
+        std::vector<Offer>&& asks,
+        const bool tradesValid,
+        const std::int32_t tradeCount,
+        std::string&& trades);
+
+private:
+    // Replies are only built for a depth once. Any depth larger than the
+    // number of offers produces the same reply, so the cache is bounded by
+    // the size of the snapshot.
+    using CachedList = std::tuple<bool, std::int32_t, std::string>;
+
+    mutable std::mutex lock_;
+    mutable std::map<std::int64_t, CachedList> offer_lists_;
+
+    bool build_offer_list(
+        const std::int64_t lDepth,
+        std::string& output,
+        std::int32_t& nOfferCount) const;
+
+    Snapshot() = delete;
+    Snapshot(const Snapshot&) = delete;
+    Snapshot(Snapshot&&) = delete;
+    Snapshot& operator=(const Snapshot&) = delete;
+    Snapshot& operator=(Snapshot&&) = delete;
+};
+
+OTMarket::Snapshot::Snapshot(
+    const std::uint64_t version,
+    Summary&& summary,
+    std::vector<Offer>&& bids,
+    std::vector<Offer>&& asks,
+    const bool tradesValid,
+    const std::int32_t tradeCount,
+    std::string&& trades)
+    : version_(version)
+    , summary_(std::move(summary))
+    , bids_(std::move(bids))
+    , asks_(std::move(asks))
+    , trades_valid_(tradesValid)
+    , trade_count_(tradeCount)
+    , trades_(std::move(trades))
+    , lock_()
+    , offer_lists_()
+{
+}
+
+bool OTMarket::Snapshot::build_offer_list(
+    const std::int64_t lDepth,
+    std::string& output,
+    std::int32_t& nOfferCount) const
+{
+    std::unique_ptr<OTDB::OfferListMarket> pOfferList(
+        dynamic_cast<OTDB::OfferListMarket*>(
+            OTDB::CreateObject(OTDB::STORED_OBJ_OFFER_LIST_MARKET)));
+
+    OT_ASSERT(pOfferList);
+
+    std::int32_t nTempDepth = 0;
+
+    for (const auto& offer : bids_) {
+        if (nTempDepth++ > lDepth) break;
+
+        if (0 == offer.price_)  // Skipping any market orders.
+            continue;
+
+        std::unique_ptr<OTDB::BidData> pOfferData(dynamic_cast<OTDB::BidData*>(
+            OTDB::CreateObject(OTDB::STORED_OBJ_BID_DATA)));
+
+        OT_ASSERT(pOfferData);
+
+        pOfferData->transaction_id =
+            to_string<std::int64_t>(offer.transaction_);
+        pOfferData->price_per_scale = to_string<std::int64_t>(offer.price_);
+        pOfferData->available_assets =
+            to_string<std::int64_t>(offer.available_);
+        pOfferData->minimum_increment =
+            to_string<std::int64_t>(offer.increment_);
+        pOfferData->date = to_string<time64_t>(offer.date_);
+
+        // *pOfferData is CLONED at this time (I'm still responsible to delete.)
+        pOfferList->AddBidData(*pOfferData);
+        nOfferCount++;
+    }
+
+    nTempDepth = 0;
+
+    for (const auto& offer : asks_) {
+        if (nTempDepth++ > lDepth) break;
+
+        std::unique_ptr<OTDB::AskData> pOfferData(dynamic_cast<OTDB::AskData*>(
+            OTDB::CreateObject(OTDB::STORED_OBJ_ASK_DATA)));
+
+        OT_ASSERT(pOfferData);
+
+        pOfferData->transaction_id =
+            to_string<std::int64_t>(offer.transaction_);
+        pOfferData->price_per_scale = to_string<std::int64_t>(offer.price_);
+        pOfferData->available_assets =
+            to_string<std::int64_t>(offer.available_);
+        pOfferData->minimum_increment =
+            to_string<std::int64_t>(offer.increment_);
+        pOfferData->date = to_string<time64_t>(offer.date_);
+
+        // *pOfferData is CLONED at this time (I'm still responsible to delete.)
+        pOfferList->AddAskData(*pOfferData);
+        nOfferCount++;
+    }
+
+    // Success, but there were zero offers found.
+    if (0 == nOfferCount) { return true; }
+
+    OTDB::Storage* pStorage = OTDB::GetDefaultStorage();
+
+    OT_ASSERT(nullptr != pStorage);
+
+    // No need to check for failure, since this already ASSERTS.
+    OTDB::OTPacker* pPacker = pStorage->GetPacker();
+    std::unique_ptr<OTDB::PackedBuffer> pBuffer(pPacker->Pack(*pOfferList));
+
+    if (nullptr == pBuffer) {
+        otErr << "Failed packing pOfferList in OTMarket::GetOfferList. \n";
+
+        return false;
+    }
+
+    const std::uint8_t* pUint = pBuffer->GetData();
+    const size_t theSize = pBuffer->GetSize();
+
+    if (nullptr == pUint) {
+        otErr << "Error while getting buffer data in "
+                 "OTMarket::GetOfferList.\n";
+
+        return false;
+    }
+
+    auto theData = Data::Factory(pUint, static_cast<std::uint32_t>(theSize));
+    Armored ascOutput;
+    // This function will base64 ENCODE theData.
+    ascOutput.SetData(theData);
+    output = ascOutput.Get();
+
+    return true;
+}
+
+bool OTMarket::Snapshot::OfferList(
+    const std::int64_t lDepth,
+    Armored& ascOutput,
+    std::int32_t& nOfferCount) const
+{
+    const auto limit =
+        static_cast<std::int64_t>(std::max(bids_.size(), asks_.size()));
+    const auto key = std::max(std::int64_t{-1}, std::min(lDepth, limit));
+    Lock lock(lock_);
+    auto it = offer_lists_.find(key);
+
+    if (offer_lists_.end() == it) {
+        std::int32_t count{0};
+        std::string output{};
+        const auto success = build_offer_list(key, output, count);
+        it = offer_lists_
+                 .emplace(key, CachedList{success, count, std::move(output)})
+                 .first;
+    }
+
+    const auto& [success, count, output] = it->second;
+    nOfferCount = count;
+
+    if (success && (0 < count)) { ascOutput.Set(output.c_str()); }
+
+    return success;
+}
+
 OTMarket::OTMarket(const api::Core& core, const char* szFilename)
     : Contract(core)
     , m_pCron(nullptr)
     , m_pTradeList(nullptr)
     , m_mapBids()
     , m_mapAsks()
+    , m_lBidCount(0)
+    , m_lAskCount(0)
+    , m_pSnapshot(nullptr)
+    , m_lSnapshotVersion(0)
     , m_mapOffers()
     , m_NOTARY_ID(Identifier::Factory())
     , m_INSTRUMENT_DEFINITION_ID(Identifier::Factory())
@@ -65,6 +290,7 @@ OTMarket::OTMarket(const api::Core& core, const char* szFilename)
     InitMarket();
     m_strFilename->Set(szFilename);
     m_strFoldername->Set(OTFolders::Market().Get());
+    publish_snapshot();
 }
 
 OTMarket::OTMarket(const api::Core& core)
@@ -73,6 +299,10 @@ OTMarket::OTMarket(const api::Core& core)
     , m_pTradeList(nullptr)
     , m_mapBids()
     , m_mapAsks()
+    , m_lBidCount(0)
+    , m_lAskCount(0)
+    , m_pSnapshot(nullptr)
+    , m_lSnapshotVersion(0)
     , m_mapOffers()
     , m_NOTARY_ID(Identifier::Factory())
     , m_INSTRUMENT_DEFINITION_ID(Identifier::Factory())
@@ -82,6 +312,7 @@ OTMarket::OTMarket(const api::Core& core)
     , m_strLastSaleDate()
 {
     InitMarket();
+    publish_snapshot();
 }
 
 OTMarket::OTMarket(
@@ -95,6 +326,10 @@ OTMarket::OTMarket(
     , m_pTradeList(nullptr)
     , m_mapBids()
     , m_mapAsks()
+    , m_lBidCount(0)
+    , m_lAskCount(0)
+    , m_pSnapshot(nullptr)
+    , m_lSnapshotVersion(0)
     , m_mapOffers()
     , m_NOTARY_ID(Identifier::Factory(NOTARY_ID))
     , m_INSTRUMENT_DEFINITION_ID(Identifier::Factory(INSTRUMENT_DEFINITION_ID))
@@ -105,6 +340,7 @@ OTMarket::OTMarket(
 {
     InitMarket();
     SetScale(lScale);
+    publish_snapshot();
 }
 
 // return -1 if error, 0 if nothing, and 1 if the node was processed.
@@ -176,7 +412,7 @@ std::int32_t OTMarket::ProcessXMLNode(irr::io::IrrXMLReader*& xml)
             OT_ASSERT(false != bool(pOffer));
 
             OTOffer* offer = pOffer.release();
-            if (pOffer->LoadContractFromString(strData) &&
+            if (offer->LoadContractFromString(strData) &&
                 AddOffer(nullptr, *offer, false, tDateAdded))
             // bSaveMarket = false (Don't SAVE -- we're loading right now!)
             {
@@ -216,52 +452,38 @@ void OTMarket::UpdateContents()
     tag.add_attribute("lastSaleDate", m_strLastSaleDate);
     tag.add_attribute("lastSalePrice", formatLong(m_lLastSalePrice));
 
-    // Save the offers for sale.
-    for (auto& it : m_mapAsks) {
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
+    auto add_offers = [&tag](const mapOfPriceLevels& levels) -> void {
+        for (const auto& level : levels) {
+            for (const auto& pOffer : level.second.offers_) {
+                OT_ASSERT(nullptr != pOffer);
 
-        auto strOffer = String::Factory(*pOffer);  // Extract the offer contract
-                                                   // into string form.
-        Armored ascOffer(strOffer);  // Base64-encode that for storage.
+                // Extract the offer contract into string form.
+                auto strOffer = String::Factory(*pOffer);
+                Armored ascOffer(strOffer);  // Base64-encode that for storage.
 
-        TagPtr tagOffer(new Tag("offer", ascOffer.Get()));
-        tagOffer->add_attribute(
-            "dateAdded", formatTimestamp(pOffer->GetDateAddedToMarket()));
-        tag.add_tag(tagOffer);
-    }
-
-    // Save the bids.
-    for (auto& it : m_mapBids) {
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
-
-        auto strOffer = String::Factory(*pOffer);  // Extract the offer contract
-                                                   // into string form.
-        Armored ascOffer(strOffer);  // Base64-encode that for storage.
-
-        TagPtr tagOffer(new Tag("offer", ascOffer.Get()));
-        tagOffer->add_attribute(
-            "dateAdded", formatTimestamp(pOffer->GetDateAddedToMarket()));
-        tag.add_tag(tagOffer);
-    }
+                TagPtr tagOffer(new Tag("offer", ascOffer.Get()));
+                tagOffer->add_attribute(
+                    "dateAdded",
+                    formatTimestamp(pOffer->GetDateAddedToMarket()));
+                tag.add_tag(tagOffer);
+            }
+        }
+    };
 
-    std::string str_result;
-    tag.output(str_result);
+    // Save the offers for sale.
+    add_offers(m_mapAsks);
+    // Save the bids. Each price level is written in the order the offers
+    // were added, so they are first in line again when the market is loaded.
+    add_offers(m_mapBids);
 
-    m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    tag.output(m_xmlUnsigned);
 }
 
 std::int64_t OTMarket::GetTotalAvailableAssets()
 {
     std::int64_t lTotal = 0;
 
-    for (auto& it : m_mapAsks) {
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
-
-        lTotal += pOffer->GetAmountAvailable();
-    }
+    for (const auto& level : m_mapAsks) { lTotal += level.second.depth_; }
 
     return lTotal;
 }
@@ -375,67 +597,44 @@ bool OTMarket::GetRecentTradeList(Armored& ascOutput, std::int32_t& nTradeCount)
     nTradeCount = 0;  // Output the count of trades in the list being returned.
                       // (If success..)
 
-    if (nullptr == m_pTradeList) {
-        //      otErr << "OTMarket::GetRecentTradeList: m_pTradeList is nullptr.
-        // \n";
-        return true;
-        // Returning true, since it's normal for this to be nullptr when the
-        // list
-        // is empty.
-    }
-
     // The market already keeps a list of recent trades (informational only)
-    //
-
-    const size_t sizeList = m_pTradeList->GetTradeDataMarketCount();
-    nTradeCount = static_cast<std::int32_t>(sizeList);
-
-    if (nTradeCount == 0)
-        return true;  // Success, but there are 0 trade datas to return. (empty
-                      // list.)
-
-    // So now, let's pack the list into strOutput...
-    else if (nTradeCount > 0) {
-        OTDB::Storage* pStorage = OTDB::GetDefaultStorage();
-        OT_ASSERT(nullptr != pStorage);
+    // which was packed when the current snapshot was published.
+    const auto snapshot = std::atomic_load(&m_pSnapshot);
 
-        OTDB::OTPacker* pPacker =
-            pStorage->GetPacker();  // No need to check for failure, since this
-                                    // already ASSERTS. No need to cleanup
-                                    // either.
+    OT_ASSERT(snapshot);
 
-        std::unique_ptr<OTDB::PackedBuffer> pBuffer(pPacker->Pack(
-            *m_pTradeList));  // Now we PACK our market's recent trades list.
+    if (false == snapshot->trades_valid_) { return false; }
 
-        if (nullptr == pBuffer) {
-            otErr << "Failed packing pTradeList in OTCron::GetRecentTradeList. "
-                     "\n";
-            return false;
-        }
-
-        // Now we need to translate pBuffer into strOutput.
+    nTradeCount = snapshot->trade_count_;
 
-        const std::uint8_t* pUint = pBuffer->GetData();
-        const size_t theSize = pBuffer->GetSize();
+    if (0 < nTradeCount) { ascOutput.Set(snapshot->trades_.c_str()); }
 
-        if ((nullptr != pUint) || (theSize < 2)) {
-            auto theData =
-                Data::Factory(pUint, static_cast<std::uint32_t>(theSize));
-
-            // This function will base64 ENCODE theData,
-            // and then Set() that as the string contents.
-            ascOutput.SetData(theData);
+    // Returning true with zero trades, since it's normal for the list to be
+    // empty.
+    return true;
+}
 
-            return true;
-        } else
-            otErr << "Error while getting buffer data in "
-                     "OTMarket::GetRecentTradeList.\n";
-    } else
-        otErr << "Error: nTradeCount with negative value in "
-                 "OTMarket::GetRecentTradeList: "
-              << nTradeCount << ".\n";
+bool OTMarket::GetMarketData(OTDB::MarketData& output) const
+{
+    const auto snapshot = std::atomic_load(&m_pSnapshot);
+
+    if (false == bool(snapshot)) { return false; }
+
+    const auto& summary = snapshot->summary_;
+    output.market_id = summary.market_id_;
+    output.notary_id = summary.notary_id_;
+    output.instrument_definition_id = summary.unit_id_;
+    output.currency_type_id = summary.currency_id_;
+    output.scale = to_string<std::int64_t>(summary.scale_);
+    output.current_bid = to_string<std::uint64_t>(summary.current_bid_);
+    output.current_ask = to_string<std::uint64_t>(summary.current_ask_);
+    output.last_sale_price = to_string<std::int64_t>(summary.last_sale_price_);
+    output.last_sale_date = summary.last_sale_date_;
+    output.total_assets = to_string<std::int64_t>(summary.total_assets_);
+    output.number_bids = to_string<mapOfOffers::size_type>(summary.bid_count_);
+    output.number_asks = to_string<mapOfOffers::size_type>(summary.ask_count_);
 
-    return false;
+    return true;
 }
 
 // OTDB::OfferListMarket
@@ -449,145 +648,21 @@ bool OTMarket::GetOfferList(
 
     if (0 == lDepth) lDepth = MAX_MARKET_QUERY_DEPTH;
 
-    // Loop through the offers, up to some maximum depth, and then add each
-    // as a data member to an offer list, then pack it into ascOutput.
-
-    std::unique_ptr<OTDB::OfferListMarket> pOfferList(
-        dynamic_cast<OTDB::OfferListMarket*>(
-            OTDB::CreateObject(OTDB::STORED_OBJ_OFFER_LIST_MARKET)));
-
-    //    mapOfOffers            m_mapBids;        // The buyers, ordered by
-    // price limit
-    //    mapOfOffers            m_mapAsks;        // The sellers, ordered by
-    // price limit
-
-    std::int32_t nTempDepth = 0;
-
-    for (auto& it : m_mapBids) {
-        if (nTempDepth++ > lDepth) break;
-
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
-
-        const std::int64_t& lPriceLimit = pOffer->GetPriceLimit();
-
-        if (0 == lPriceLimit)  // Skipping any market orders.
-            continue;
-
-        // OfferDataMarket
-        std::unique_ptr<OTDB::BidData> pOfferData(dynamic_cast<OTDB::BidData*>(
-            OTDB::CreateObject(OTDB::STORED_OBJ_BID_DATA)));
-
-        const std::int64_t& lTransactionNum = pOffer->GetTransactionNum();
-        const std::int64_t lAvailableAssets = pOffer->GetAmountAvailable();
-        const std::int64_t& lMinimumIncrement = pOffer->GetMinimumIncrement();
-        const time64_t tDateAddedToMarket = pOffer->GetDateAddedToMarket();
-
-        pOfferData->transaction_id = to_string<std::int64_t>(lTransactionNum);
-        pOfferData->price_per_scale = to_string<std::int64_t>(lPriceLimit);
-        pOfferData->available_assets =
-            to_string<std::int64_t>(lAvailableAssets);
-        pOfferData->minimum_increment =
-            to_string<std::int64_t>(lMinimumIncrement);
-        pOfferData->date = to_string<time64_t>(tDateAddedToMarket);
-
-        // *pOfferData is CLONED at this time (I'm still responsible to delete.)
-        // That's also why I add it here, below: So the data is set right before
-        // the cloning occurs.
-        //
-        pOfferList->AddBidData(*pOfferData);
-        nOfferCount++;
-    }
-
-    nTempDepth = 0;
-
-    for (auto& it : m_mapAsks) {
-        if (nTempDepth++ > lDepth) break;
-
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
-
-        // OfferDataMarket
-        std::unique_ptr<OTDB::AskData> pOfferData(dynamic_cast<OTDB::AskData*>(
-            OTDB::CreateObject(OTDB::STORED_OBJ_ASK_DATA)));
-
-        const std::int64_t& lTransactionNum = pOffer->GetTransactionNum();
-        const std::int64_t& lPriceLimit = pOffer->GetPriceLimit();
-        const std::int64_t lAvailableAssets = pOffer->GetAmountAvailable();
-        const std::int64_t& lMinimumIncrement = pOffer->GetMinimumIncrement();
-        const time64_t tDateAddedToMarket = pOffer->GetDateAddedToMarket();
-
-        pOfferData->transaction_id = to_string<std::int64_t>(lTransactionNum);
-        pOfferData->price_per_scale = to_string<std::int64_t>(lPriceLimit);
-        pOfferData->available_assets =
-            to_string<std::int64_t>(lAvailableAssets);
-        pOfferData->minimum_increment =
-            to_string<std::int64_t>(lMinimumIncrement);
-        pOfferData->date = to_string<time64_t>(tDateAddedToMarket);
-
-        // *pOfferData is CLONED at this time (I'm still responsible to delete.)
-        // That's also why I add it here, below: So the data is set right before
-        // the cloning occurs.
-        //
-        pOfferList->AddAskData(*pOfferData);
-        nOfferCount++;
-    }
-
-    // Now pack the list into strOutput...
-
-    if (nOfferCount == 0)
-        return true;  // Success, but there were zero offers found.
-
-    if (nOfferCount > 0) {
-        OTDB::Storage* pStorage = OTDB::GetDefaultStorage();
-        OT_ASSERT(nullptr != pStorage);
+    // The offers, up to some maximum depth, are read from the most recently
+    // published snapshot, which caches the packed reply for each depth.
+    const auto snapshot = std::atomic_load(&m_pSnapshot);
 
-        OTDB::OTPacker* pPacker =
-            pStorage->GetPacker();  // No need to check for failure, since this
-                                    // already ASSERTS. No need to cleanup
-                                    // either.
-
-        std::unique_ptr<OTDB::PackedBuffer> pBuffer(pPacker->Pack(
-            *pOfferList));  // Now we PACK our market's offer list.
-
-        if (nullptr == pBuffer) {
-            otErr << "Failed packing pOfferList in OTCron::GetOfferList. \n";
-            return false;
-        }
-
-        // Now we need to translate pBuffer into strOutput.
-
-        const std::uint8_t* pUint = pBuffer->GetData();
-        const size_t theSize = pBuffer->GetSize();
-
-        if (nullptr != pUint) {
-            auto theData =
-                Data::Factory(pUint, static_cast<std::uint32_t>(theSize));
-            // This function will base64 ENCODE theData,
-            // and then Set() that as the string contents.
-            ascOutput.SetData(theData);
-
-            return true;
-        } else
-            otErr << "Error while getting buffer data in "
-                     "OTMarket::GetOfferList.\n";
-    } else
-        otErr << "invalid: nOfferCount is < 0 in OTMarket::GetOfferList.\n";
+    OT_ASSERT(snapshot);
 
-    return false;
+    return snapshot->OfferList(lDepth, ascOutput, nOfferCount);
 }
 
-// To insure that offers of a specific price are always inserted at the upper
-// bound,
-// use this:  my_mmap.insert(my_mmap.upper_bound(key), my_mmap::value_type(key,
-// val));
-// This way I can read them from the lower bound later, and always get them in
-// the
-// order received for that price.
+// Offers of a specific price are always appended to the back of the queue for
+// that price level. This way I can read them from the front later, and always
+// get them in the order received for that price.
 //
-// typedef std::multimap<std::int64_t, OTOffer *>    mapOfOffers;
-// mapOfOffers    m_mapBids; // The buyers, ordered
-// mapOfOffers    m_mapAsks; // The sellers, ordered
+// mapOfPriceLevels    m_mapBids; // The buyers, ordered
+// mapOfPriceLevels    m_mapAsks; // The sellers, ordered
 
 OTOffer* OTMarket::GetOffer(const std::int64_t& lTransactionNum)
 {
@@ -642,36 +717,9 @@ bool OTMarket::RemoveOffer(const std::int64_t& lTransactionNum)  // if false,
         // But it's still on one of the other lists...
         m_mapOffers.erase(it);
 
-        // The code operates the same whether ask or bid. Just use a pointer.
-        mapOfOffers* pMap = (pOffer->IsBid() ? &m_mapBids : &m_mapAsks);
-
-        // Future solution here: instead of looping through all the offers and
-        // finding it,
-        // I could just have each Offer store a copy of the iterator that's
-        // returned when
-        // it's first inserted. Later I just erase that iterator from the right
-        // list to remove. Todo.
-        OTOffer* pSameOffer = nullptr;
-
-        for (mapOfOffers::iterator iii = pMap->begin(); iii != pMap->end();
-             ++iii) {
-            pSameOffer = iii->second;
-
-            OT_ASSERT_MSG(
-                nullptr != pSameOffer,
-                "nullptr offer pointer in OTMarket::RemoveOffer.\n");
-
-            // found it!
-            if (lTransactionNum == pSameOffer->GetTransactionNum()) {
-                pMap->erase(iii);
-                break;
-            }
-
-            // Later on, below this loop, this pointer will be nullptr or not,
-            // and
-            // I will know if it was removed.
-            pSameOffer = nullptr;
-        }
+        // The price level is found directly from the price limit, so only
+        // the offers at the same price have to be searched.
+        OTOffer* pSameOffer = remove_from_level(*pOffer) ? pOffer : nullptr;
 
         if (nullptr == pSameOffer) {
             otErr << "Removed Offer from offers list, but not found on bid/ask "
@@ -759,20 +807,22 @@ bool OTMarket::AddOffer(
             // No bother checking if the offer is already on this list,
             // since the code above basically already verifies that for us.
 
-            m_mapBids.insert(
-                m_mapBids.lower_bound(lPriceLimit),  // highest bidders go
-                                                     // first, so I am last in
-                                                     // line at lower bound.
-                std::pair<std::int64_t, OTOffer*>(lPriceLimit, &theOffer));
+            // Highest bidders go first, and within a price level I am last in
+            // line.
+            auto& level = m_mapBids[lPriceLimit];
+            level.offers_.push_back(&theOffer);
+            level.depth_ += theOffer.GetAmountAvailable();
+            ++m_lBidCount;
             LogTrace(OT_METHOD)(__FUNCTION__)(
                 "Offer added as a bid to the market.")
                 .Flush();
         } else {
-            m_mapAsks.insert(
-                m_mapAsks.upper_bound(lPriceLimit),  // lowest price sells
-                                                     // first, so I am last in
-                                                     // line at upper bound.
-                std::pair<std::int64_t, OTOffer*>(lPriceLimit, &theOffer));
+            // Lowest price sells first, and within a price level I am last in
+            // line.
+            auto& level = m_mapAsks[lPriceLimit];
+            level.offers_.push_back(&theOffer);
+            level.depth_ += theOffer.GetAmountAvailable();
+            ++m_lAskCount;
             LogTrace(OT_METHOD)(__FUNCTION__)(
                 "Offer added as an ask to the market.")
                 .Flush();
@@ -800,23 +850,48 @@ bool OTMarket::AddOffer(
     return false;
 }
 
-bool OTMarket::LoadMarket()
+void OTMarket::adjust_depth(const OTOffer& theOffer, const std::int64_t lAmount)
+{
+    if (0 == lAmount) { return; }
+
+    auto& levels = theOffer.IsBid() ? m_mapBids : m_mapAsks;
+    auto it = levels.find(theOffer.GetPriceLimit());
+
+    if (levels.end() != it) { it->second.depth_ += lAmount; }
+}
+
+bool OTMarket::LoadMarket() { return ReadMarket() && ParseMarket(); }
+
+bool OTMarket::ParseMarket()
 {
     OT_ASSERT(nullptr != GetCron());
     OT_ASSERT(nullptr != GetCron()->GetServerNym());
 
+    bool bSuccess = ParseRawFile();
+
+    if (bSuccess) bSuccess = VerifySignature(*(GetCron()->GetServerNym()));
+
+    publish_snapshot();
+
+    return bSuccess;
+}
+
+bool OTMarket::ReadMarket()
+{
     auto MARKET_ID = Identifier::Factory(*this);
     auto str_MARKET_ID = String::Factory(MARKET_ID);
 
     const char* szFoldername = OTFolders::Market().Get();
     const char* szFilename = str_MARKET_ID->Get();
 
+    Release();
+    m_strFoldername->Set(szFoldername);
+    m_strFilename->Set(szFilename);
+
     bool bSuccess =
         OTDB::Exists(api_.DataFolder(), szFoldername, szFilename, "", "");
 
-    if (bSuccess) bSuccess = LoadContract(szFoldername, szFilename);  // todo ??
-
-    if (bSuccess) bSuccess = VerifySignature(*(GetCron()->GetServerNym()));
+    if (bSuccess) bSuccess = LoadContractRawFile();
 
     // Load the list of recent market trades (informational only.)
     //
@@ -851,6 +926,10 @@ bool OTMarket::SaveMarket()
     const char* szFoldername = OTFolders::Market().Get();
     const char* szFilename = str_MARKET_ID->Get();
 
+    // Market data queries are answered from the snapshot, so publish the
+    // changes before saving them.
+    publish_snapshot();
+
     // Remember, if the market has changed, the new contents will not be written
     // anywhere
     // until that market has been signed. So I have to re-sign here, or it would
@@ -920,7 +999,7 @@ std::int64_t OTMarket::GetHighestBidPrice()
 {
     std::int64_t lPrice = 0;
 
-    mapOfOffers::reverse_iterator rr = m_mapBids.rbegin();
+    auto rr = m_mapBids.rbegin();
 
     if (rr != m_mapBids.rend()) { lPrice = rr->first; }
 
@@ -935,27 +1014,126 @@ std::int64_t OTMarket::GetLowestAskPrice()
 
     auto it = m_mapAsks.begin();
 
-    if (it != m_mapAsks.end()) {
-        lPrice = it->first;
+    // Market orders have a 0 price, so we need to skip them if they are
+    // here. They all share a single price level.
+    //
+    // Note that we don't have to do this with the highest bid price (above
+    // function) but in the case of asks, a "0 price" will undercut the other
+    // actual prices, so we need to skip any that have a 0 price.
+    //
+    if ((it != m_mapAsks.end()) && (0 == it->first)) { ++it; }
 
-        // Market orders have a 0 price, so we need to skip any if they are
-        // here.
-        //
-        // Note that we don't have to do this with the highest bid price (above
-        // function) but in the case of asks, a "0 price" will undercut the
-        // other
-        // actual prices, so we need to skip any that have a 0 price.
-        //
-        while (0 == lPrice) {
-            ++it;
+    if (it != m_mapAsks.end()) { lPrice = it->first; }
 
-            if (it == m_mapAsks.end()) break;
+    return lPrice;
+}
 
-            lPrice = it->first;
+void OTMarket::publish_snapshot()
+{
+    std::vector<Snapshot::Offer> bids{};
+    std::vector<Snapshot::Offer> asks{};
+    bids.reserve(m_lBidCount);
+    asks.reserve(m_lAskCount);
+    auto copy = [](const mapOfPriceLevels& levels,
+                   std::vector<Snapshot::Offer>& output) -> void {
+        for (const auto& level : levels) {
+            for (const auto& pOffer : level.second.offers_) {
+                OT_ASSERT(nullptr != pOffer);
+
+                output.push_back({pOffer->GetTransactionNum(),
+                                  pOffer->GetPriceLimit(),
+                                  pOffer->GetAmountAvailable(),
+                                  pOffer->GetMinimumIncrement(),
+                                  pOffer->GetDateAddedToMarket()});
+            }
         }
+    };
+    copy(m_mapBids, bids);
+    copy(m_mapAsks, asks);
+    bool tradesValid{true};
+    std::int32_t tradeCount{0};
+    std::string trades{};
+
+    if (nullptr != m_pTradeList) {
+        tradeCount =
+            static_cast<std::int32_t>(m_pTradeList->GetTradeDataMarketCount());
     }
 
-    return lPrice;
+    if (0 < tradeCount) {
+        OTDB::Storage* pStorage = OTDB::GetDefaultStorage();
+
+        OT_ASSERT(nullptr != pStorage);
+
+        // No need to check for failure, since this already ASSERTS.
+        OTDB::OTPacker* pPacker = pStorage->GetPacker();
+        // Now we PACK our market's recent trades list.
+        std::unique_ptr<OTDB::PackedBuffer> pBuffer(
+            pPacker->Pack(*m_pTradeList));
+
+        if ((nullptr == pBuffer) || (nullptr == pBuffer->GetData())) {
+            otErr << "Failed packing pTradeList in OTMarket::"
+                  << __FUNCTION__ << ".\n";
+            tradesValid = false;
+        } else {
+            auto theData = Data::Factory(
+                pBuffer->GetData(),
+                static_cast<std::uint32_t>(pBuffer->GetSize()));
+            Armored ascTrades;
+            // This function will base64 ENCODE theData.
+            ascTrades.SetData(theData);
+            trades = ascTrades.Get();
+        }
+    }
+
+    Snapshot::Summary summary{};
+    summary.market_id_ = String::Factory(Identifier::Factory(*this))->Get();
+    summary.notary_id_ = String::Factory(GetNotaryID())->Get();
+    summary.unit_id_ = String::Factory(GetInstrumentDefinitionID())->Get();
+    summary.currency_id_ = String::Factory(GetCurrencyID())->Get();
+    summary.scale_ = GetScale();
+    summary.current_bid_ = GetHighestBidPrice();
+    summary.current_ask_ = GetLowestAskPrice();
+    summary.last_sale_price_ = GetLastSalePrice();
+    summary.last_sale_date_ = GetLastSaleDate();
+    summary.total_assets_ = GetTotalAvailableAssets();
+    summary.bid_count_ = m_lBidCount;
+    summary.ask_count_ = m_lAskCount;
+    std::shared_ptr<const Snapshot> snapshot{new Snapshot(
+        ++m_lSnapshotVersion,
+        std::move(summary),
+        std::move(bids),
+        std::move(asks),
+        tradesValid,
+        tradeCount,
+        std::move(trades))};
+    std::atomic_store(&m_pSnapshot, snapshot);
+}
+
+bool OTMarket::remove_from_level(OTOffer& theOffer)
+{
+    auto& levels = theOffer.IsBid() ? m_mapBids : m_mapAsks;
+    auto it = levels.find(theOffer.GetPriceLimit());
+
+    if (levels.end() == it) { return false; }
+
+    auto& level = it->second;
+    auto& offers = level.offers_;
+    auto offer = std::find(offers.begin(), offers.end(), &theOffer);
+
+    if (offers.end() == offer) { return false; }
+
+    offers.erase(offer);
+    level.depth_ -= theOffer.GetAmountAvailable();
+
+    if (offers.empty()) { levels.erase(it); }
+
+    if (theOffer.IsBid()) {
+        --m_lBidCount;
+    } else {
+        --m_lAskCount;
+    }
+
+    return true;
 }
 
 // This utility function is used directly below (only).
@@ -1905,11 +2083,15 @@ void OTMarket::ProcessTrade(
                 // that we just processed. Make sure to save the Market
                 // since it contains those offers that have just
                 // updated.
-                SaveMarket();
-
+                //
                 // The Trade has changed, and it is stored as a
                 // CronItem. So I save Cron as well, for the same reason
                 // I saved the Market.
+                //
+                // Both are saved with every fill, together with the
+                // account receipts, so that a crash in the middle of a
+                // crossing run can not execute the same fill again.
+                SaveMarket();
                 pCron->SaveCron();
             }
 
@@ -2385,201 +2567,146 @@ bool OTMarket::ProcessTrade(
     // (whichever the current trade cares about) in the market WITHIN
     // THIS TRADE'S PRICE LIMITS. So we're going to go up the list of
     // what's available, and trade.
+    return match_offer(wallet, theTrade, theOffer);
+}
+
+bool OTMarket::match_offer(
+    const api::Wallet& wallet,
+    OTTrade& theTrade,
+    OTOffer& theOffer)
+{
+    // The offer has no more trading to do--it's done.
+    auto finished = [&]() -> bool {
+        if (theTrade.IsFlaggedForRemoval() ||  // during processing, the
+                                               // trade may have gotten
+                                               // flagged.
+            (theOffer.GetMinimumIncrement() > theOffer.GetAmountAvailable())) {
+
+            otInfo << "OTMarket::" << __FUNCTION__
+                   << ": Removing market order: "
+                   << formatLong(theTrade.GetOpeningNum())
+                   << ". IsFlaggedForRemoval: "
+                   << formatBool(theTrade.IsFlaggedForRemoval())
+                   << ". Minimum increment is larger than Amount "
+                      "available: "
+                   << (theOffer.GetMinimumIncrement() >
+                       theOffer.GetAmountAvailable())
+                   << "\n";
+
+            return true;
+        }
+
+        return false;
+    };
+    // Trades against one offer on the other side of the market, and keeps
+    // the depth of both price levels up to date.
+    auto trade = [&](PriceLevel& level, OTOffer& theOtherOffer) -> void {
+        if ((theOtherOffer.GetAmountAvailable() >=
+             theOffer.GetMinimumIncrement()) &&
+            (theOffer.GetAmountAvailable() >=
+             theOtherOffer.GetMinimumIncrement()) &&
+            (nullptr != theOtherOffer.GetTrade()) &&
+            !theOtherOffer.GetTrade()->IsFlaggedForRemoval()) {
+            const auto lOtherAvailable = theOtherOffer.GetAmountAvailable();
+            const auto lAvailable = theOffer.GetAmountAvailable();
+
+            ProcessTrade(wallet, theTrade, theOffer, theOtherOffer);
+
+            level.depth_ -=
+                (lOtherAvailable - theOtherOffer.GetAmountAvailable());
+            adjust_depth(
+                theOffer, (theOffer.GetAmountAvailable() - lAvailable));
+        }
+    };
 
     if (theOffer.IsAsk())  // If I'm selling,
     {
-        // rbegin puts us on the upper bound of the highest bidder (any
-        // new bidders at the same price would be added at the lower
-        // bound, where they are last in line.) The upper bound, on the
-        // other hand, is first in line.  So we start there, and loop
-        // backwards until there are no other bids within my price
-        // range.
-        for (mapOfOffers::reverse_iterator rr = m_mapBids.rbegin();
-             rr != m_mapBids.rend();
-             ++rr) {
-            // then I want to start at the highest bidder and loop DOWN
-            // until hitting my price limit.
-            OTOffer* pBid = rr->second;
-            OT_ASSERT(nullptr != pBid);
+        // rbegin puts us on the price level of the highest bidder. Within
+        // a level the offer at the front is first in line (any new bidders
+        // at the same price are added at the back.) So we start there, and
+        // loop down through the levels until there are no other bids within
+        // my price range.
+        for (auto rr = m_mapBids.rbegin(); rr != m_mapBids.rend(); ++rr) {
+            const std::int64_t lPrice = rr->first;
+            auto& level = rr->second;
 
             // NOTE: Market orders only process once, and they are
             // processed in the order they were added to the market.
             //
-            // If BOTH offers are market orders, we just skip this bid.
-            //
-            // But FURTHERMORE: We ONLY process a market order as
-            // theOffer, not as pBid! Imagine if pBid is a market order
-            // and theOffer isn't -- that would mean pBid hasn't been
-            // processed yet (since it will only process once.) So it
-            // needs to wait its turn! It will get its one shot WHEN ITS
-            // TURN comes.
+            // We ONLY process a market order as theOffer, not as a bid!
+            // Imagine if the bid is a market order and theOffer isn't --
+            // that would mean the bid hasn't been processed yet (since it
+            // will only process once.) So it needs to wait its turn! It
+            // will get its one shot WHEN ITS TURN comes.
             //
-            if (pBid->IsMarketOrder())
-                //          if (theOffer.IsMarketOrder() &&
-                // pBid->IsMarketOrder())
-                //              continue;
-                break;
-            // NOTE: Why break, instead of continue? Because since we
-            // are looping through the bids, from the HIGHEST down to
-            // the LOWEST, and since market orders have a ZERO price, we
-            // know for a fact that there are not any other non-zero
-            // bids. (So we might as well break.)
-
-            // I'm selling.
+            // Since market orders have a ZERO price, they are all on the
+            // lowest level, and we know for a fact that there are not any
+            // other non-zero bids. (So we might as well break.)
+            if (0 == lPrice) { break; }
+
+            // If the bid is lower than I am willing to sell, (and all the
+            // remaining bids are even lower), stay on cron for more
+            // processing (for now.)
             //
-            // If the bid is larger than, or equal to, my
-            // low-side-limit, and the amount available is at least my
-            // minimum increment, (and vice versa),
-            // ...then let's trade!
-            //
-            if (theOffer.IsMarketOrder() ||  // If I don't care about
-                                             // price...
-                (pBid->GetPriceLimit() >=
-                 theOffer.GetPriceLimit()))  // Or if this bid is within
-                                             // my price range...
-            {
-                // Notice the above "if" is ONLY based on price...
-                // because the "else" returns! (Once I am out of my
-                // price range, no point to continue looping.)
-                //
-                // ...So all the other "if"s have to go INSIDE the block
-                // here:
-                //
-                if ((pBid->GetAmountAvailable() >=
-                     theOffer.GetMinimumIncrement()) &&
-                    (theOffer.GetAmountAvailable() >=
-                     pBid->GetMinimumIncrement()) &&
-                    (nullptr != pBid->GetTrade()) &&
-                    !pBid->GetTrade()->IsFlaggedForRemoval())
-
-                    ProcessTrade(
-                        wallet,
-                        theTrade,
-                        theOffer,
-                        *pBid);  // <========
-            }
+            // Market orders don't care about price.
+            if (theOffer.IsLimitOrder() &&
+                (lPrice < theOffer.GetPriceLimit())) {
 
-            // Else, the bid is lower than I am willing to sell. (And
-            // all the remaining bids are even lower.)
-            //
-            else if (theOffer.IsLimitOrder()) {
-                pBid = nullptr;
-                return true;  // stay on cron for more processing (for
-                              // now.)
+                return true;
             }
 
-            // The offer has no more trading to do--it's done.
-            if (theTrade.IsFlaggedForRemoval() ||  // during processing,
-                                                   // the trade may have
-                                                   // gotten flagged.
-                (theOffer.GetMinimumIncrement() >
-                 theOffer.GetAmountAvailable())) {
-
-                otInfo << "OTMarket::" << __FUNCTION__
-                       << ": Removing market order: "
-                       << formatLong(theTrade.GetOpeningNum())
-                       << ". IsFlaggedForRemoval: "
-                       << formatBool(theTrade.IsFlaggedForRemoval())
-                       << ". Minimum increment is larger than Amount "
-                          "available: "
-                       << (theOffer.GetMinimumIncrement() >
-                           theOffer.GetAmountAvailable())
-                       << "\n";
-
-                return false;  // remove this trade from cron
-            }
+            for (auto& pBid : level.offers_) {
+                OT_ASSERT(nullptr != pBid);
+
+                trade(level, *pBid);
 
-            pBid = nullptr;
+                if (finished()) {
+
+                    return false;  // remove this trade from cron
+                }
+            }
         }
     }
     // I'm buying
     else {
-        // Begin puts us on the lower bound of the lowest seller (any
-        // new sellers at the same price would be added at the upper
-        // bound for that price, where they are last in line.) The lower
-        // bound, on the other hand, is first in line.  So we start
-        // there, and loop forwards until there are no other asks within
+        // begin puts us on the price level of the lowest seller. Within a
+        // level the offer at the front is first in line (any new sellers at
+        // the same price are added at the back.) So we start there, and
+        // loop up through the levels until there are no other asks within
         // my price range.
-        //
         for (auto& it : m_mapAsks) {
-            // then I want to start at the lowest seller and loop UP
-            // until hitting my price limit.
-            OTOffer* pAsk = it.second;
-            OT_ASSERT(nullptr != pAsk);
+            const std::int64_t lPrice = it.first;
+            auto& level = it.second;
 
             // NOTE: Market orders only process once, and they are
             // processed in the order they were added to the market.
             //
-            // If BOTH offers are market orders, we just skip this ask.
-            //
-            // But FURTHERMORE: We ONLY process a market order as
-            // theOffer, not as pAsk! Imagine if pAsk is a market order
-            // and theOffer isn't -- that would mean pAsk hasn't been
-            // processed yet (since it will only process once.) So it
-            // needs to wait its turn! It will get its one shot WHEN ITS
-            // TURN comes.
-            //
-            if (pAsk->IsMarketOrder())
-                //          if (theOffer.IsMarketOrder() &&
-                // pAsk->IsMarketOrder())
-                continue;
-
-            // I'm buying.
-            // If the ask price is less than, or equal to, my price
-            // limit, and the amount available for purchase is at least
-            // my minimum increment, (and vice versa),
-            // ...then let's trade!
+            // We ONLY process a market order as theOffer, not as an ask!
+            // (See above.) Market orders all share the lowest (zero) price
+            // level, so that level is skipped.
+            if (0 == lPrice) { continue; }
+
+            // If the ask price is higher than I am willing to pay, (and all
+            // the remaining sellers are even HIGHER), stay on the market for
+            // now.
             //
-            if (theOffer.IsMarketOrder() ||  // If I don't care about
-                                             // price...
-                (pAsk->GetPriceLimit() <=
-                 theOffer.GetPriceLimit()))  // Or if this ask is within
-                                             // my price range...
-            {
-                // Notice the above "if" is ONLY based on price...
-                // because the "else" returns! (Once I am out of my
-                // price range, no point to continue looping.) So all
-                // the other "if"s have to go INSIDE the block here:
-                //
-                if ((pAsk->GetAmountAvailable() >=
-                     theOffer.GetMinimumIncrement()) &&
-                    (theOffer.GetAmountAvailable() >=
-                     pAsk->GetMinimumIncrement()) &&
-                    (nullptr != pAsk->GetTrade()) &&
-                    !pAsk->GetTrade()->IsFlaggedForRemoval())
-
-                    ProcessTrade(
-                        wallet, theTrade, theOffer, *pAsk);  // <=======
-            }
-            // Else, the ask price is higher than I am willing to pay.
-            // (And all the remaining sellers are even HIGHER.)
-            else if (theOffer.IsLimitOrder()) {
-                pAsk = nullptr;
-                return true;  // stay on the market for now.
-            }
+            // Market orders don't care about price.
+            if (theOffer.IsLimitOrder() &&
+                (lPrice > theOffer.GetPriceLimit())) {
 
-            // The offer has no more trading to do--it's done.
-            if (theTrade.IsFlaggedForRemoval() ||  // during processing,
-                                                   // the trade may have
-                                                   // gotten flagged.
-                (theOffer.GetMinimumIncrement() >
-                 theOffer.GetAmountAvailable())) {
-
-                otInfo << "OTMarket::" << __FUNCTION__
-                       << ": Removing market order: "
-                       << formatLong(theTrade.GetOpeningNum())
-                       << ". IsFlaggedForRemoval: "
-                       << formatBool(theTrade.IsFlaggedForRemoval())
-                       << ". Minimum increment is larger than Amount "
-                          "available: "
-                       << (theOffer.GetMinimumIncrement() >
-                           theOffer.GetAmountAvailable())
-                       << "\n";
-
-                return false;  // remove this trade from the market.
+                return true;
             }
 
-            pAsk = nullptr;
+            for (auto& pAsk : level.offers_) {
+                OT_ASSERT(nullptr != pAsk);
+
+                trade(level, *pAsk);
+
+                if (finished()) {
+
+                    return false;  // remove this trade from the market.
+                }
+            }
         }
     }
 
@@ -2692,18 +2819,20 @@ void OTMarket::Release_Market()
 
     // If there were any dynamically allocated objects, clean them up
     // here.
-    while (!m_mapBids.empty()) {
-        OTOffer* pOffer = m_mapBids.begin()->second;
-        m_mapBids.erase(m_mapBids.begin());
-        delete pOffer;
-        pOffer = nullptr;
-    }
-    while (!m_mapAsks.empty()) {
-        OTOffer* pOffer = m_mapAsks.begin()->second;
-        m_mapAsks.erase(m_mapAsks.begin());
-        delete pOffer;
-        pOffer = nullptr;
+    for (auto* pLevels : {&m_mapBids, &m_mapAsks}) {
+        for (auto& level : *pLevels) {
+            for (auto& pOffer : level.second.offers_) {
+                delete pOffer;
+                pOffer = nullptr;
+            }
+        }
+
+        pLevels->clear();
     }
+
+    m_mapOffers.clear();
+    m_lBidCount = 0;
+    m_lAskCount = 0;
 }
 
 void OTMarket::Release()
@@ -303,10 +303,7 @@ void OTTrade::UpdateContents()
         tag.add_tag("offer", ascOffer.Get());
     }
 
-    std::string str_result;
-    tag.output(str_result);
-
-    m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    tag.output(m_xmlUnsigned);
 }
 
 // The trade stores a copy of the Offer in string form.
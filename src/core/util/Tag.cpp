@@ -7,6 +7,8 @@
 
 #include "opentxs/core/util/Tag.hpp"
 
+#include "opentxs/core/String.hpp"
+
 #include <memory>
 #include <string>
 #include <utility>
@@ -33,16 +35,30 @@ void Tag::add_attribute(
     attributes_.insert(temp);
 }
 
-void Tag::output(std::string& str_output) const { outputXML(str_output); }
+void Tag::output(std::string& str_output) const
+{
+    str_output.reserve(str_output.size() + size_hint());
+    outputXML(str_output);
+}
 
-void Tag::outputXML(std::string& str_output) const
+void Tag::output(String& output) const
 {
-    str_output += ("<" + name_);
+    std::string str_output{};
+    this->output(str_output);
+    output.Concatenate(str_output);
+}
 
-    if (!attributes_.empty()) {
-        for (auto& kv : attributes_) {
-            str_output += ("\n " + kv.first + "=\"" + kv.second + "\"");
-        }
+void Tag::outputXML(std::string& str_output) const
+{
+    str_output += '<';
+    str_output += name_;
+
+    for (auto& kv : attributes_) {
+        str_output += "\n ";
+        str_output += kv.first;
+        str_output += "=\"";
+        str_output += kv.second;
+        str_output += '"';
     }
 
     if (text_.empty() && tags_.empty()) {
@@ -53,11 +69,37 @@ void Tag::outputXML(std::string& str_output) const
         if (!text_.empty()) {
             str_output += text_;
         } else if (!tags_.empty()) {
-            for (auto& kv : tags_) { kv->output(str_output); }
+            for (auto& kv : tags_) { kv->outputXML(str_output); }
         }
 
-        str_output += ("\n</" + name_ + ">\n");
+        str_output += "\n</";
+        str_output += name_;
+        str_output += ">\n";
+    }
+}
+
+std::size_t Tag::size_hint() const
+{
+    // "<" + name
+    std::size_t output = 1 + name_.size();
+
+    // "\n " + key + "=\"" + value + "\""
+    for (auto& kv : attributes_) {
+        output += 5 + kv.first.size() + kv.second.size();
+    }
+
+    if (text_.empty() && tags_.empty()) { return output + 4; }
+
+    // ">\n" ... "\n</" + name + ">\n"
+    output += 2 + 3 + name_.size() + 2;
+
+    if (!text_.empty()) {
+        output += text_.size();
+    } else {
+        for (auto& kv : tags_) { output += kv->size_hint(); }
     }
+
+    return output;
 }
 
 void Tag::add_tag(TagPtr& tag_input) { tags_.push_back(tag_input); }
@@ -8,6 +8,7 @@
 #include "opentxs/api/crypto/Crypto.hpp"
 #include "opentxs/api/crypto/Util.hpp"
 #include "opentxs/api/Native.hpp"
+#include "opentxs/core/crypto/LowLevelKeyGenerator.hpp"
 #include "opentxs/core/crypto/NymParameters.hpp"
 #include "opentxs/core/crypto/OTCachedKey.hpp"
 #include "opentxs/core/crypto/OTPassword.hpp"
@@ -35,9 +36,13 @@
 
 #include "Null.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
 
@@ -169,6 +174,11 @@ Asymmetric::Asymmetric(
     , m_bIsPrivateKey{privateKey}
     , m_timer{}
     , m_pMetadata{new OTSignatureMetadata}
+    , cache_lock_()
+    , id_(Identifier::Factory())
+    , public_cache_()
+    , private_cache_()
+    , purge_timer_(0)
 {
     OT_ASSERT(nullptr != m_pMetadata);
 }
@@ -220,6 +230,17 @@ bool Asymmetric::CalculateID(Identifier& theOutput) const  // Only works
         return false;
     }
 
+    {
+        Lock lock(cache_lock_);
+
+        if (false == id_->empty()) {
+            auto cached = OTIdentifier{id_};
+            theOutput.swap(cached);
+
+            return true;
+        }
+    }
+
     auto strPublicKey = String::Factory();
     bool bGotPublicKey = GetPublicKey(strPublicKey);
 
@@ -236,6 +257,9 @@ bool Asymmetric::CalculateID(Identifier& theOutput) const  // Only works
         return false;
     }
 
+    Lock lock(cache_lock_);
+    id_ = Identifier::Factory(theOutput);
+
     return true;
 }
 
@@ -327,9 +351,135 @@ bool Asymmetric::Path(proto::HDPath&) const
     return false;
 }
 
+bool Asymmetric::CachedPrivate(
+    const crypto::AsymmetricProvider& engine,
+    OTPassword& output,
+    const CacheClock::time_point now) const
+{
+    Lock lock(cache_lock_);
+    purge_private(lock, now);
+    const auto it = private_cache_.find(&engine);
+
+    if (private_cache_.end() == it) { return false; }
+
+    output = *it->second.second;
+
+    return true;
+}
+
+bool Asymmetric::CachedPublic(
+    const crypto::AsymmetricProvider& engine,
+    Data& output) const
+{
+    Lock lock(cache_lock_);
+    purge_private(lock, CacheClock::now());
+    const auto it = public_cache_.find(&engine);
+
+    if (public_cache_.end() == it) { return false; }
+
+    output.Assign(it->second);
+
+    return true;
+}
+
+void Asymmetric::CachePrivate(
+    const crypto::AsymmetricProvider& engine,
+    const OTPassword& parsed,
+    const CacheClock::time_point now) const
+{
+    Lock lock(cache_lock_);
+    purge_private(lock, now);
+    auto& [expires, key] = private_cache_[&engine];
+    expires = now + std::chrono::seconds(OT_KEY_TIMER);
+    key.reset(new OTPassword(parsed));
+    schedule_purge(lock);
+}
+
+void Asymmetric::CachePublic(
+    const crypto::AsymmetricProvider& engine,
+    const Data& parsed) const
+{
+    Lock lock(cache_lock_);
+    public_cache_.erase(&engine);
+    public_cache_.emplace(&engine, Data::Factory(parsed));
+}
+
+void Asymmetric::clear_cache() const
+{
+    Lock lock(cache_lock_);
+    id_ = Identifier::Factory();
+    public_cache_.clear();
+    private_cache_.clear();
+}
+
+void Asymmetric::purge_expired() const
+{
+    Lock lock(cache_lock_);
+
+    // The destructor is waiting for this run to finish
+    if (0 == purge_timer_) { return; }
+
+    purge_private(lock, CacheClock::now());
+
+    if (private_cache_.empty()) {
+        purge_timer_ = 0;
+    } else {
+        schedule_purge(lock);
+    }
+}
+
+void Asymmetric::purge_private(
+    const Lock& lock,
+    const CacheClock::time_point now) const
+{
+    OT_ASSERT(lock.owns_lock() && (&cache_lock_ == lock.mutex()));
+
+    for (auto it = private_cache_.begin(); it != private_cache_.end();) {
+        if (it->second.first <= now) {
+            it = private_cache_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void Asymmetric::schedule_purge(const Lock& lock) const
+{
+    OT_ASSERT(lock.owns_lock() && (&cache_lock_ == lock.mutex()));
+
+    if (private_cache_.empty()) { return; }
+
+    auto next = CacheClock::time_point::max();
+
+    for (const auto& [engine, entry] : private_cache_) {
+        next = std::min(next, entry.first);
+    }
+
+    const auto delay = std::max(
+        std::chrono::milliseconds(0),
+        std::chrono::ceil<std::chrono::milliseconds>(
+            next - CacheClock::now()));
+
+    // Moves the pending purge, or the next run of one in progress
+    if ((0 != purge_timer_) && timer().Reschedule(purge_timer_, delay)) {
+        return;
+    }
+
+    purge_timer_ = timer().Schedule(
+        delay, std::chrono::milliseconds(0), [this]() -> void {
+            this->purge_expired();
+        });
+}
+
+const api::internal::Timer& Asymmetric::timer()
+{
+    return dynamic_cast<const api::internal::Native&>(OT::App()).Timer();
+}
+
 void Asymmetric::Release()
 {
     ReleaseKeyLowLevel_Hook();
+    clear_cache();
 
     m_timer.clear();
 }
@@ -400,6 +550,14 @@ bool Asymmetric::Verify(const Data& plaintext, const proto::Signature& sig)
 
 Asymmetric::~Asymmetric()
 {
+    Lock lock(cache_lock_);
+    const auto purge = purge_timer_;
+    purge_timer_ = 0;
+    lock.unlock();
+
+    // The purge acquires cache_lock_, so it must not be held here
+    if (0 != purge) { timer().Cancel(purge); }
+
     m_timer.clear();
 
     if (nullptr != m_pMetadata) { delete m_pMetadata; }
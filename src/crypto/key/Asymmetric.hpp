@@ -7,6 +7,14 @@
 
 #include "Internal.hpp"
 
+#include "internal/api/Internal.hpp"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
 namespace opentxs::crypto::key::implementation
 {
 class Asymmetric : virtual public key::Asymmetric
@@ -16,7 +24,8 @@ public:
         const proto::AsymmetricKeyType keyType,
         const proto::KeyRole role);
 
-    /** Only works for public keys. */
+    /** Only works for public keys. The result is cached until the key
+     *  changes. */
     bool CalculateID(Identifier& theOutput) const override;
     const OTSignatureMetadata* GetMetadata() const override
     {
@@ -42,6 +51,30 @@ public:
     bool Verify(const Data& plaintext, const proto::Signature& sig)
         const override;
 
+    using CacheClock = std::chrono::steady_clock;
+
+    /** Parsed forms of this key, cached by the providers which operate on it
+     *
+     *  Entries are keyed by provider since each library has its own internal
+     *  representation. Private entries are held in OTPassword secure memory
+     *  and expire OT_KEY_TIMER seconds after they are cached, the same
+     *  lifetime RSA keys give their instantiated private key. Expired entries
+     *  are wiped by a timer, whether or not the key is used again.
+     */
+    bool CachedPrivate(
+        const crypto::AsymmetricProvider& engine,
+        OTPassword& output,
+        const CacheClock::time_point now = CacheClock::now()) const;
+    bool CachedPublic(const crypto::AsymmetricProvider& engine, Data& output)
+        const;
+    void CachePrivate(
+        const crypto::AsymmetricProvider& engine,
+        const OTPassword& parsed,
+        const CacheClock::time_point now = CacheClock::now()) const;
+    void CachePublic(
+        const crypto::AsymmetricProvider& engine,
+        const Data& parsed) const;
+
     void Release() override;
     void ReleaseKey() override { Release(); }
     /** Don't use this, normally it's not necessary. */
@@ -107,6 +140,8 @@ protected:
 
     virtual void ReleaseKeyLowLevel_Hook() {}
 
+    void clear_cache() const;
+
     Asymmetric(
         const proto::AsymmetricKeyType keyType,
         const proto::KeyRole role,
@@ -116,5 +151,24 @@ protected:
     Asymmetric(Asymmetric&&) = delete;
     Asymmetric& operator=(const Asymmetric&) = delete;
     Asymmetric& operator=(Asymmetric&&) = delete;
+
+private:
+    mutable std::mutex cache_lock_;
+    mutable OTIdentifier id_;
+    mutable std::map<const crypto::AsymmetricProvider*, OTData> public_cache_;
+    /** expiration time, decrypted key */
+    mutable std::map<
+        const crypto::AsymmetricProvider*,
+        std::pair<CacheClock::time_point, std::unique_ptr<OTPassword>>>
+        private_cache_;
+    /** Runs when the earliest private entry expires */
+    mutable api::internal::Timer::TimerID purge_timer_;
+
+    static const api::internal::Timer& timer();
+
+    void purge_expired() const;
+    void purge_private(const Lock& lock, const CacheClock::time_point now)
+        const;
+    void schedule_purge(const Lock& lock) const;
 };
 }  // namespace opentxs::crypto::key::implementation
@@ -307,6 +307,7 @@ bool EllipticCurve::SetKey(const Data& key)
     m_bIsPublicKey = true;
     m_bIsPrivateKey = false;
     key_ = key;
+    clear_cache();
 
     return true;
 }
@@ -316,6 +317,7 @@ bool EllipticCurve::SetKey(std::unique_ptr<proto::Ciphertext>& key)
     m_bIsPublicKey = false;
     m_bIsPrivateKey = true;
     encrypted_key_.swap(key);
+    clear_cache();
 
     return true;
 }
@@ -11,6 +11,16 @@
 
 #include "AsymmetricProvider.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <vector>
+
+// Smallest number of signatures worth handing to an additional thread
+#define OT_VERIFY_BATCH_MIN_PER_THREAD 8
+
 namespace opentxs::crypto
 {
 proto::AsymmetricKeyType AsymmetricProvider::CurveToKeyType(
@@ -80,6 +90,49 @@ bool AsymmetricProvider::SignContract(
     return success;
 }
 
+bool AsymmetricProvider::VerifyBatch(
+    const SignatureBatch& batch,
+    const OTPasswordData* pPWData) const
+{
+    const auto count = batch.size();
+
+    if (0 == count) { return true; }
+
+    const std::size_t threads =
+        verify_in_parallel()
+            ? std::max<std::size_t>(
+                  1,
+                  std::min<std::size_t>(
+                      std::thread::hardware_concurrency(),
+                      count / OT_VERIFY_BATCH_MIN_PER_THREAD))
+            : 1;
+    std::atomic<bool> output{true};
+    auto worker = [&](const std::size_t first) -> void {
+        for (auto i = first; i < count; i += threads) {
+            if (false == output.load()) { return; }
+
+            const auto& [plaintext, key, signature, hashType] = batch.at(i);
+
+            if (false == Verify(plaintext, key, signature, hashType, pPWData)) {
+                output.store(false);
+
+                return;
+            }
+        }
+    };
+    std::vector<std::future<void>> jobs{};
+
+    for (std::size_t i = 1; i < threads; ++i) {
+        jobs.emplace_back(std::async(std::launch::async, worker, i));
+    }
+
+    worker(0);
+
+    for (auto& job : jobs) { job.get(); }
+
+    return output.load();
+}
+
 bool AsymmetricProvider::VerifyContractSignature(
     const String& strContractToVerify,
     const key::Asymmetric& theKey,
@@ -20,6 +20,9 @@ public:
         OTSignature& theSignature,  // output
         const proto::HashType hashType,
         const OTPasswordData* pPWData = nullptr) const override;
+    bool VerifyBatch(
+        const SignatureBatch& batch,
+        const OTPasswordData* pPWData = nullptr) const override;
     bool VerifyContractSignature(
         const String& strContractToVerify,
         const key::Asymmetric& theKey,
@@ -30,6 +33,10 @@ public:
     virtual ~AsymmetricProvider() = default;
 
 protected:
+    /** Providers whose Verify mutates shared key state override this to have
+     *  VerifyBatch check each signature on the calling thread */
+    virtual bool verify_in_parallel() const { return true; }
+
     AsymmetricProvider() = default;
 
 private:
@@ -42,6 +42,12 @@ public:
     {
         return false;
     }
+    bool VerifyBatch(
+        const SignatureBatch& batch,
+        const OTPasswordData* = nullptr) const override
+    {
+        return batch.empty();
+    }
     bool VerifyContractSignature(
         const String&,
         const key::Asymmetric&,
@@ -144,6 +144,18 @@ std::shared_ptr<proto::AsymmetricKey> Bitcoin::SeedToPrivateKey(
     return {};
 }
 
+bool Bitcoin::ExtendedPublicKey(
+    [[maybe_unused]] const EcdsaCurve& curve,
+    [[maybe_unused]] const OTPassword& seed,
+    [[maybe_unused]] proto::HDPath& path,
+    [[maybe_unused]] Data& publicKey,
+    [[maybe_unused]] Data& chainCode) const
+{
+    // TODO
+
+    return false;
+}
+
 std::shared_ptr<proto::AsymmetricKey> Bitcoin::GetChild(
     [[maybe_unused]] const proto::AsymmetricKey& parent,
     [[maybe_unused]] const std::uint32_t index) const
@@ -163,6 +175,18 @@ std::shared_ptr<proto::AsymmetricKey> Bitcoin::GetHDKey(
     return {};
 }
 
+bool Bitcoin::PublicChild(
+    [[maybe_unused]] const EcdsaCurve& curve,
+    [[maybe_unused]] const Data& parentKey,
+    [[maybe_unused]] const Data& parentChainCode,
+    [[maybe_unused]] const std::uint32_t index,
+    [[maybe_unused]] Data& childKey) const
+{
+    // TODO
+
+    return false;
+}
+
 bool Bitcoin::RandomKeypair(
     [[maybe_unused]] OTPassword& privateKey,
     [[maybe_unused]] Data& publicKey) const
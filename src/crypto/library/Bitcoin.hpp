@@ -59,6 +59,12 @@ class Bitcoin final : virtual public crypto::Bitcoin,
 {
 public:
 #if OT_CRYPTO_WITH_BIP32
+    bool ExtendedPublicKey(
+        const EcdsaCurve& curve,
+        const OTPassword& seed,
+        proto::HDPath& path,
+        Data& publicKey,
+        Data& chainCode) const override;
     std::shared_ptr<proto::AsymmetricKey> GetChild(
         const proto::AsymmetricKey& parent,
         const std::uint32_t index) const override;
@@ -66,6 +72,12 @@ public:
         const EcdsaCurve& curve,
         const OTPassword& seed,
         proto::HDPath& path) const override;
+    bool PublicChild(
+        const EcdsaCurve& curve,
+        const Data& parentKey,
+        const Data& parentChainCode,
+        const std::uint32_t index,
+        Data& childKey) const override;
     bool RandomKeypair(OTPassword& privateKey, Data& publicKey) const override;
     std::string SeedToFingerprint(
         const EcdsaCurve& curve,
@@ -177,6 +177,12 @@ private:
     std::unique_ptr<OpenSSLdp> dp_;
     mutable std::mutex lock_;
 
+#if OT_CRYPTO_SUPPORTED_KEY_RSA
+    // RSA::d::GetKey may release and reinstantiate the EVP_PKEY of the key
+    // being verified, so concurrent verifications with one key are unsafe
+    bool verify_in_parallel() const override { return false; }
+#endif
+
     bool ArgumentCheck(
         const bool encrypt,
         const LegacySymmetricProvider::Mode cipher,
@@ -33,6 +33,8 @@
 #include "opentxs/OT.hpp"
 #include "opentxs/Proto.hpp"
 
+#include "crypto/key/Asymmetric.hpp"
+
 #include "AsymmetricProvider.hpp"
 #include "EcdsaProvider.hpp"
 
@@ -41,6 +43,7 @@ extern "C" {
 }
 
 #include <cstdint>
+#include <cstring>
 #include <ostream>
 
 #include "Secp256k1.hpp"
@@ -128,13 +131,25 @@ bool Secp256k1::Sign(
 
     if (nullptr == key) { return false; }
 
-    if (nullptr == pPWData) {
-        OTPasswordData passwordData(
-            "Please enter your password to sign this document.");
-        havePrivateKey =
-            AsymmetricKeyToECPrivatekey(*key, passwordData, privKey);
+    const auto* cache =
+        dynamic_cast<const key::implementation::Asymmetric*>(&theKey);
+
+    if ((nullptr != cache) && cache->CachedPrivate(*this, privKey)) {
+        havePrivateKey = true;
     } else {
-        havePrivateKey = AsymmetricKeyToECPrivatekey(*key, *pPWData, privKey);
+        if (nullptr == pPWData) {
+            OTPasswordData passwordData(
+                "Please enter your password to sign this document.");
+            havePrivateKey =
+                AsymmetricKeyToECPrivatekey(*key, passwordData, privKey);
+        } else {
+            havePrivateKey =
+                AsymmetricKeyToECPrivatekey(*key, *pPWData, privKey);
+        }
+
+        if (havePrivateKey && (nullptr != cache)) {
+            cache->CachePrivate(*this, privKey);
+        }
     }
 
     if (havePrivateKey) {
@@ -184,15 +199,29 @@ bool Secp256k1::Verify(
 
     if (nullptr == key) { return false; }
 
-    auto ecdsaPubkey = Data::Factory();
-    const bool havePublicKey = AsymmetricKeyToECPubkey(*key, ecdsaPubkey);
+    const auto* cache =
+        dynamic_cast<const key::implementation::Asymmetric*>(&theKey);
+    secp256k1_pubkey point;
+    auto parsed = Data::Factory();
 
-    if (!havePublicKey) { return false; }
+    if ((nullptr != cache) && cache->CachedPublic(*this, parsed) &&
+        (sizeof(point.data) == parsed->size())) {
+        std::memcpy(point.data, parsed->data(), sizeof(point.data));
+    } else {
+        auto ecdsaPubkey = Data::Factory();
+        const bool havePublicKey = AsymmetricKeyToECPubkey(*key, ecdsaPubkey);
 
-    secp256k1_pubkey point;
-    const bool pubkeyParsed = ParsePublicKey(ecdsaPubkey, point);
+        if (!havePublicKey) { return false; }
+
+        const bool pubkeyParsed = ParsePublicKey(ecdsaPubkey, point);
 
-    if (!pubkeyParsed) { return false; }
+        if (!pubkeyParsed) { return false; }
+
+        if (nullptr != cache) {
+            cache->CachePublic(
+                *this, Data::Factory(point.data, sizeof(point.data)));
+        }
+    }
 
     secp256k1_ecdsa_signature ecdsaSignature;
     const bool haveSignature = DataToECSignature(signature, ecdsaSignature);
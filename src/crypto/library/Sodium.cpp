@@ -17,6 +17,8 @@
 #include "opentxs/OT.hpp"
 
 #if OT_CRYPTO_SUPPORTED_KEY_ED25519
+#include "crypto/key/Asymmetric.hpp"
+
 #include "AsymmetricProvider.hpp"
 #include "EcdsaProvider.hpp"
 #endif  // OT_CRYPTO_SUPPORTED_KEY_ED25519
@@ -487,9 +489,6 @@ bool Sodium::Sign(
         return false;
     }
 
-    OTPassword seed;
-    bool havePrivateKey = false;
-
     // FIXME
     OT_ASSERT_MSG(nullptr == exportPassword, "This case is not yet handled.");
 
@@ -498,31 +497,43 @@ bool Sodium::Sign(
 
     if (nullptr == key) { return false; }
 
-    if (nullptr == pPWData) {
-        OTPasswordData passwordData(
-            "Please enter your password to sign this  document.");
-        havePrivateKey = AsymmetricKeyToECPrivatekey(*key, passwordData, seed);
-    } else {
-        havePrivateKey = AsymmetricKeyToECPrivatekey(*key, *pPWData, seed);
-    }
+    const auto* cache =
+        dynamic_cast<const key::implementation::Asymmetric*>(&theKey);
+    OTPassword privKey;
 
-    if (!havePrivateKey) {
-        otErr << OT_METHOD << __FUNCTION__
-              << ": Can not extract ed25519 private key seed "
-              << "from Asymmetric." << std::endl;
+    if ((nullptr == cache) || (false == cache->CachedPrivate(*this, privKey))) {
+        OTPassword seed;
+        bool havePrivateKey = false;
+
+        if (nullptr == pPWData) {
+            OTPasswordData passwordData(
+                "Please enter your password to sign this  document.");
+            havePrivateKey =
+                AsymmetricKeyToECPrivatekey(*key, passwordData, seed);
+        } else {
+            havePrivateKey = AsymmetricKeyToECPrivatekey(*key, *pPWData, seed);
+        }
 
-        return false;
-    }
+        if (!havePrivateKey) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Can not extract ed25519 private key seed "
+                  << "from Asymmetric." << std::endl;
 
-    auto notUsed = Data::Factory();
-    OTPassword privKey;
-    const bool keyExpanded = ExpandSeed(seed, privKey, notUsed);
+            return false;
+        }
 
-    if (!keyExpanded) {
-        otErr << OT_METHOD << __FUNCTION__
-              << ": Can not expand ed25519 private key from seed." << std::endl;
+        auto notUsed = Data::Factory();
+        const bool keyExpanded = ExpandSeed(seed, privKey, notUsed);
 
-        return false;
+        if (!keyExpanded) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Can not expand ed25519 private key from seed."
+                  << std::endl;
+
+            return false;
+        }
+
+        if (nullptr != cache) { cache->CachePrivate(*this, privKey); }
     }
 
     std::array<unsigned char, crypto_sign_BYTES> sig{};
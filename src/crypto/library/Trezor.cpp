@@ -30,7 +30,9 @@
 #include "opentxs/Types.hpp"
 
 #if OT_CRYPTO_WITH_BIP32
+#include "core/ExpiringCache.hpp"
 #include "crypto/Bip32.hpp"
+#include "internal/api/Internal.hpp"
 #endif
 #include "AsymmetricProvider.hpp"
 #include "EcdsaProvider.hpp"
@@ -51,9 +53,14 @@ extern "C" {
 }
 
 #include <array>
+#include <chrono>
 #include <cstdint>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <tuple>
+#include <vector>
 
 #include "Trezor.hpp"
 
@@ -74,15 +81,23 @@ uint32_t random32(void)
 
 namespace opentxs
 {
-crypto::Trezor* Factory::Trezor(const api::Crypto& crypto)
+crypto::Trezor* Factory::Trezor(
+    const api::Crypto& crypto,
+    const api::internal::Timer& timer)
 {
-    return new crypto::implementation::Trezor(crypto);
+    return new crypto::implementation::Trezor(crypto, timer);
 }
 }  // namespace opentxs
 
 namespace opentxs::crypto::implementation
 {
-Trezor::Trezor(const api::Crypto& crypto)
+#if OT_CRYPTO_WITH_BIP32
+const std::chrono::seconds Trezor::NODE_CACHE_TIMEOUT{300};
+const std::chrono::seconds Trezor::NODE_CACHE_PURGE_INTERVAL{30};
+const std::size_t Trezor::NODE_CACHE_LIMIT{1024};
+#endif
+
+Trezor::Trezor(const api::Crypto& crypto, const api::internal::Timer& timer)
 #if OT_CRYPTO_WITH_BIP32
     : Bip32()
 #endif
@@ -94,10 +109,28 @@ Trezor::Trezor(const api::Crypto& crypto)
 #endif
     EcdsaProvider(crypto)
 #endif
+#if OT_CRYPTO_WITH_BIP32
+    , timer_(timer)
+    , node_cache_(NODE_CACHE_LIMIT, NODE_CACHE_TIMEOUT)
+#endif
 {
 #if OT_CRYPTO_WITH_BIP32
     secp256k1_ = get_curve_by_name(CurveName(EcdsaCurve::SECP256K1).c_str());
     OT_ASSERT(nullptr != secp256k1_);
+
+    // Cached nodes contain private keys, so they must not outlive their
+    // timeout just because nobody derives from the same parent again
+    node_cache_purge_ = timer_.Schedule(
+        NODE_CACHE_PURGE_INTERVAL,
+        NODE_CACHE_PURGE_INTERVAL,
+        [this]() -> void { node_cache_.Purge(); });
+#endif
+}
+
+Trezor::~Trezor()
+{
+#if OT_CRYPTO_WITH_BIP32
+    timer_.Cancel(node_cache_purge_);
 #endif
 }
 
@@ -173,6 +206,29 @@ std::shared_ptr<proto::AsymmetricKey> Trezor::SeedToPrivateKey(
     return derivedKey;
 }
 
+bool Trezor::ExtendedPublicKey(
+    const EcdsaCurve& curve,
+    const OTPassword& seed,
+    proto::HDPath& path,
+    Data& publicKey,
+    Data& chainCode) const
+{
+    auto node = DeriveChild(curve, seed, path);
+
+    if (false == bool(node)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to derive node."
+              << std::endl;
+
+        return false;
+    }
+
+    publicKey.Assign(node->public_key, sizeof(node->public_key));
+    chainCode.Assign(node->chain_code, sizeof(node->chain_code));
+    OTPassword::zeroMemory(node.get(), sizeof(HDNode));
+
+    return true;
+}
+
 std::shared_ptr<proto::AsymmetricKey> Trezor::GetChild(
     const proto::AsymmetricKey& parent,
     const std::uint32_t index) const
@@ -209,6 +265,69 @@ std::unique_ptr<HDNode> Trezor::GetChild(
     return output;
 }
 
+Trezor::NodeCacheKey Trezor::CacheKey(
+    const EcdsaCurve& curve,
+    const OTPassword& seed,
+    const proto::HDPath& path) const
+{
+    OTPassword digest;
+    crypto_.Hash().Digest(proto::HASHTYPE_BLAKE2B160, seed, digest);
+
+    return NodeCacheKey{
+        curve,
+        std::string(
+            static_cast<const char*>(digest.getMemory()),
+            digest.getMemorySize()),
+        std::vector<std::uint32_t>(path.child().begin(), path.child().end())};
+}
+
+// Returns a copy of the node at the specified path, deriving and caching it if
+// necessary. Only used for parent nodes so that sibling derivations share the
+// work of deriving their common ancestors.
+std::unique_ptr<HDNode> Trezor::CachedNode(
+    const EcdsaCurve& curve,
+    const OTPassword& seed,
+    proto::HDPath& path) const
+{
+    static_assert(
+        sizeof(HDNode) <= OT_DEFAULT_BLOCKSIZE,
+        "HDNode does not fit in an OTPassword");
+
+    const auto key = CacheKey(curve, seed, path);
+    std::shared_ptr<const OTPassword> cached{};
+
+    if (node_cache_.Find(key, cached)) {
+        OT_ASSERT(cached);
+
+        std::unique_ptr<HDNode> output{new HDNode};
+
+        OT_ASSERT(output);
+
+        OTPassword::safe_memcpy(
+            output.get(),
+            sizeof(HDNode),
+            cached->getMemory(),
+            cached->getMemorySize(),
+            false);
+
+        return output;
+    }
+
+    auto output = DeriveChild(curve, seed, path);
+
+    if (false == bool(output)) { return output; }
+
+    cached.reset(new OTPassword(
+        static_cast<const void*>(output.get()),
+        static_cast<std::uint32_t>(sizeof(HDNode))));
+
+    OT_ASSERT(cached);
+
+    node_cache_.Insert(key, std::move(cached));
+
+    return output;
+}
+
 std::unique_ptr<HDNode> Trezor::DeriveChild(
     const EcdsaCurve& curve,
     const OTPassword& seed,
@@ -222,12 +341,13 @@ std::unique_ptr<HDNode> Trezor::DeriveChild(
     } else {
         proto::HDPath newpath = path;
         newpath.mutable_child()->RemoveLast();
-        auto parentnode = DeriveChild(curve, seed, newpath);
+        auto parentnode = CachedNode(curve, seed, newpath);
         std::unique_ptr<HDNode> output{nullptr};
 
         if (parentnode) {
             const auto child = path.child(depth - 1);
             output = GetChild(*parentnode, child, DERIVE_PRIVATE);
+            OTPassword::zeroMemory(parentnode.get(), sizeof(HDNode));
         } else {
             OT_FAIL;
         }
@@ -263,6 +383,65 @@ std::shared_ptr<proto::AsymmetricKey> Trezor::GetHDKey(
     return output;
 }
 
+bool Trezor::PublicChild(
+    const EcdsaCurve& curve,
+    const Data& parentKey,
+    const Data& parentChainCode,
+    const std::uint32_t index,
+    Data& childKey) const
+{
+    if (0 != (index & static_cast<std::uint32_t>(Bip32Child::HARDENED))) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Hardened children require the private key." << std::endl;
+
+        return false;
+    }
+
+    // Public derivation only needs the curve, the key and the chain code, so
+    // there is no reason to generate a throwaway node from random entropy
+    HDNode node{};
+    node.curve = ::get_curve_by_name(CurveName(curve).c_str());
+
+    if (nullptr == node.curve) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unsupported curve."
+              << std::endl;
+
+        return false;
+    }
+
+    if ((sizeof(node.public_key) != parentKey.size()) ||
+        (sizeof(node.chain_code) != parentChainCode.size())) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Invalid extended public key."
+              << std::endl;
+
+        return false;
+    }
+
+    OTPassword::safe_memcpy(
+        &(node.public_key[0]),
+        sizeof(node.public_key),
+        parentKey.data(),
+        parentKey.size(),
+        false);
+    OTPassword::safe_memcpy(
+        &(node.chain_code[0]),
+        sizeof(node.chain_code),
+        parentChainCode.data(),
+        parentChainCode.size(),
+        false);
+
+    if (1 != ::hdnode_public_ckd(&node, index)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to derive child."
+              << std::endl;
+
+        return false;
+    }
+
+    childKey.Assign(node.public_key, sizeof(node.public_key));
+
+    return true;
+}
+
 std::shared_ptr<proto::AsymmetricKey> Trezor::HDNodeToSerialized(
     const proto::AsymmetricKeyType& type,
     const HDNode& node,
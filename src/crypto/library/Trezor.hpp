@@ -25,6 +25,12 @@ class Trezor final : virtual public crypto::Trezor,
 {
 public:
 #if OT_CRYPTO_WITH_BIP32
+    bool ExtendedPublicKey(
+        const EcdsaCurve& curve,
+        const OTPassword& seed,
+        proto::HDPath& path,
+        Data& publicKey,
+        Data& chainCode) const override;
     std::shared_ptr<proto::AsymmetricKey> GetChild(
         const proto::AsymmetricKey& parent,
         const std::uint32_t index) const override;
@@ -32,6 +38,12 @@ public:
         const EcdsaCurve& curve,
         const OTPassword& seed,
         proto::HDPath& path) const override;
+    bool PublicChild(
+        const EcdsaCurve& curve,
+        const Data& parentKey,
+        const Data& parentChainCode,
+        const std::uint32_t index,
+        Data& childKey) const override;
     bool RandomKeypair(OTPassword& privateKey, Data& publicKey) const override;
     std::string SeedToFingerprint(
         const EcdsaCurve& curve,
@@ -73,7 +85,7 @@ public:
         const proto::HashType hashType,
         const OTPasswordData* pPWData = nullptr) const override;
 
-    ~Trezor() = default;
+    ~Trezor();
 
 private:
     friend opentxs::Factory;
@@ -97,7 +109,21 @@ private:
 #endif
 
 #if OT_CRYPTO_WITH_BIP32
+    /** curve, seed digest, path */
+    using NodeCacheKey =
+        std::tuple<EcdsaCurve, std::string, std::vector<std::uint32_t>>;
+    /** HDNode */
+    using NodeCache =
+        ExpiringCache<NodeCacheKey, std::shared_ptr<const OTPassword>>;
+
+    static const std::chrono::seconds NODE_CACHE_TIMEOUT;
+    static const std::chrono::seconds NODE_CACHE_PURGE_INTERVAL;
+    static const std::size_t NODE_CACHE_LIMIT;
+
     const curve_info* secp256k1_{nullptr};
+    const api::internal::Timer& timer_;
+    mutable NodeCache node_cache_;
+    api::internal::Timer::TimerID node_cache_purge_{0};
 
     static std::string CurveName(const EcdsaCurve& curve);
 
@@ -109,6 +135,14 @@ private:
         const std::uint32_t index,
         const DerivationMode privateVersion);
 
+    NodeCacheKey CacheKey(
+        const EcdsaCurve& curve,
+        const OTPassword& seed,
+        const proto::HDPath& path) const;
+    std::unique_ptr<HDNode> CachedNode(
+        const EcdsaCurve& curve,
+        const OTPassword& seed,
+        proto::HDPath& path) const;
     std::unique_ptr<HDNode> DeriveChild(
         const EcdsaCurve& curve,
         const OTPassword& seed,
@@ -123,7 +157,7 @@ private:
     bool ValidPrivateKey(const OTPassword& key) const;
 #endif
 
-    Trezor(const api::Crypto& crypto);
+    Trezor(const api::Crypto& crypto, const api::internal::Timer& timer);
     Trezor() = delete;
     Trezor(const Trezor&) = delete;
     Trezor(Trezor&&) = delete;
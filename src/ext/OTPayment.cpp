@@ -2064,10 +2064,7 @@ void OTPayment::UpdateContents()
         }
     }
 
-    std::string str_result;
-    tag.output(str_result);
-
-    m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    tag.output(m_xmlUnsigned);
 }
 
 OTPayment::~OTPayment() { Release_Payment(); }
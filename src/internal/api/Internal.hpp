@@ -9,6 +9,10 @@
 
 #include "opentxs/api/Native.hpp"
 
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
 namespace
 {
 /** Callbacks in this form allow OpenSSL to query opentxs to get key encryption
@@ -32,6 +36,7 @@ struct Native : virtual public api::Native {
     virtual INTERNAL_PASSWORD_CALLBACK* GetInternalPasswordCallback() const = 0;
     virtual OTCaller& GetPasswordCaller() const = 0;
     virtual void Init() = 0;
+    virtual const api::internal::Timer& Timer() const = 0;
     virtual void shutdown() = 0;
     virtual ~Native() = default;
 };
@@ -39,4 +44,50 @@ struct Native : virtual public api::Native {
 struct Log {
     virtual ~Log() = default;
 };
+
+/** Process-wide timer service
+ *
+ *  Timers are kept in a hierarchical timing wheel driven by a single thread
+ *  and due tasks are executed by fixed pools of worker threads. Tasks which
+ *  may run for a long time have a pool of their own, so that they can not
+ *  delay the others. A task never runs concurrently with itself.
+ */
+struct Timer {
+    using Task = std::function<void()>;
+    using TimerID = std::uint64_t;
+
+    /** Stops a task from running again
+     *
+     *  Blocks until any run of the task which is in progress has finished,
+     *  unless called from the task itself. Callers must therefore not hold
+     *  a lock which the task acquires, and a task must not cancel another
+     *  task which can wait for it, or neither will ever finish. Owners
+     *  normally cancel their tasks in their destructors, which may run on a
+     *  worker, so the wait can not be skipped for other tasks.
+     */
+    virtual void Cancel(const TimerID id) const = 0;
+    /** Moves the next run of a scheduled task to the specified delay from
+     *  now. If the task is running, the delay replaces its interval for the
+     *  next run only. */
+    virtual bool Reschedule(
+        const TimerID id,
+        const std::chrono::milliseconds delay) const = 0;
+    /** Runs a task after the specified delay, then repeatedly after each
+     *  interval has elapsed since the previous run finished
+     *
+     *  A zero interval runs the task once.
+     */
+    virtual TimerID Schedule(
+        const std::chrono::milliseconds delay,
+        const std::chrono::milliseconds interval,
+        const Task& task) const = 0;
+    /** Schedule for tasks which may run for a long time, such as garbage
+     *  collection and cron processing */
+    virtual TimerID ScheduleLong(
+        const std::chrono::milliseconds delay,
+        const std::chrono::milliseconds interval,
+        const Task& task) const = 0;
+
+    virtual ~Timer() = default;
+};
 }  // namespace opentxs::api::internal
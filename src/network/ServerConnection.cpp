@@ -33,6 +33,8 @@
 #include "opentxs/otx/Request.hpp"
 #include "opentxs/Proto.hpp"
 
+#include "internal/api/Internal.hpp"
+
 #include <atomic>
 #include <chrono>
 #include <cstdint>
@@ -51,20 +53,21 @@ template class opentxs::Pimpl<zmq::RequestSocket>;
 
 #define OT_METHOD "opentxs::ServerConnection::"
 
-namespace opentxs::network
+namespace opentxs
 {
-OTServerConnection ServerConnection::Factory(
+network::ServerConnection* Factory::ServerConnection(
     const api::Core& api,
     const api::network::ZMQ& zmq,
-    const zeromq::PublishSocket& updates,
-    const std::shared_ptr<const ServerContract>& contract)
+    const network::zeromq::PublishSocket& updates,
+    const std::shared_ptr<const ServerContract>& contract,
+    const api::internal::Timer& timer)
 {
     OT_ASSERT(contract)
 
-    return OTServerConnection(
-        new implementation::ServerConnection(api, zmq, updates, contract));
+    return new network::implementation::ServerConnection(
+        api, zmq, updates, contract, timer);
 }
-}  // namespace opentxs::network
+}  // namespace opentxs
 
 namespace opentxs::network::implementation
 {
@@ -72,14 +75,16 @@ ServerConnection::ServerConnection(
     const api::Core& api,
     const api::network::ZMQ& zmq,
     const zeromq::PublishSocket& updates,
-    const std::shared_ptr<const ServerContract>& contract)
+    const std::shared_ptr<const ServerContract>& contract,
+    const api::internal::Timer& timer)
     : zmq_(zmq)
     , api_(api)
     , updates_(updates)
     , server_id_(contract->ID()->str())
     , address_type_(zmq.DefaultAddressType())
     , remote_contract_(contract)
-    , thread_()
+    , timer_(timer)
+    , activity_timer_(0)
     , callback_(zeromq::ListenCallback::Factory(
           [=](const zeromq::Message& in) -> void {
               this->process_incoming(in);
@@ -100,7 +105,10 @@ ServerConnection::ServerConnection(
 {
     OT_ASSERT(remote_contract_)
 
-    thread_ = std::thread(&ServerConnection::activity_timer, this);
+    activity_timer_ = timer_.Schedule(
+        std::chrono::seconds(0),
+        std::chrono::seconds(1),
+        [this]() -> void { this->activity_timer(); });
     const auto started = notification_socket_->Start(
         api_.Endpoints().InternalProcessPushNotification());
 
@@ -109,21 +117,19 @@ ServerConnection::ServerConnection(
 
 void ServerConnection::activity_timer()
 {
-    while (zmq_.Running()) {
-        const auto limit = zmq_.KeepAlive();
-        const auto now = std::chrono::seconds(std::time(nullptr));
-        const auto last = std::chrono::seconds(last_activity_.load());
-        const auto duration = now - last;
-
-        if (duration > limit) {
-            if (limit > std::chrono::seconds(0)) {
-                socket_->Send(std::string(""));
-            } else {
-                if (status_->Off()) { publish(); };
-            }
+    if (false == zmq_.Running()) { return; }
+
+    const auto limit = zmq_.KeepAlive();
+    const auto now = std::chrono::seconds(std::time(nullptr));
+    const auto last = std::chrono::seconds(last_activity_.load());
+    const auto duration = now - last;
+
+    if (duration > limit) {
+        if (limit > std::chrono::seconds(0)) {
+            socket_->Send(std::string(""));
+        } else {
+            if (status_->Off()) { publish(); };
         }
-
-        Log::Sleep(std::chrono::seconds(1));
     }
 }
 
@@ -464,8 +470,5 @@ OTZMQDealerSocket ServerConnection::socket(const Lock& lock) const
 
 bool ServerConnection::Status() const { return status_.get(); }
 
-ServerConnection::~ServerConnection()
-{
-    if (thread_.joinable()) { thread_.join(); }
-}
+ServerConnection::~ServerConnection() { timer_.Cancel(activity_timer_); }
 }  // namespace opentxs::network::implementation
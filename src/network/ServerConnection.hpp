@@ -24,7 +24,7 @@ public:
     ~ServerConnection();
 
 private:
-    friend opentxs::network::ServerConnection;
+    friend opentxs::Factory;
 
     const api::network::ZMQ& zmq_;
     const api::Core& api_;
@@ -32,7 +32,8 @@ private:
     const std::string server_id_{};
     proto::AddressType address_type_{proto::ADDRESSTYPE_ERROR};
     std::shared_ptr<const ServerContract> remote_contract_{nullptr};
-    std::thread thread_;
+    const api::internal::Timer& timer_;
+    std::uint64_t activity_timer_{0};
     OTZMQListenCallback callback_;
     OTZMQDealerSocket socket_;
     OTZMQPushSocket notification_socket_;
@@ -73,7 +74,8 @@ private:
         const api::Core& api,
         const api::network::ZMQ& zmq,
         const zeromq::PublishSocket& updates,
-        const std::shared_ptr<const ServerContract>& contract);
+        const std::shared_ptr<const ServerContract>& contract,
+        const api::internal::Timer& timer);
     ServerConnection() = delete;
     ServerConnection(const ServerConnection&) = delete;
     ServerConnection(ServerConnection&&) = delete;
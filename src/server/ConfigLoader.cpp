@@ -208,6 +208,27 @@ bool ConfigLoader::load(
         ServerSettings::SetMinMarketScale(lValue);
     }
 
+    // TRANSACTION NUMBERS
+
+    {
+        const char* szComment = "; maximum_block is the largest number of "
+                                "transaction numbers a nym may reserve\n"
+                                "; in a single request. Values below 100 "
+                                "are raised to 100, and values above\n"
+                                "; 100000 are lowered to 100000.\n";
+
+        bool bIsNewKey = false;
+        std::int64_t lValue = 0;
+        config.CheckSet_long(
+            "transaction_numbers",
+            "maximum_block",
+            ServerSettings::GetMaxNumberBlock(),
+            lValue,
+            bIsNewKey,
+            szComment);
+        ServerSettings::SetMaxNumberBlock(lValue);
+    }
+
     // SECURITY (beginnings of..)
 
     // Master Key Timeout
@@ -106,10 +106,7 @@ bool MainFile::SaveMainFileToString(String& strMainFile)
 
     server_.GetTransactor().voucherAccounts_.Serialize(tag);
 
-    std::string str_result;
-    tag.output(str_result);
-
-    strMainFile.Concatenate("%s", str_result.c_str());
+    tag.output(strMainFile);
 
     return true;
 }
@@ -33,15 +33,20 @@
 #include "opentxs/otx/Reply.hpp"
 #include "opentxs/otx/Request.hpp"
 
+#include "internal/api/Internal.hpp"
+
 #include "Server.hpp"
 #include "UserCommandProcessor.hpp"
 
 #include <stddef.h>
 #include <sys/types.h>
+#include <algorithm>
 #include <ostream>
 #include <string>
 
 #define OTX_ZAP_DOMAIN "opentxs-otx"
+// Milliseconds, used when cron is not able to report when it is next due
+#define OT_CRON_MINIMUM_DELAY 50
 
 #define OT_METHOD "opentxs::MessageProcessor::"
 
@@ -55,6 +60,7 @@ namespace opentxs::server
 MessageProcessor::MessageProcessor(
     Server& server,
     const zmq::Context& context,
+    const api::internal::Timer& timer,
     const Flag& running)
     : server_(server)
     , running_(running)
@@ -86,7 +92,8 @@ MessageProcessor::MessageProcessor(
     , notification_socket_(context.PullSocket(
           notification_callback_,
           zmq::Socket::Direction::Bind))
-    , thread_(nullptr)
+    , timer_(timer)
+    , cron_timer_(0)
     , internal_endpoint_(
           std::string("inproc://opentxs/notary/") + Identifier::Random()->str())
     , counter_lock_()
@@ -120,9 +127,9 @@ void MessageProcessor::associate_connection(
 
 void MessageProcessor::cleanup()
 {
-    if (thread_) {
-        thread_->join();
-        thread_.reset();
+    if (0 != cron_timer_) {
+        timer_.Cancel(cron_timer_);
+        cron_timer_ = 0;
     }
 }
 
@@ -182,24 +189,26 @@ void MessageProcessor::init(
 
 void MessageProcessor::run()
 {
-    while (running_) {
-        // timeout is the time left until the next cron should execute.
-        const auto timeout = server_.ComputeTimeout();
-
-        if (timeout <= 0) {
-            // ProcessCron and process_backend must not run simultaneously
-            Lock lock(lock_);
-            server_.ProcessCron();
-        }
+    if (false == running_) { return; }
 
-        Log::Sleep(std::chrono::milliseconds(50));
+    // timeout is the time left until the next cron should execute.
+    auto timeout = server_.ComputeTimeout();
+
+    if (timeout <= 0) {
+        // ProcessCron and process_backend must not run simultaneously
+        Lock lock(lock_);
+        server_.ProcessCron();
+        timeout = server_.ComputeTimeout();
     }
+
+    timer_.Reschedule(
+        cron_timer_,
+        std::chrono::milliseconds(
+            std::max<std::int64_t>(timeout, OT_CRON_MINIMUM_DELAY)));
 }
 
 OTZMQMessage MessageProcessor::process_backend(const zmq::Message& incoming)
 {
-    // ProcessCron and process_backend must not run simultaneously
-    Lock lock(lock_);
     std::string reply{};
 
     std::string messageString{};
@@ -325,18 +334,22 @@ bool MessageProcessor::process_message(
 
     OT_ASSERT(false != bool(replymsg));
 
-    const bool processed =
-        server_.CommandProcessor().ProcessUserCommand(*request, *replymsg);
+    // ProcessCron and process_backend must not run simultaneously. Market
+    // data queries release the lock only while they read published market
+    // snapshots.
+    Lock lock(lock_);
+    const bool processed = server_.CommandProcessor().ProcessUserCommand(
+        *request, *replymsg, lock);
 
     if (false == processed) {
         otWarn << OT_METHOD << __FUNCTION__
                << ": Failed to process user command " << request->m_strCommand
                << std::endl;
-        otInfo << String(*request) << std::endl;
+        OT_LOG_IF(otInfo) << String(*request) << std::endl;
     } else {
-        otWarn << OT_METHOD << __FUNCTION__
-               << ": Successfully processed user command "
-               << request->m_strCommand << std::endl;
+        OT_LOG_IF(otWarn) << OT_METHOD << __FUNCTION__
+                          << ": Successfully processed user command "
+                          << request->m_strCommand << std::endl;
     }
 
     String serializedReply(*replymsg);
@@ -416,10 +429,13 @@ OTData MessageProcessor::query_connection(const Identifier& nymID)
 
 void MessageProcessor::Start()
 {
-    if (false == bool(thread_)) {
-        thread_.reset(new std::thread(&MessageProcessor::run, this));
+    if (0 == cron_timer_) {
+        cron_timer_ = timer_.ScheduleLong(
+            std::chrono::milliseconds(0),
+            std::chrono::milliseconds(OT_CRON_MINIMUM_DELAY),
+            [this]() -> void { this->run(); });
     }
 }
 
-MessageProcessor::~MessageProcessor() {}
+MessageProcessor::~MessageProcessor() { cleanup(); }
 }  // namespace opentxs::server
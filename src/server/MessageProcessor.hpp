@@ -32,6 +32,7 @@ public:
     explicit MessageProcessor(
         Server& server,
         const network::zeromq::Context& context,
+        const api::internal::Timer& timer,
         const Flag& running);
 
     ~MessageProcessor();
@@ -48,7 +49,8 @@ private:
     OTZMQDealerSocket internal_socket_;
     OTZMQListenCallback notification_callback_;
     OTZMQPullSocket notification_socket_;
-    std::unique_ptr<std::thread> thread_{nullptr};
+    const api::internal::Timer& timer_;
+    std::uint64_t cron_timer_{0};
     const std::string internal_endpoint_;
     mutable std::mutex counter_lock_;
     mutable int drop_incoming_{0};
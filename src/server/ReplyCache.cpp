@@ -0,0 +1,203 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "stdafx.hpp"
+
+#include "ReplyCache.hpp"
+
+#include "opentxs/core/util/Assert.hpp"
+#include "opentxs/core/util/OTFolders.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/OTStorage.hpp"
+#include "opentxs/core/String.hpp"
+
+#include <cstdint>
+#include <memory>
+
+#define REPLY_FOLDER "replies"
+
+#define OT_METHOD "opentxs::server::ReplyCache::"
+
+namespace opentxs::server
+{
+ReplyCache::ReplyCache(
+    const std::string& dataFolder,
+    const std::size_t nyms,
+    const std::size_t perNym)
+    : data_folder_(dataFolder)
+    , per_nym_(perNym)
+    , lock_()
+    , replies_()
+    , nyms_(nyms)
+{
+    OT_ASSERT(0 < per_nym_);
+}
+
+void ReplyCache::Clear(const std::string& nymID)
+{
+    Lock lock(lock_);
+    replies_.erase(nymID);
+    nyms_.Erase(nymID);
+
+    for (std::size_t i = 0; i < per_nym_; ++i) {
+        const auto name = slot_name(nymID, i);
+
+        if (false == OTDB::Exists(
+                         data_folder_,
+                         OTFolders::Nym().Get(),
+                         REPLY_FOLDER,
+                         name,
+                         "")) {
+            continue;
+        }
+
+        if (false == OTDB::EraseValueByKey(
+                         data_folder_,
+                         OTFolders::Nym().Get(),
+                         REPLY_FOLDER,
+                         name,
+                         "")) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Failed to erase cached reply " << name << std::endl;
+        }
+    }
+}
+
+ReplyCache::NymReplies& ReplyCache::load(
+    const Lock& lock,
+    const std::string& nymID)
+{
+    OT_ASSERT(lock.owns_lock() && (&lock_ == lock.mutex()));
+
+    for (const auto& evicted : nyms_.Touch(nymID)) { replies_.erase(evicted); }
+
+    auto [it, added] = replies_.try_emplace(nymID);
+    auto& output = it->second;
+
+    if (false == added) { return output; }
+
+    for (std::size_t i = 0; i < per_nym_; ++i) {
+        const auto name = slot_name(nymID, i);
+
+        if (false == OTDB::Exists(
+                         data_folder_,
+                         OTFolders::Nym().Get(),
+                         REPLY_FOLDER,
+                         name,
+                         "")) {
+            continue;
+        }
+
+        std::unique_ptr<OTDB::Storable> pStorable(OTDB::QueryObject(
+            OTDB::STORED_OBJ_STRING_MAP,
+            data_folder_,
+            OTFolders::Nym().Get(),
+            REPLY_FOLDER,
+            name,
+            ""));
+        auto stored = dynamic_cast<OTDB::StringMap*>(pStorable.get());
+
+        if (nullptr == stored) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Unable to load cached reply " << name << std::endl;
+
+            continue;
+        }
+
+        auto& record = stored->the_map;
+        const RequestNumber number = String(record["request"]).ToLong();
+
+        if ((0 == number) || (slot(number) != i)) { continue; }
+
+        output[number] = Reply{record["digest"], record["reply"]};
+    }
+
+    return output;
+}
+
+bool ReplyCache::Load(
+    const std::string& nymID,
+    const RequestNumber number,
+    const std::string& digest,
+    std::string& reply)
+{
+    Lock lock(lock_);
+    const auto& replies = load(lock, nymID);
+    const auto it = replies.find(number);
+
+    if (replies.end() == it) { return false; }
+
+    const auto& [cachedDigest, cachedReply] = it->second;
+
+    if (digest != cachedDigest) { return false; }
+
+    reply = cachedReply;
+
+    return true;
+}
+
+std::size_t ReplyCache::Nyms() const
+{
+    Lock lock(lock_);
+
+    return replies_.size();
+}
+
+std::size_t ReplyCache::slot(const RequestNumber number) const
+{
+    return static_cast<std::uint64_t>(number) % per_nym_;
+}
+
+std::string ReplyCache::slot_name(
+    const std::string& nymID,
+    const std::size_t position) const
+{
+    return nymID + "." + std::to_string(position);
+}
+
+void ReplyCache::Store(
+    const std::string& nymID,
+    const RequestNumber number,
+    const std::string& digest,
+    const std::string& reply)
+{
+    Lock lock(lock_);
+    auto& replies = load(lock, nymID);
+    const auto position = slot(number);
+
+    for (auto it = replies.begin(); it != replies.end();) {
+        if (slot(it->first) == position) {
+            it = replies.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    replies[number] = Reply{digest, reply};
+    std::unique_ptr<OTDB::Storable> pStorable(
+        OTDB::CreateObject(OTDB::STORED_OBJ_STRING_MAP));
+    auto stored = dynamic_cast<OTDB::StringMap*>(pStorable.get());
+
+    OT_ASSERT(nullptr != stored);
+
+    stored->the_map["request"] = std::to_string(number);
+    stored->the_map["digest"] = digest;
+    stored->the_map["reply"] = reply;
+    const auto name = slot_name(nymID, position);
+
+    // Losing a reply costs a retried request a full reprocessing, so a
+    // failure here is not fatal
+    if (false == OTDB::StoreObject(
+                     *stored,
+                     data_folder_,
+                     OTFolders::Nym().Get(),
+                     REPLY_FOLDER,
+                     name,
+                     "")) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to save cached reply " << name << std::endl;
+    }
+}
+}  // namespace opentxs::server
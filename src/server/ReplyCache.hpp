@@ -0,0 +1,84 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Internal.hpp"
+
+#include "core/RecentSet.hpp"
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace opentxs::server
+{
+/** Signed replies to the most recent requests of each nym, so that a request
+ *  which is retried after a timeout gets the reply which was sent the first
+ *  time
+ *
+ *  Each reply is stored as its own record in one of perNym slots, chosen by
+ *  its request number, so adding a reply writes only that reply and replaces
+ *  the one to the request perNym numbers earlier. Only the replies of the
+ *  most recently used nyms are held in memory. The others are reloaded from
+ *  storage when they are needed.
+ */
+class ReplyCache
+{
+public:
+    /** Forgets every reply to the nym */
+    void Clear(const std::string& nymID);
+    /** Finds the reply to a request of the nym
+     *
+     *  Returns false unless the request has the same digest as the request
+     *  the reply was sent for.
+     */
+    bool Load(
+        const std::string& nymID,
+        const RequestNumber number,
+        const std::string& digest,
+        std::string& reply);
+    /** Returns the number of nyms whose replies are held in memory */
+    std::size_t Nyms() const;
+    void Store(
+        const std::string& nymID,
+        const RequestNumber number,
+        const std::string& digest,
+        const std::string& reply);
+
+    ReplyCache(
+        const std::string& dataFolder,
+        const std::size_t nyms,
+        const std::size_t perNym);
+
+    ~ReplyCache() = default;
+
+private:
+    /** digest of the request, signed reply */
+    using Reply = std::pair<std::string, std::string>;
+    using NymReplies = std::map<RequestNumber, Reply>;
+
+    const std::string data_folder_;
+    const std::size_t per_nym_;
+    mutable std::mutex lock_;
+    std::map<std::string, NymReplies> replies_;
+    RecentSet<std::string> nyms_;
+
+    std::size_t slot(const RequestNumber number) const;
+    std::string slot_name(
+        const std::string& nymID,
+        const std::size_t position) const;
+
+    NymReplies& load(const Lock& lock, const std::string& nymID);
+
+    ReplyCache() = delete;
+    ReplyCache(const ReplyCache&) = delete;
+    ReplyCache(ReplyCache&&) = delete;
+    ReplyCache& operator=(const ReplyCache&) = delete;
+    ReplyCache& operator=(ReplyCache&&) = delete;
+};
+}  // namespace opentxs::server
@@ -96,6 +96,7 @@ void ReplyMessage::attach_request()
                    << command << " message." << std::endl;
             message_.m_ascInReferenceTo.SetString(String(original_));
         } break;
+        case MessageType::getBoxReceipts:
         case MessageType::pingNotary:
         case MessageType::usageCredits:
         case MessageType::sendNymMessage:
@@ -132,6 +133,7 @@ void ReplyMessage::clear_request()
         case MessageType::issueBasket:
         case MessageType::registerAccount:
         case MessageType::getBoxReceipt:
+        case MessageType::getBoxReceipts:
         case MessageType::unregisterAccount:
         case MessageType::notarizeTransaction:
         case MessageType::processInbox:
@@ -228,6 +230,8 @@ void ReplyMessage::SetAcknowledgments(const ClientContext& context)
     message_.SetAcknowledgments(context);
 }
 
+void ReplyMessage::SetBool(const bool value) { message_.m_bBool = value; }
+
 void ReplyMessage::SetDepth(const std::int64_t depth)
 {
     message_.m_lDepth = depth;
@@ -43,6 +43,7 @@ public:
     void OverrideType(const String& accountID);
     void SetAccount(const String& accountID);
     void SetAcknowledgments(const ClientContext& context);
+    void SetBool(const bool value);
     void SetDepth(const std::int64_t depth);
     void SetInboxHash(const Identifier& hash);
     void SetInstrumentDefinitionID(const String& id);
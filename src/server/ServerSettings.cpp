@@ -17,6 +17,8 @@ namespace opentxs::server
 // (static)
 
 std::int64_t ServerSettings::__min_market_scale = 1;
+// The largest block of transaction numbers issued in a single request.
+std::int64_t ServerSettings::__max_number_block = 100;
 // The number of client requests that will be processed per heartbeat.
 std::int32_t ServerSettings::__heartbeat_no_requests = 10;
 // number of ms between each heartbeat.
@@ -23,6 +23,13 @@ struct ServerSettings {
         __min_market_scale = value;
     }
 
+    static std::int64_t GetMaxNumberBlock() { return __max_number_block; }
+
+    static void SetMaxNumberBlock(std::int64_t value)
+    {
+        __max_number_block = value;
+    }
+
     static std::int32_t GetHeartbeatNoRequests()
     {
         return __heartbeat_no_requests;
@@ -51,6 +58,7 @@ struct ServerSettings {
     }
 
     static std::int64_t __min_market_scale;
+    static std::int64_t __max_number_block;
 
     static std::int32_t __heartbeat_no_requests;
     static std::int32_t __heartbeat_ms_between_beats;
@@ -13,6 +13,7 @@
 #include "opentxs/core/AccountList.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Log.hpp"
+#include "opentxs/core/NumList.hpp"
 #include "opentxs/core/Nym.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/core/util/Assert.hpp"
@@ -22,6 +23,7 @@
 #include "Server.hpp"
 
 #include <cinttypes>
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <memory>
@@ -70,6 +72,29 @@ bool Transactor::issueNextTransactionNumber(
     return true;
 }
 
+bool Transactor::issueNextTransactionNumbers(
+    const std::size_t count,
+    NumList& output)
+{
+    if (0 == count) { return true; }
+
+    const auto first = transactionNumber_ + 1;
+    transactionNumber_ += static_cast<TransactionNumber>(count);
+
+    if (!server_.GetMainFile().SaveMainFile()) {
+        otErr << "Error saving main server file.\n";
+        transactionNumber_ = first - 1;
+
+        return false;
+    }
+
+    for (auto number = first; number <= transactionNumber_; ++number) {
+        output.Add(number);
+    }
+
+    return true;
+}
+
 bool Transactor::issueNextTransactionNumberToNym(
     ClientContext& context,
     TransactionNumber& lTransactionNumber)
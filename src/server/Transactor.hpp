@@ -10,6 +10,7 @@
 #include "opentxs/core/AccountList.hpp"
 #include "opentxs/Types.hpp"
 
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <memory>
@@ -28,6 +29,12 @@ public:
     ~Transactor() = default;
 
     bool issueNextTransactionNumber(TransactionNumber& txNumber);
+    /** Reserves a contiguous block of transaction numbers
+     *
+     *  The main file is saved once for the entire block rather than once per
+     *  number.
+     */
+    bool issueNextTransactionNumbers(const std::size_t count, NumList& output);
     bool issueNextTransactionNumberToNym(
         ClientContext& context,
         TransactionNumber& txNumber);
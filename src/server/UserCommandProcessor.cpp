@@ -50,10 +50,13 @@
 #include "ServerSettings.hpp"
 #include "Transactor.hpp"
 
+#include <algorithm>
 #include <cinttypes>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <vector>
 
 #define OT_METHOD "opentxs::UserCommandProcessor::"
 #define MAX_UNUSED_NUMBERS 100
@@ -61,6 +64,9 @@
 #define NYMBOX_DEPTH 0
 #define INBOX_DEPTH 1
 #define OUTBOX_DEPTH 2
+// Once the serialized receipts in a getBoxReceiptsResponse reach this many
+// bytes, the remaining receipts are left for the next request
+#define BOX_RECEIPTS_REPLY_LIMIT 1048576
 
 namespace opentxs::server
 {
@@ -168,12 +174,16 @@ UserCommandProcessor::UserCommandProcessor(
     const opentxs::api::server::Manager& manager)
     : server_(server)
     , manager_(manager)
+    , payload_lock_()
+    , payloads_()
+    , replies_(manager.DataFolder(), REPLY_CACHE_NYMS, REPLY_CACHE_LIMIT)
 {
 }
 
 bool UserCommandProcessor::add_numbers_to_nymbox(
     const TransactionNumber transactionNumber,
     const NumList& newNumbers,
+    const bool numberRanges,
     bool& savedNymbox,
     Ledger& nymbox,
     Identifier& nymboxHash) const
@@ -218,6 +228,7 @@ bool UserCommandProcessor::add_numbers_to_nymbox(
 
     if (transaction) {
         transaction->AddNumbersToTransaction(newNumbers);
+        transaction->SetNumberRanges(numberRanges);
         transaction->SignContract(server_.GetServerNym());
         transaction->SaveContract();
         // Any inbox/nymbox/outbox ledger will only itself contain
@@ -241,6 +252,21 @@ bool UserCommandProcessor::add_numbers_to_nymbox(
     return success;
 }
 
+void UserCommandProcessor::cache_reply(
+    const Message& msgIn,
+    const Message& msgOut) const
+{
+    const RequestNumber number = msgIn.m_strRequestNum.ToLong();
+    const auto digest = request_digest(msgIn);
+    const String serialized(msgOut);
+
+    if ((0 == number) || digest.empty() || (false == serialized.Exists())) {
+        return;
+    }
+
+    replies_.Store(msgIn.m_strNymID.Get(), number, digest, serialized.Get());
+}
+
 // ACKNOWLEDGMENTS OF REPLIES ALREADY RECEIVED (FOR OPTIMIZATION.)
 
 // On the client side, whenever the client is DEFINITELY made aware of the
@@ -475,6 +501,13 @@ bool UserCommandProcessor::check_usage_credits(ReplyMessage& reply) const
     return true;
 }
 
+void UserCommandProcessor::clear_cached_replies(const String& nymID) const
+{
+    if (false == nymID.Exists()) { return; }
+
+    replies_.Clear(nymID.Get());
+}
+
 bool UserCommandProcessor::cmd_add_claim(ReplyMessage& reply) const
 {
     const auto& msgIn = reply.Original();
@@ -525,7 +558,14 @@ bool UserCommandProcessor::cmd_check_nym(ReplyMessage& reply) const
     auto nym = server_.API().Wallet().Nym(Identifier::Factory(targetNym));
 
     if (nym) {
-        reply.SetPayload(proto::ProtoAsData(nym->asPublicNym()));
+        set_cached_payload(
+            std::string("nym/") + targetNym->Get(),
+            nym,
+            nym->Revision(),
+            [&nym](Armored& payload) -> bool {
+                return payload.SetData(proto::ProtoAsData(nym->asPublicNym()));
+            },
+            reply);
         reply.SetSuccess(true);
     }
 
@@ -869,6 +909,124 @@ bool UserCommandProcessor::cmd_get_box_receipt(ReplyMessage& reply) const
     return true;
 }
 
+bool UserCommandProcessor::cmd_get_box_receipts(ReplyMessage& reply) const
+{
+    const auto& msgIn = reply.Original();
+    const auto boxType = msgIn.m_lDepth;
+    reply.SetAccount(msgIn.m_strAcctID);
+    reply.SetDepth(boxType);
+
+    switch (boxType) {
+        case NYMBOX_DEPTH: {
+            OT_ENFORCE_PERMISSION_MSG(ServerSettings::__cmd_get_nymbox)
+        } break;
+        case INBOX_DEPTH: {
+            OT_ENFORCE_PERMISSION_MSG(ServerSettings::__cmd_get_inbox)
+        } break;
+        case OUTBOX_DEPTH: {
+            OT_ENFORCE_PERMISSION_MSG(ServerSettings::__cmd_get_outbox)
+        } break;
+        default: {
+            otErr << OT_METHOD << __FUNCTION__ << ": Invalid box type."
+                  << std::endl;
+
+            return false;
+        }
+    }
+
+    const auto& context = reply.Context();
+    const auto& nymID = context.RemoteNym().ID();
+    const auto& serverID = context.Server();
+    const auto& serverNym = *context.Nym();
+    const auto accountID = Identifier::Factory(msgIn.m_strAcctID);
+    std::unique_ptr<Ledger> box{};
+
+    switch (boxType) {
+        case NYMBOX_DEPTH: {
+            box = load_nymbox(nymID, serverID, serverNym, false);
+        } break;
+        case INBOX_DEPTH: {
+            box = load_inbox(nymID, accountID, serverID, serverNym, false);
+        } break;
+        case OUTBOX_DEPTH: {
+            box = load_outbox(nymID, accountID, serverID, serverNym, false);
+        } break;
+        default: {
+            otErr << OT_METHOD << __FUNCTION__ << ": Invalid box type."
+                  << std::endl;
+
+            return false;
+        }
+    }
+
+    if (false == bool(box)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to load or verify box."
+              << std::endl;
+
+        return false;
+    }
+
+    // The payload lists the receipts the client already has
+    const NumList known(String(msgIn.m_ascPayload));
+    std::unique_ptr<OTDB::Storable> pStorable(
+        OTDB::CreateObject(OTDB::STORED_OBJ_STRING_MAP));
+    auto receipts = dynamic_cast<OTDB::StringMap*>(pStorable.get());
+
+    if (nullptr == receipts) { return false; }
+
+    // LoadBoxReceipt replaces entries in the transaction map, so collect the
+    // numbers before loading any receipts
+    std::vector<TransactionNumber> missing{};
+
+    for (const auto& it : box->GetTransactionMap()) {
+        const auto& number = it.first;
+
+        if (false == known.Verify(number)) { missing.emplace_back(number); }
+    }
+
+    std::size_t bytes{0};
+    bool more{false};
+
+    for (const auto& number : missing) {
+        if (BOX_RECEIPTS_REPLY_LIMIT <= bytes) {
+            more = true;
+
+            break;
+        }
+
+        box->LoadBoxReceipt(number);
+        const auto transaction = box->GetTransaction(number);
+
+        if (false == verify_transaction(transaction.get(), serverNym)) {
+            // The client falls back to getBoxReceipt for anything missing
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Invalid box item: " << number << std::endl;
+
+            continue;
+        }
+
+        const String serialized(*transaction);
+        bytes += serialized.GetLength();
+        receipts->the_map[std::to_string(number)] = serialized.Get();
+    }
+
+    reply.SetBool(more);
+
+    if (receipts->the_map.empty()) {
+        reply.SetSuccess(true);
+
+        return true;
+    }
+
+    const auto output = OTDB::EncodeObject(*receipts);
+
+    if (output.empty()) { return false; }
+
+    reply.SetSuccess(reply.SetPayload(String(output)));
+
+    return true;
+}
+
 bool UserCommandProcessor::cmd_get_instrument_definition(
     ReplyMessage& reply) const
 {
@@ -880,7 +1038,7 @@ bool UserCommandProcessor::cmd_get_instrument_definition(
     const auto contractID =
         Identifier::Factory(msgIn.m_strInstrumentDefinitionID);
 
-    auto serialized = Data::Factory();
+    const std::string id{contractID->str()};
     auto unitDefiniton = server_.API().Wallet().UnitDefinition(contractID);
     // Perhaps the provided ID is actually a server contract, not an
     // instrument definition?
@@ -888,19 +1046,35 @@ bool UserCommandProcessor::cmd_get_instrument_definition(
 
     if (unitDefiniton) {
         reply.SetSuccess(true);
-        serialized = proto::ProtoAsData(unitDefiniton->PublicContract());
-        reply.SetPayload(serialized);
+        set_cached_payload(
+            "unit/" + id,
+            unitDefiniton,
+            0,
+            [&unitDefiniton](Armored& payload) -> bool {
+                return payload.SetData(
+                    proto::ProtoAsData(unitDefiniton->PublicContract()));
+            },
+            reply);
     } else if (server) {
         reply.SetSuccess(true);
-        serialized = proto::ProtoAsData(server->PublicContract());
-        reply.SetPayload(serialized);
+        set_cached_payload(
+            "server/" + id,
+            server,
+            0,
+            [&server](Armored& payload) -> bool {
+                return payload.SetData(
+                    proto::ProtoAsData(server->PublicContract()));
+            },
+            reply);
     }
 
     return true;
 }
 
 // Get the list of markets on this server.
-bool UserCommandProcessor::cmd_get_market_list(ReplyMessage& reply) const
+bool UserCommandProcessor::cmd_get_market_list(
+    ReplyMessage& reply,
+    Lock& lock) const
 {
     const auto& msgIn = reply.Original();
 
@@ -908,7 +1082,12 @@ bool UserCommandProcessor::cmd_get_market_list(ReplyMessage& reply) const
 
     Armored output{};
     std::int32_t count{0};
-    reply.SetSuccess(server_.Cron().GetMarketList(output, count));
+    // The market list is built from published snapshots, which cron does not
+    // modify in place
+    lock.unlock();
+    const bool success = server_.Cron().GetMarketList(output, count);
+    lock.lock();
+    reply.SetSuccess(success);
 
     if (reply.Success()) {
         reply.SetDepth(count);
@@ -923,7 +1102,9 @@ bool UserCommandProcessor::cmd_get_market_list(ReplyMessage& reply) const
 }
 
 // Get the publicly-available list of offers on a specific market.
-bool UserCommandProcessor::cmd_get_market_offers(ReplyMessage& reply) const
+bool UserCommandProcessor::cmd_get_market_offers(
+    ReplyMessage& reply,
+    Lock& lock) const
 {
     const auto& msgIn = reply.Original();
     reply.SetTargetNym(msgIn.m_strNymID2);
@@ -934,14 +1115,19 @@ bool UserCommandProcessor::cmd_get_market_offers(ReplyMessage& reply) const
 
     if (depth < 0) { depth = 0; }
 
+    Armored output{};
+    std::int32_t nOfferCount{0};
+    // Only the market's published snapshot is read
+    lock.unlock();
     const auto market =
         server_.Cron().GetMarket(Identifier::Factory(msgIn.m_strNymID2));
+    const bool success =
+        bool(market) && market->GetOfferList(output, depth, nOfferCount);
+    lock.lock();
 
     if (false == bool(market)) { return false; }
 
-    Armored output{};
-    std::int32_t nOfferCount{0};
-    reply.SetSuccess(market->GetOfferList(output, depth, nOfferCount));
+    reply.SetSuccess(success);
 
     if (reply.Success()) {
         reply.SetDepth(nOfferCount);
@@ -957,21 +1143,27 @@ bool UserCommandProcessor::cmd_get_market_offers(ReplyMessage& reply) const
 
 // Get a report of recent trades that have occurred on a specific market.
 bool UserCommandProcessor::cmd_get_market_recent_trades(
-    ReplyMessage& reply) const
+    ReplyMessage& reply,
+    Lock& lock) const
 {
     const auto& msgIn = reply.Original();
     reply.SetTargetNym(msgIn.m_strNymID2);
 
     OT_ENFORCE_PERMISSION_MSG(ServerSettings::__cmd_get_market_recent_trades);
 
+    Armored output;
+    std::int32_t count = 0;
+    // Only the market's published snapshot is read
+    lock.unlock();
     const auto market =
         server_.Cron().GetMarket(Identifier::Factory(msgIn.m_strNymID2));
+    const bool success =
+        bool(market) && market->GetRecentTradeList(output, count);
+    lock.lock();
 
     if (false == bool(market)) { return false; }
 
-    Armored output;
-    std::int32_t count = 0;
-    reply.SetSuccess(market->GetRecentTradeList(output, count));
+    reply.SetSuccess(success);
 
     if (reply.Success()) {
         reply.SetDepth(count);
@@ -998,7 +1190,15 @@ bool UserCommandProcessor::cmd_get_mint(ReplyMessage& reply) const
 
     if (mint) {
         reply.SetSuccess(true);
-        reply.SetPayload(String(*mint));
+        // A new public mint object is loaded whenever the mint changes
+        set_cached_payload(
+            std::string("mint/") + unitID->Get(),
+            mint,
+            0,
+            [&mint](Armored& payload) -> bool {
+                return payload.SetString(String(*mint));
+            },
+            reply);
     }
 
     return true;
@@ -1153,20 +1353,22 @@ bool UserCommandProcessor::cmd_get_transaction_numbers(
 
     OT_ASSERT(false != bool(theLedger));
 
+    // The client may ask to reserve a larger block than the default, up to
+    // the limit set by the server operator. That limit can not go below the
+    // default, nor above the number of numbers a client will parse.
+    const auto maximum = std::min<std::int64_t>(
+        std::max<std::int64_t>(
+            ServerSettings::GetMaxNumberBlock(), ISSUE_NUMBER_BATCH),
+        OT_NUMLIST_MAX_RANGE_NUMBERS);
+    const auto count = std::min(
+        std::max<std::int64_t>(msgIn.m_lDepth, ISSUE_NUMBER_BATCH), maximum);
     NumList theNumlist;
 
-    for (std::int32_t i = 0; i < ISSUE_NUMBER_BATCH; i++) {
-        TransactionNumber number{0};
-
-        if (!server_.GetTransactor().issueNextTransactionNumber(number)) {
-            number = 0;
-            otErr << OT_METHOD << __FUNCTION__
-                  << ": Error issuing next transaction number." << std::endl;
-            bSuccess = false;
-            break;
-        }
-
-        theNumlist.Add(number);
+    if (!server_.GetTransactor().issueNextTransactionNumbers(
+            static_cast<std::size_t>(count), theNumlist)) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Error issuing transaction numbers." << std::endl;
+        bSuccess = false;
     }
 
     TransactionNumber transactionNumber{0};
@@ -1183,9 +1385,11 @@ bool UserCommandProcessor::cmd_get_transaction_numbers(
     }
 
     if (bSuccess) {
+        // Only clients which announced support receive the block as a run
         reply.SetSuccess(add_numbers_to_nymbox(
             transactionNumber,
             theNumlist,
+            msgIn.SupportsNumberRanges(),
             bSavedNymbox,
             *theLedger,
             NYMBOX_HASH));
@@ -2046,6 +2250,10 @@ bool UserCommandProcessor::cmd_register_nym(ReplyMessage& reply) const
 
     otLog3 << OT_METHOD << __FUNCTION__ << ": Signature verified!" << std::endl;
 
+    // Registration may reset the request number, so earlier replies must not
+    // be returned for requests which reuse a number
+    clear_cached_replies(String(sender_nym->ID()));
+
     if (false == reply.LoadContext()) { return false; }
 
     auto& context = reply.Context();
@@ -2525,6 +2733,23 @@ bool UserCommandProcessor::isAdmin(const Identifier& nymID)
     return (0 == adminNym.compare(String(nymID).Get()));
 }
 
+bool UserCommandProcessor::load_cached_reply(
+    const Message& msgIn,
+    std::string& reply) const
+{
+    const RequestNumber number = msgIn.m_strRequestNum.ToLong();
+
+    if (0 == number) { return false; }
+
+    const auto digest = request_digest(msgIn);
+
+    if (digest.empty()) { return false; }
+
+    // Only a request which matches the original byte for byte gets the
+    // original reply
+    return replies_.Load(msgIn.m_strNymID.Get(), number, digest, reply);
+}
+
 std::unique_ptr<Ledger> UserCommandProcessor::load_inbox(
     const Identifier& nymID,
     const Identifier& accountID,
@@ -2658,7 +2883,39 @@ std::unique_ptr<Ledger> UserCommandProcessor::load_outbox(
 
 bool UserCommandProcessor::ProcessUserCommand(
     const Message& msgIn,
-    Message& msgOut)
+    Message& msgOut,
+    Lock& lock)
+{
+    OT_ASSERT(lock.owns_lock())
+
+    bool consumedRequest{false};
+    std::string cachedReply{};
+    const bool output = process_user_command(
+        msgIn, msgOut, consumedRequest, cachedReply, lock);
+
+    if (false == cachedReply.empty()) {
+        otWarn << OT_METHOD << __FUNCTION__ << ": Received a duplicate "
+               << msgIn.m_strCommand << " message. Nym: " << msgIn.m_strNymID
+               << " Request: " << msgIn.m_strRequestNum
+               << ". Returning the cached reply." << std::endl;
+
+        // Replace the reply built while authenticating the request with the
+        // one which was sent the first time
+        return msgOut.LoadContractFromString(String(cachedReply));
+    }
+
+    // The reply is signed once process_user_command returns
+    if (consumedRequest) { cache_reply(msgIn, msgOut); }
+
+    return output;
+}
+
+bool UserCommandProcessor::process_user_command(
+    const Message& msgIn,
+    Message& msgOut,
+    bool& consumedRequest,
+    std::string& cachedReply,
+    Lock& lock)
 {
     const std::string command(msgIn.m_strCommand.Get());
     const auto type = Message::Type(command);
@@ -2692,6 +2949,11 @@ bool UserCommandProcessor::ProcessUserCommand(
 
     if (false == check_client_nym(reply)) { return false; }
 
+    // A client which timed out waiting for a reply resends the same request.
+    // Now that the sender is authenticated, answer it with the reply which
+    // was sent the first time instead of processing it again.
+    if (load_cached_reply(msgIn, cachedReply)) { return true; }
+
     OT_ASSERT(reply.HaveContext());
 
     auto& context = reply.Context();
@@ -2720,6 +2982,7 @@ bool UserCommandProcessor::ProcessUserCommand(
         if (false == check_usage_credits(reply)) { return false; }
 
         context.IncrementRequest();
+        consumedRequest = true;
     }
 
     // At this point, we KNOW that it is EITHER a GetRequestNumber command,
@@ -2770,6 +3033,9 @@ bool UserCommandProcessor::ProcessUserCommand(
         case MessageType::getBoxReceipt: {
             return cmd_get_box_receipt(reply);
         }
+        case MessageType::getBoxReceipts: {
+            return cmd_get_box_receipts(reply);
+        }
         case MessageType::getAccountData: {
             return cmd_get_account_data(reply);
         }
@@ -2793,13 +3059,13 @@ bool UserCommandProcessor::ProcessUserCommand(
 #endif  // OT_CASH
         }
         case MessageType::getMarketList: {
-            return cmd_get_market_list(reply);
+            return cmd_get_market_list(reply, lock);
         }
         case MessageType::getMarketOffers: {
-            return cmd_get_market_offers(reply);
+            return cmd_get_market_offers(reply, lock);
         }
         case MessageType::getMarketRecentTrades: {
-            return cmd_get_market_recent_trades(reply);
+            return cmd_get_market_recent_trades(reply, lock);
         }
         case MessageType::getNymMarketOffers: {
             return cmd_get_nym_market_offers(reply);
@@ -2866,6 +3132,19 @@ bool UserCommandProcessor::reregister_nym(ReplyMessage& reply) const
     return true;
 }
 
+std::string UserCommandProcessor::request_digest(const Message& msgIn) const
+{
+    const String serialized(msgIn);
+
+    if (false == serialized.Exists()) { return {}; }
+
+    auto digest = Identifier::Factory();
+
+    if (false == digest->CalculateDigest(serialized)) { return {}; }
+
+    return digest->str();
+}
+
 bool UserCommandProcessor::save_box(const Nym& nym, Ledger& box) const
 {
     box.ReleaseSignatures();
@@ -2911,6 +3190,60 @@ bool UserCommandProcessor::save_outbox(
     return true;
 }
 
+bool UserCommandProcessor::set_cached_payload(
+    const std::string& key,
+    const std::shared_ptr<const void>& object,
+    const std::uint64_t revision,
+    const PayloadSerializer& serialize,
+    ReplyMessage& reply) const
+{
+    Lock lock(payload_lock_);
+    auto it = payloads_.find(key);
+
+    if (payloads_.end() != it) {
+        const auto& [version, payload] = it->second;
+        const auto& [owner, cachedRevision] = version;
+        const bool sameObject =
+            (false == owner.owner_before(object)) &&
+            (false == object.owner_before(owner));
+
+        if (sameObject && (revision == cachedRevision)) {
+            reply.SetPayload(payload);
+
+            return true;
+        }
+
+        payloads_.erase(it);
+    }
+
+    Armored payload{};
+
+    if (false == serialize(payload)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to serialize " << key
+              << std::endl;
+
+        return false;
+    }
+
+    reply.SetPayload(payload);
+
+    if (PAYLOAD_CACHE_LIMIT <= payloads_.size()) {
+        for (auto i = payloads_.begin(); i != payloads_.end();) {
+            if (i->second.first.first.expired()) {
+                i = payloads_.erase(i);
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    if (PAYLOAD_CACHE_LIMIT <= payloads_.size()) { payloads_.clear(); }
+
+    payloads_.emplace(key, CachedPayload{{object, revision}, payload});
+
+    return true;
+}
+
 bool UserCommandProcessor::verify_box(
     const Identifier& ownerID,
     Ledger& box,
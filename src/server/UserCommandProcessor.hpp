@@ -7,10 +7,18 @@
 
 #include "Internal.hpp"
 
+#include "opentxs/core/Armored.hpp"
 #include "opentxs/Types.hpp"
 
+#include "ReplyCache.hpp"
+
 #include <cstdint>
+#include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
 
 namespace opentxs
 {
@@ -36,7 +44,9 @@ public:
         ClientContext& context,
         Server& server) const;
 
-    bool ProcessUserCommand(const Message& msgIn, Message& msgOut);
+    /** lock is the processing lock held by the caller. It is only released
+     *  while market data queries read published market snapshots. */
+    bool ProcessUserCommand(const Message& msgIn, Message& msgOut, Lock& lock);
 
 private:
     friend class Server;
@@ -70,15 +80,31 @@ private:
         std::size_t counter_{0};
     };
 
+    // Identifies the object a cached payload was serialized from: the
+    // object itself (compared by ownership, never dereferenced) and its
+    // revision
+    using PayloadVersion = std::pair<std::weak_ptr<const void>, std::uint64_t>;
+    using CachedPayload = std::pair<PayloadVersion, Armored>;
+    using PayloadSerializer = std::function<bool(Armored&)>;
+
+    static const std::size_t PAYLOAD_CACHE_LIMIT{4096};
+    static const std::size_t REPLY_CACHE_LIMIT{16};
+    static const std::size_t REPLY_CACHE_NYMS{64};
+
     Server& server_;
     const opentxs::api::server::Manager& manager_;
+    mutable std::mutex payload_lock_;
+    mutable std::map<std::string, CachedPayload> payloads_;
+    mutable ReplyCache replies_;
 
     bool add_numbers_to_nymbox(
         const TransactionNumber transactionNumber,
         const NumList& newNumbers,
+        const bool numberRanges,
         bool& savedNymbox,
         Ledger& nymbox,
         Identifier& nymboxHash) const;
+    void cache_reply(const Message& msgIn, const Message& msgOut) const;
     void check_acknowledgements(ReplyMessage& reply) const;
     bool check_client_nym(ReplyMessage& reply) const;
     bool check_ping_notary(const Message& msgIn) const;
@@ -86,19 +112,21 @@ private:
         const Message& msgIn,
         const RequestNumber& correctNumber) const;
     bool check_usage_credits(ReplyMessage& reply) const;
+    void clear_cached_replies(const String& nymID) const;
     bool cmd_add_claim(ReplyMessage& reply) const;
     bool cmd_check_nym(ReplyMessage& reply) const;
     bool cmd_delete_asset_account(ReplyMessage& reply) const;
     bool cmd_delete_user(ReplyMessage& reply) const;
     bool cmd_get_account_data(ReplyMessage& reply) const;
     bool cmd_get_box_receipt(ReplyMessage& reply) const;
+    bool cmd_get_box_receipts(ReplyMessage& reply) const;
     // Get the publicly-available list of offers on a specific market.
     bool cmd_get_instrument_definition(ReplyMessage& reply) const;
     // Get the list of markets on this server.
-    bool cmd_get_market_list(ReplyMessage& reply) const;
-    bool cmd_get_market_offers(ReplyMessage& reply) const;
+    bool cmd_get_market_list(ReplyMessage& reply, Lock& lock) const;
+    bool cmd_get_market_offers(ReplyMessage& reply, Lock& lock) const;
     // Get a report of recent trades that have occurred on a specific market.
-    bool cmd_get_market_recent_trades(ReplyMessage& reply) const;
+    bool cmd_get_market_recent_trades(ReplyMessage& reply, Lock& lock) const;
 #if OT_CASH
     bool cmd_get_mint(ReplyMessage& reply) const;
 #endif  // OT_CASH
@@ -126,7 +154,14 @@ private:
         const Identifier& serverID,
         const Nym& serverNym) const;
     bool hash_check(const ClientContext& context, Identifier& nymboxHash) const;
+    bool set_cached_payload(
+        const std::string& key,
+        const std::shared_ptr<const void>& object,
+        const std::uint64_t revision,
+        const PayloadSerializer& serialize,
+        ReplyMessage& reply) const;
     RequestNumber initialize_request_number(ClientContext& context) const;
+    bool load_cached_reply(const Message& msgIn, std::string& reply) const;
     std::unique_ptr<Ledger> load_inbox(
         const Identifier& nymID,
         const Identifier& accountID,
@@ -144,7 +179,14 @@ private:
         const Identifier& serverID,
         const Nym& serverNym,
         const bool verifyAccount) const;
+    bool process_user_command(
+        const Message& msgIn,
+        Message& msgOut,
+        bool& consumedRequest,
+        std::string& cachedReply,
+        Lock& lock);
     bool reregister_nym(ReplyMessage& reply) const;
+    std::string request_digest(const Message& msgIn) const;
     bool save_box(const Nym& nym, Ledger& box) const;
     bool save_inbox(const Nym& nym, Identifier& hash, Ledger& inbox) const;
     bool save_nymbox(const Nym& nym, Identifier& hash, Ledger& nymbox) const;
@@ -10,10 +10,72 @@
 #include "opentxs/api/storage/Storage.hpp"
 #include "opentxs/core/Log.hpp"
 
+#include <algorithm>
+#include <vector>
+
 #define OT_METHOD "opentxs::Plugin::"
 
 namespace opentxs
 {
+const std::size_t Plugin::FILTER_MINIMUM_CAPACITY{65536};
+const std::size_t Plugin::Filter::BITS_PER_KEY{10};
+const std::size_t Plugin::Filter::HASHES{7};
+
+Plugin::Filter::Filter(const std::size_t capacity)
+    : capacity_(capacity)
+    , bits_(64 * ((capacity * BITS_PER_KEY + 63) / 64))
+    , data_(new std::atomic<std::uint64_t>[bits_ / 64]())
+    , count_(0)
+{
+    OT_ASSERT(data_);
+}
+
+void Plugin::Filter::Add(const std::string& key)
+{
+    const std::uint64_t first = std::hash<std::string>{}(key);
+    const std::uint64_t second = mix(first) | 1;
+
+    for (std::size_t i = 0; i < HASHES; ++i) {
+        const auto bit = (first + i * second) % bits_;
+        data_[bit / 64].fetch_or(
+            std::uint64_t(1) << (bit % 64), std::memory_order_release);
+    }
+
+    if (++count_ == capacity_ + 1) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Membership filter is full. Lookups are unfiltered until "
+                 "the next garbage collection."
+              << std::endl;
+    }
+}
+
+bool Plugin::Filter::MaybeContains(const std::string& key) const
+{
+    if (count_.load() > capacity_) { return true; }
+
+    const std::uint64_t first = std::hash<std::string>{}(key);
+    const std::uint64_t second = mix(first) | 1;
+
+    for (std::size_t i = 0; i < HASHES; ++i) {
+        const auto bit = (first + i * second) % bits_;
+        const auto word = data_[bit / 64].load(std::memory_order_acquire);
+
+        if (0 == (word & (std::uint64_t(1) << (bit % 64)))) { return false; }
+    }
+
+    return true;
+}
+
+std::uint64_t Plugin::Filter::mix(std::uint64_t value)
+{
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ULL;
+    value ^= value >> 33;
+
+    return value;
+}
 
 Plugin::Plugin(
     const api::storage::Storage& storage,
@@ -26,7 +88,58 @@ Plugin::Plugin(
     , storage_(storage)
     , digest_(hash)
     , current_bucket_(bucket)
+    , filter_lock_()
+    , filter_()
+{
+}
+
+bool Plugin::absent(const std::string& key, const bool bucket) const
+{
+    sLock lock(filter_lock_);
+    const auto& filter = filter_[filter_index(bucket)];
+
+    if (false == bool(filter)) { return false; }
+
+    return (false == filter->MaybeContains(key));
+}
+
+std::size_t Plugin::filter_index(const bool bucket) const
+{
+    if (shared_buckets()) { return 0; }
+
+    return bucket ? 1 : 0;
+}
+
+void Plugin::init_filter() const
+{
+    const std::vector<bool> buckets =
+        shared_buckets() ? std::vector<bool>{false}
+                         : std::vector<bool>{false, true};
+
+    for (const auto bucket : buckets) {
+        std::vector<std::string> keys{};
+        const auto listed =
+            list_bucket(bucket, [&keys](const std::string& key) -> void {
+                keys.emplace_back(key);
+            });
+
+        if (false == listed) { continue; }
+
+        std::unique_ptr<Filter> filter{new Filter(
+            std::max(FILTER_MINIMUM_CAPACITY, 2 * keys.size()))};
+
+        OT_ASSERT(filter);
+
+        for (const auto& key : keys) { filter->Add(key); }
+
+        eLock lock(filter_lock_);
+        filter_[filter_index(bucket)].reset(filter.release());
+    }
+}
+
+bool Plugin::list_bucket(const bool, const KeyCallback&) const
 {
+    return false;
 }
 
 bool Plugin::Load(
@@ -46,30 +159,40 @@ bool Plugin::Load(
     bool valid = false;
     const bool bucket{current_bucket_};
 
-    if (LoadFromBucket(key, value, bucket)) { valid = 0 < value.size(); }
+    if (load_from_bucket(key, value, bucket)) { valid = 0 < value.size(); }
 
     if (!valid) {
         // try again in the other bucket
-        if (LoadFromBucket(key, value, !bucket)) {
+        if (load_from_bucket(key, value, !bucket)) {
             valid = 0 < value.size();
         } else {
             // just in case...
-            if (LoadFromBucket(key, value, bucket)) {
+            if (load_from_bucket(key, value, bucket)) {
                 valid = 0 < value.size();
             }
         }
     }
 
     if (!valid && !checking) {
-        otWarn << OT_METHOD << __FUNCTION__
-               << ": Specified object is not found." << std::endl
-               << "Hash: " << key << std::endl
-               << "Size: " << value.size() << std::endl;
+        OT_LOG_IF(otWarn) << OT_METHOD << __FUNCTION__
+                          << ": Specified object is not found." << std::endl
+                          << "Hash: " << key << std::endl
+                          << "Size: " << value.size() << std::endl;
     }
 
     return valid;
 }
 
+bool Plugin::load_from_bucket(
+    const std::string& key,
+    std::string& value,
+    const bool bucket) const
+{
+    if (absent(key, bucket)) { return false; }
+
+    return LoadFromBucket(key, value, bucket);
+}
+
 bool Plugin::Migrate(
     const std::string& key,
     const opentxs::api::storage::Driver& to) const
@@ -83,7 +206,7 @@ bool Plugin::Migrate(
     if (&to == this) { sourceBucket = !targetBucket; }
 
     // try to load the key from the source bucket
-    if (LoadFromBucket(key, value, sourceBucket)) {
+    if (load_from_bucket(key, value, sourceBucket)) {
 
         // save to the target bucket
         if (to.Store(false, key, value, targetBucket)) {
@@ -101,7 +224,8 @@ bool Plugin::Migrate(
     const bool exists = to.LoadFromBucket(key, value, targetBucket);
 
     if (!exists) {
-        otInfo << OT_METHOD << __FUNCTION__ << ": Missing key." << std::endl;
+        OT_LOG_IF(otInfo) << OT_METHOD << __FUNCTION__ << ": Missing key."
+                          << std::endl;
 
         return false;
     }
@@ -109,12 +233,37 @@ bool Plugin::Migrate(
     return true;
 }
 
+void Plugin::remember(const std::string& key, const bool bucket) const
+{
+    sLock lock(filter_lock_);
+    auto& filter = filter_[filter_index(bucket)];
+
+    if (filter) { filter->Add(key); }
+}
+
+void Plugin::reset_filter(const bool bucket) const
+{
+    eLock lock(filter_lock_);
+    auto& filter = filter_[filter_index(bucket)];
+
+    if (false == bool(filter)) { return; }
+
+    // The other bucket holds the live objects, so it is the best estimate of
+    // how many keys this one will receive after the next flip
+    const auto& other = filter_[filter_index(!bucket)];
+    const std::size_t live = other ? other->Count() : 0;
+    filter.reset(new Filter(std::max(FILTER_MINIMUM_CAPACITY, 2 * live)));
+}
+
 bool Plugin::Store(
     const bool isTransaction,
     const std::string& key,
     const std::string& value,
     const bool bucket) const
 {
+    // The key must be visible to the filter before it is visible to the
+    // driver, or a concurrent lookup could miss a stored object
+    remember(key, bucket);
     std::promise<bool> promise;
     auto future = promise.get_future();
     store(isTransaction, key, value, bucket, &promise);
@@ -129,6 +278,7 @@ void Plugin::Store(
     const bool bucket,
     std::promise<bool>& promise) const
 {
+    remember(key, bucket);
     std::thread thread(
         &Plugin::store, this, isTransaction, key, value, bucket, &promise);
     thread.detach();
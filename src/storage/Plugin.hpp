@@ -13,7 +13,12 @@
 #include "opentxs/Proto.hpp"
 #include "opentxs/Types.hpp"
 
+#include <array>
 #include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <shared_mutex>
 #include <string>
 
 namespace opentxs
@@ -68,9 +73,21 @@ public:
     virtual ~Plugin() = default;
 
 protected:
+    using KeyCallback = std::function<void(const std::string&)>;
+
     const StorageConfig& config_;
     const Random& random_;
 
+    /** Loads the membership filters from the keys already present in the
+     *  buckets. Drivers call this once at the end of their initialization.
+     */
+    void init_filter() const;
+    /** Drivers call this after they empty a bucket, and only if the bucket
+     *  was emptied, so that a failed garbage collection keeps the keys which
+     *  are still stored. Nothing is written to the bucket being emptied.
+     */
+    void reset_filter(const bool bucket) const;
+
     Plugin(
         const api::storage::Storage& storage,
         const StorageConfig& config,
@@ -79,6 +96,14 @@ protected:
         const Flag& bucket);
     Plugin() = delete;
 
+    /** Visits every key in a bucket
+     *
+     *  Returns false if the driver can not enumerate its keys, in which case
+     *  lookups are never filtered.
+     */
+    virtual bool list_bucket(const bool bucket, const KeyCallback& cb) const;
+    /** True if the driver ignores the bucket argument */
+    virtual bool shared_buckets() const { return false; }
     virtual void store(
         const bool isTransaction,
         const std::string& key,
@@ -87,9 +112,54 @@ protected:
         std::promise<bool>* promise) const = 0;
 
 private:
+    /** Bloom filter over the keys in a bucket
+     *
+     *  A negative answer means the key is definitely absent. Once more keys
+     *  have been added than the filter was sized for, every answer is
+     *  positive until the bucket is emptied or the process restarts.
+     */
+    class Filter
+    {
+    public:
+        void Add(const std::string& key);
+        std::size_t Count() const { return count_.load(); }
+        bool MaybeContains(const std::string& key) const;
+
+        Filter(const std::size_t capacity);
+
+    private:
+        static const std::size_t BITS_PER_KEY;
+        static const std::size_t HASHES;
+
+        static std::uint64_t mix(std::uint64_t value);
+
+        const std::size_t capacity_;
+        const std::size_t bits_;
+        std::unique_ptr<std::atomic<std::uint64_t>[]> data_;
+        std::atomic<std::size_t> count_;
+
+        Filter() = delete;
+        Filter(const Filter&) = delete;
+        Filter(Filter&&) = delete;
+        Filter& operator=(const Filter&) = delete;
+        Filter& operator=(Filter&&) = delete;
+    };
+
+    static const std::size_t FILTER_MINIMUM_CAPACITY;
+
     const api::storage::Storage& storage_;
     const Digest& digest_;
     const Flag& current_bucket_;
+    mutable std::shared_mutex filter_lock_;
+    mutable std::array<std::unique_ptr<Filter>, 2> filter_;
+
+    bool absent(const std::string& key, const bool bucket) const;
+    std::size_t filter_index(const bool bucket) const;
+    bool load_from_bucket(
+        const std::string& key,
+        std::string& value,
+        const bool bucket) const;
+    void remember(const std::string& key, const bool bucket) const;
 
     Plugin(const Plugin&) = delete;
     Plugin(Plugin&&) = delete;
@@ -18,6 +18,7 @@
 #define STORAGE_CONFIG_PRIMARY_PLUGIN_KEY "primary_plugin"
 #define STORAGE_CONFIG_FS_BACKUP_DIRECTORY_KEY "fs_backup_directory"
 #define STORAGE_CONFIG_FS_ENCRYPTED_BACKUP_DIRECTORY_KEY "fs_encrypted_backup"
+#define STORAGE_CONFIG_ASYNC_BACKUP_KEY "async_backup"
 
 namespace C = std::chrono;
 
@@ -36,6 +37,8 @@ public:
         C::duration_cast<C::seconds>(C::hours(1)).count();
     std::string path_{};
     InsertCB dht_callback_{};
+    bool async_backup_ = false;
+    std::string backup_journal_file_ = "backup_journal";
 
 #if OT_STORAGE_SQLITE
     std::string primary_plugin_ = OT_STORAGE_PRIMARY_PLUGIN_SQLITE;
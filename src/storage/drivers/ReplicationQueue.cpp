@@ -0,0 +1,382 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "stdafx.hpp"
+
+#include "opentxs/core/Log.hpp"
+
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "ReplicationQueue.hpp"
+
+#define OT_METHOD "opentxs::storage::implementation::ReplicationQueue::"
+
+namespace opentxs::storage::implementation
+{
+ReplicationQueue::ReplicationQueue(
+    const std::string& journal,
+    const std::size_t maxPending)
+    : path_(journal)
+    , max_pending_(maxPending)
+    , lock_()
+    , signal_()
+    , progress_()
+    , queue_()
+    , journal_(-1)
+    , applied_(0)
+    , gap_(false)
+    , dropped_(0)
+    , shutdown_(false)
+{
+}
+
+bool ReplicationQueue::append(const int fd, const std::string& data)
+{
+    if (-1 == fd) { return false; }
+
+    const char* position = data.data();
+    std::size_t remaining = data.size();
+
+    while (0 < remaining) {
+        const auto written = ::write(fd, position, remaining);
+
+        if (0 > written) {
+            if (EINTR == errno) { continue; }
+
+            return false;
+        }
+
+        position += written;
+        remaining -= written;
+    }
+
+    return true;
+}
+
+bool ReplicationQueue::CloseGap(const std::uint64_t dropped)
+{
+    Lock lock(lock_);
+
+    if (false == gap_) { return true; }
+
+    if (dropped != dropped_) { return false; }
+
+    gap_ = false;
+    // Removes the gap entry from the journal
+    trim(lock);
+
+    return true;
+}
+
+void ReplicationQueue::close_journal(const Lock& lock)
+{
+    OT_ASSERT(lock.owns_lock() && (&lock_ == lock.mutex()));
+
+    if (-1 != journal_) { ::close(journal_); }
+
+    journal_ = -1;
+}
+
+std::uint64_t ReplicationQueue::Dropped() const
+{
+    Lock lock(lock_);
+
+    return dropped_;
+}
+
+bool ReplicationQueue::Gap() const
+{
+    Lock lock(lock_);
+
+    return gap_;
+}
+
+std::size_t ReplicationQueue::Lag(std::chrono::milliseconds& age) const
+{
+    Lock lock(lock_);
+
+    if (queue_.empty()) {
+        age = std::chrono::milliseconds(0);
+
+        return 0;
+    }
+
+    age = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - queue_.front().queued_);
+
+    return queue_.size();
+}
+
+bool ReplicationQueue::LaterRoot() const
+{
+    Lock lock(lock_);
+
+    for (std::size_t i = 1; i < queue_.size(); ++i) {
+        if (Replication::Type::Root == queue_[i].type_) { return true; }
+    }
+
+    return false;
+}
+
+bool ReplicationQueue::Next(Replication& output)
+{
+    Lock lock(lock_);
+    signal_.wait(lock, [&]() -> bool {
+        return shutdown_.load() || (false == queue_.empty());
+    });
+
+    if (shutdown_.load()) { return false; }
+
+    // The entry stays queued until it has been applied so that Lag counts it
+    // and a trimmed journal still records its key
+    auto& front = queue_.front();
+    output = Replication{front.type_,
+                         front.transaction_,
+                         front.flag_,
+                         front.key_,
+                         std::move(front.value_),
+                         front.queued_,
+                         front.dropped_};
+
+    return true;
+}
+
+std::size_t ReplicationQueue::Open(bool& malformed)
+{
+    Lock lock(lock_);
+    std::ifstream file(path_);
+    std::string line{};
+    const auto now = std::chrono::steady_clock::now();
+    std::size_t output{0};
+    malformed = false;
+
+    while (std::getline(file, line)) {
+        std::istringstream entry(line);
+        int type{-1};
+        Replication item{};
+        entry >> type >> item.transaction_ >> item.flag_ >> item.key_;
+
+        if (entry.fail() || (0 > type) ||
+            (static_cast<int>(Replication::Type::Gap) < type)) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Discarding malformed journal entry." << std::endl;
+            malformed = true;
+
+            continue;
+        }
+
+        item.type_ = static_cast<Replication::Type>(type);
+
+        if (Replication::Type::Gap == item.type_) {
+            gap_ = true;
+
+            continue;
+        }
+
+        item.queued_ = now;
+        queue_.emplace_back(std::move(item));
+        ++output;
+    }
+
+    file.close();
+    open_journal(lock);
+
+    // A lost entry can only be recovered by a full synchronization
+    if (malformed && (false == gap_)) {
+        Replication gap{};
+        gap.type_ = Replication::Type::Gap;
+        gap.key_ = "-";
+        gap_ = true;
+        write(lock, gap, true);
+    }
+
+    return output;
+}
+
+void ReplicationQueue::open_journal(const Lock& lock)
+{
+    OT_ASSERT(lock.owns_lock() && (&lock_ == lock.mutex()));
+
+    journal_ = ::open(path_.c_str(), O_WRONLY | O_APPEND | O_CREAT, 0600);
+
+    if (-1 == journal_) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to open replication journal." << std::endl;
+    }
+}
+
+void ReplicationQueue::Pop()
+{
+    Lock lock(lock_);
+
+    if (queue_.empty()) { return; }
+
+    queue_.pop_front();
+    ++applied_;
+
+    if (applied_ >= queue_.size()) { trim(lock); }
+
+    progress_.notify_all();
+}
+
+void ReplicationQueue::Push(Replication&& item)
+{
+    item.queued_ = std::chrono::steady_clock::now();
+    Lock lock(lock_);
+    const bool object{Replication::Type::Object == item.type_};
+
+    // The synchronization which closes the gap copies every object the
+    // primary references, so objects written in the meantime are not needed
+    if (gap_ && object) {
+        ++dropped_;
+
+        return;
+    }
+
+    // Bound the memory held by writes the backups have not caught up with
+    progress_.wait(lock, [&]() -> bool {
+        return shutdown_.load() || (max_pending_ > queue_.size());
+    });
+
+    item.dropped_ = dropped_;
+    // A root is only written to the primary after the objects it references,
+    // so syncing once per root makes every journaled object durable before
+    // anything refers to it
+    write(lock, item, (false == object));
+    queue_.emplace_back(std::move(item));
+    signal_.notify_one();
+}
+
+std::string ReplicationQueue::serialize(const Replication& item)
+{
+    std::ostringstream output{};
+    output << static_cast<int>(item.type_) << ' ' << item.transaction_ << ' '
+           << item.flag_ << ' ' << item.key_ << '\n';
+
+    return output.str();
+}
+
+void ReplicationQueue::SetGap()
+{
+    Lock lock(lock_);
+
+    if (gap_) { return; }
+
+    Replication gap{};
+    gap.type_ = Replication::Type::Gap;
+    gap.key_ = "-";
+    gap_ = true;
+    write(lock, gap, true);
+}
+
+void ReplicationQueue::Shutdown()
+{
+    Lock lock(lock_);
+    shutdown_.store(true);
+    signal_.notify_all();
+    progress_.notify_all();
+}
+
+std::size_t ReplicationQueue::Size() const
+{
+    Lock lock(lock_);
+
+    return queue_.size();
+}
+
+bool ReplicationQueue::sync(const int fd)
+{
+#if defined(__APPLE__)
+    return 0 == ::fcntl(fd, F_FULLFSYNC);
+#else
+    return 0 == ::fsync(fd);
+#endif
+}
+
+// Replaces the journal with the entries which are still pending. The new
+// journal is written and synced beside the old one and renamed over it, so a
+// crash at any point leaves a journal which covers every pending write.
+void ReplicationQueue::trim(const Lock& lock)
+{
+    OT_ASSERT(lock.owns_lock() && (&lock_ == lock.mutex()));
+
+    const auto temp = path_ + ".tmp";
+    std::string contents{};
+
+    if (gap_) {
+        Replication gap{};
+        gap.type_ = Replication::Type::Gap;
+        gap.key_ = "-";
+        contents += serialize(gap);
+    }
+
+    for (const auto& item : queue_) { contents += serialize(item); }
+
+    const auto fd = ::open(temp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    const bool written = append(fd, contents) && sync(fd);
+
+    if (-1 != fd) { ::close(fd); }
+
+    if (false == written) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to write trimmed replication journal."
+              << std::endl;
+
+        return;
+    }
+
+    close_journal(lock);
+
+    if (0 != std::rename(temp.c_str(), path_.c_str())) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to replace replication journal." << std::endl;
+    } else {
+        applied_ = 0;
+    }
+
+    open_journal(lock);
+}
+
+void ReplicationQueue::Wait() const
+{
+    Lock lock(lock_);
+    progress_.wait(lock, [&]() -> bool {
+        return shutdown_.load() || queue_.empty();
+    });
+}
+
+void ReplicationQueue::write(
+    const Lock& lock,
+    const Replication& item,
+    const bool flush)
+{
+    OT_ASSERT(lock.owns_lock() && (&lock_ == lock.mutex()));
+
+    if (false == append(journal_, serialize(item))) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to write replication journal." << std::endl;
+
+        return;
+    }
+
+    if (flush && (false == sync(journal_))) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to sync replication journal." << std::endl;
+    }
+}
+
+ReplicationQueue::~ReplicationQueue()
+{
+    Lock lock(lock_);
+    close_journal(lock);
+}
+}  // namespace opentxs::storage::implementation
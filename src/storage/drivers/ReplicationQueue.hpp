@@ -0,0 +1,137 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Internal.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+
+namespace opentxs::storage::implementation
+{
+/** A write which has been applied to the primary plugin and is waiting to
+ *  be applied to the backup plugins
+ *
+ *  flag_ holds the bucket for objects and bucket operations, and the commit
+ *  argument for roots. An empty value_ for an object means the value must be
+ *  read back from the primary plugin, which is the case for entries
+ *  recovered from the journal after a restart.
+ *
+ *  Gap entries only exist in the journal, where they record that the backups
+ *  are missing writes.
+ */
+struct Replication {
+    enum class Type : std::uint8_t {
+        Object = 0,
+        Root = 1,
+        Empty = 2,
+        Gap = 3,
+    };
+
+    Type type_{Type::Object};
+    bool transaction_{false};
+    bool flag_{false};
+    std::string key_{};
+    std::string value_{};
+    std::chrono::steady_clock::time_point queued_{};
+    /** For roots, the number of objects dropped before the root was queued */
+    std::uint64_t dropped_{0};
+};
+
+/** Bounded queue of backup writes, mirrored to a journal file so that writes
+ *  still pending at shutdown are resumed on the next start
+ *
+ *  The journal only records keys. Applied entries are trimmed from it once
+ *  they outnumber the pending ones, so rewriting it costs a constant amount
+ *  per entry however long the backups lag behind. Object entries are written
+ *  to the journal as they arrive, and the journal is synced to disk with
+ *  every root and bucket operation, which covers the objects before it.
+ *
+ *  Once a backup write fails the backups can only be repaired by a full
+ *  synchronization, so until the gap is closed object writes are dropped
+ *  instead of queued and the journal keeps a gap entry in their place.
+ */
+class ReplicationQueue
+{
+public:
+    /** Ends the gap, unless objects were dropped after the root the backups
+     *  were synchronized to was queued
+     *
+     *  dropped is the value Dropped() returned, or the dropped_ value of the
+     *  root, before the synchronization started. Returns true if the gap is
+     *  closed.
+     */
+    bool CloseGap(const std::uint64_t dropped);
+    /** Returns the number of object writes dropped during gaps */
+    std::uint64_t Dropped() const;
+    bool Gap() const;
+    /** Returns the number of pending writes and the age of the oldest one */
+    std::size_t Lag(std::chrono::milliseconds& age) const;
+    /** True if a root is queued behind the oldest pending write */
+    bool LaterRoot() const;
+    /** Moves the oldest pending write into output, waiting for one to
+     *  arrive. The write stays queued until Pop is called. Returns false on
+     *  shutdown. */
+    bool Next(Replication& output);
+    /** Queues the writes recorded in the journal and opens it for appending
+     *
+     *  Returns the number of recovered writes. malformed is set if any entry
+     *  could not be parsed, in which case a gap is opened.
+     */
+    std::size_t Open(bool& malformed);
+    /** Removes the oldest pending write after it has been applied */
+    void Pop();
+    /** Queues and journals a write, blocking while the queue is full
+     *
+     *  Object writes are dropped while a gap is open.
+     */
+    void Push(Replication&& item);
+    /** Opens a gap and records it in the journal */
+    void SetGap();
+    void Shutdown();
+    std::size_t Size() const;
+    /** Blocks until every queued write has been popped */
+    void Wait() const;
+
+    ReplicationQueue(const std::string& journal, const std::size_t maxPending);
+
+    ~ReplicationQueue();
+
+private:
+    const std::string path_;
+    const std::size_t max_pending_;
+    mutable std::mutex lock_;
+    mutable std::condition_variable signal_;
+    mutable std::condition_variable progress_;
+    std::deque<Replication> queue_;
+    int journal_;
+    // Journal entries applied since the journal was last trimmed
+    std::size_t applied_;
+    bool gap_;
+    std::uint64_t dropped_;
+    std::atomic<bool> shutdown_;
+
+    static bool append(const int fd, const std::string& data);
+    static std::string serialize(const Replication& item);
+    static bool sync(const int fd);
+
+    void close_journal(const Lock& lock);
+    void open_journal(const Lock& lock);
+    void trim(const Lock& lock);
+    void write(const Lock& lock, const Replication& item, const bool flush);
+
+    ReplicationQueue() = delete;
+    ReplicationQueue(const ReplicationQueue&) = delete;
+    ReplicationQueue(ReplicationQueue&&) = delete;
+    ReplicationQueue& operator=(const ReplicationQueue&) = delete;
+    ReplicationQueue& operator=(ReplicationQueue&&) = delete;
+};
+}  // namespace opentxs::storage::implementation
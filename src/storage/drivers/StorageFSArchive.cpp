@@ -140,6 +140,32 @@ void StorageFSArchive::Init_StorageFSArchive()
     boost::system::error_code ec{};
 
     if (boost::filesystem::create_directory(folder_, ec)) { ready_->On(); }
+
+    init_filter();
+}
+
+bool StorageFSArchive::list_bucket(const bool, const KeyCallback& cb) const
+{
+    const auto root = boost::filesystem::path(root_filename()).filename();
+    boost::system::error_code ec{};
+    boost::filesystem::recursive_directory_iterator it(folder_, ec);
+
+    if (ec) { return false; }
+
+    for (; boost::filesystem::recursive_directory_iterator() != it;
+         it.increment(ec)) {
+        if (ec) { return false; }
+
+        if (false == boost::filesystem::is_regular_file(it->status())) {
+            continue;
+        }
+
+        const auto name = it->path().filename();
+
+        if (root != name) { cb(name.string()); }
+    }
+
+    return true;
 }
 
 std::string StorageFSArchive::prepare_read(const std::string& input) const
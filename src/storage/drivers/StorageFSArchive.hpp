@@ -31,9 +31,11 @@ private:
         const std::string& key,
         const bool bucket,
         std::string& directory) const override;
+    bool list_bucket(const bool bucket, const KeyCallback& cb) const override;
     std::string prepare_read(const std::string& ciphertext) const override;
     std::string prepare_write(const std::string& plaintext) const override;
     std::string root_filename() const override;
+    bool shared_buckets() const override { return true; }
 
     void Init_StorageFSArchive();
     void Cleanup_StorageFSArchive();
@@ -84,6 +84,7 @@ bool StorageFSGC::EmptyBucket(const bool bucket) const
         return false;
     }
 
+    reset_filter(bucket);
     std::thread backgroundDelete(&StorageFSGC::purge, this, newName);
     backgroundDelete.detach();
 
@@ -97,6 +98,27 @@ void StorageFSGC::Init_StorageFSGC()
     boost::filesystem::create_directory(
         folder_ + path_seperator_ + config_.fs_secondary_bucket_);
     ready_->On();
+    init_filter();
+}
+
+bool StorageFSGC::list_bucket(const bool bucket, const KeyCallback& cb) const
+{
+    std::string directory{};
+    calculate_path("", bucket, directory);
+    boost::system::error_code ec{};
+    boost::filesystem::directory_iterator it(directory, ec);
+
+    if (ec) { return false; }
+
+    for (; boost::filesystem::directory_iterator() != it; it.increment(ec)) {
+        if (ec) { return false; }
+
+        if (boost::filesystem::is_regular_file(it->status())) {
+            cb(it->path().filename().string());
+        }
+    }
+
+    return true;
 }
 
 void StorageFSGC::purge(const std::string& path) const
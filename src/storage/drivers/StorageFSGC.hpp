@@ -30,6 +30,7 @@ private:
         const std::string& key,
         const bool bucket,
         std::string& directory) const override;
+    bool list_bucket(const bool bucket, const KeyCallback& cb) const override;
     void purge(const std::string& path) const;
     std::string root_filename() const override;
 
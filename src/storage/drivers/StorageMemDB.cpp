@@ -78,6 +78,7 @@ StorageMemDB::StorageMemDB(
     , a_()
     , b_()
 {
+    init_filter();
 }
 
 bool StorageMemDB::EmptyBucket(const bool bucket) const
@@ -90,6 +91,9 @@ bool StorageMemDB::EmptyBucket(const bool bucket) const
         b_.clear();
     }
 
+    lock.unlock();
+    reset_filter(bucket);
+
     return true;
 }
 
@@ -99,21 +103,25 @@ bool StorageMemDB::LoadFromBucket(
     const bool bucket) const
 {
     sLock lock(shared_lock_);
+    const auto& map = bucket ? a_ : b_;
+    const auto it = map.find(key);
 
-    try {
-        if (bucket) {
-            value = a_.at(key);
-        } else {
-            value = b_.at(key);
-        }
-    } catch (...) {
+    if (map.end() == it) { return false; }
 
-        return false;
-    }
+    value = it->second;
 
     return (false == value.empty());
 }
 
+bool StorageMemDB::list_bucket(const bool bucket, const KeyCallback& cb) const
+{
+    sLock lock(shared_lock_);
+
+    for (const auto& it : bucket ? a_ : b_) { cb(it.first); }
+
+    return true;
+}
+
 std::string StorageMemDB::LoadRoot() const
 {
     sLock lock(shared_lock_);
@@ -67,6 +67,7 @@ private:
     mutable std::map<std::string, std::string> a_{};
     mutable std::map<std::string, std::string> b_{};
 
+    bool list_bucket(const bool bucket, const KeyCallback& cb) const override;
     void store(
         const bool isTransaction,
         const std::string& key,
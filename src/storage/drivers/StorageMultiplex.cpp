@@ -54,6 +54,8 @@ opentxs::api::storage::Multiplex* Factory::StorageMultiplex(
 
 namespace opentxs::storage::implementation
 {
+const std::size_t StorageMultiplex::REPLICATION_MAX_PENDING{10000};
+
 StorageMultiplex::StorageMultiplex(
     const api::storage::Storage& storage,
     const Flag& primaryBucket,
@@ -71,10 +73,100 @@ StorageMultiplex::StorageMultiplex(
     , digest_(hash)
     , random_(random)
     , null_(crypto::key::Symmetric::Factory())
+    , replication_(
+          config.path_ + "/" + config.backup_journal_file_,
+          REPLICATION_MAX_PENDING)
+    , replicating_(false)
+    , replicator_()
 {
     Init_StorageMultiplex(primary, migrate, previous);
 }
 
+bool StorageMultiplex::apply(Replication& item) const
+{
+    bool output{true};
+
+    switch (item.type_) {
+        case Replication::Type::Object: {
+            // The synchronization which closes the gap copies this object
+            if (replication_.Gap()) { return true; }
+
+            if (item.value_.empty()) {
+                OT_ASSERT(primary_plugin_);
+
+                if (false ==
+                    primary_plugin_->Load(item.key_, true, item.value_)) {
+                    otErr << OT_METHOD << __FUNCTION__ << ": Object "
+                          << item.key_
+                          << " is no longer available for replication."
+                          << std::endl;
+                    replication_.SetGap();
+
+                    return false;
+                }
+            }
+
+            for (const auto& plugin : backup_plugins_) {
+                OT_ASSERT(plugin);
+
+                if (false == plugin->Store(
+                                 item.transaction_,
+                                 item.key_,
+                                 item.value_,
+                                 item.flag_)) {
+                    replication_.SetGap();
+                    output = false;
+                }
+            }
+        } break;
+        case Replication::Type::Root: {
+            // A backup root must never reference an object the backup plugin
+            // does not have, so during a gap the backups are synchronized to
+            // the newest queued root instead
+            if (replication_.Gap()) {
+                if (replication_.LaterRoot()) { return true; }
+
+                if (false == repair(item.key_)) { return false; }
+
+                if (replication_.CloseGap(item.dropped_)) {
+                    otErr << OT_METHOD << __FUNCTION__
+                          << ": Backup plugins are synchronized." << std::endl;
+                }
+
+                return true;
+            }
+
+            for (const auto& plugin : backup_plugins_) {
+                OT_ASSERT(plugin);
+
+                output &= plugin->StoreRoot(item.flag_, item.key_);
+            }
+        } break;
+        case Replication::Type::Empty: {
+            for (const auto& plugin : backup_plugins_) {
+                OT_ASSERT(plugin);
+
+                plugin->EmptyBucket(item.flag_);
+            }
+        } break;
+        default: {
+            OT_FAIL;
+        }
+    }
+
+    if (false == output) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Backup write failed."
+              << std::endl;
+    }
+
+    return output;
+}
+
+std::size_t StorageMultiplex::BackupLag(std::chrono::milliseconds& age) const
+{
+    return replication_.Lag(age);
+}
+
 std::string StorageMultiplex::BestRoot(bool& primaryOutOfSync)
 {
     OT_ASSERT(primary_plugin_);
@@ -132,12 +224,30 @@ std::string StorageMultiplex::BestRoot(bool& primaryOutOfSync)
 
 void StorageMultiplex::Cleanup() { Cleanup_StorageMultiplex(); }
 
-void StorageMultiplex::Cleanup_StorageMultiplex() {}
+void StorageMultiplex::Cleanup_StorageMultiplex()
+{
+    replication_.Shutdown();
+
+    if (replicator_.joinable()) { replicator_.join(); }
+}
 
 bool StorageMultiplex::EmptyBucket(const bool bucket) const
 {
     OT_ASSERT(primary_plugin_);
 
+    if (replicating_.load()) {
+        const auto output = primary_plugin_->EmptyBucket(bucket);
+
+        if (output) {
+            Replication item{};
+            item.type_ = Replication::Type::Empty;
+            item.flag_ = bucket;
+            replication_.Push(std::move(item));
+        }
+
+        return output;
+    }
+
     for (const auto& plugin : backup_plugins_) {
         OT_ASSERT(plugin);
 
@@ -177,6 +287,24 @@ void StorageMultiplex::init_fs(
 #endif
 }
 
+void StorageMultiplex::init_replication()
+{
+    if (false == config_.async_backup_) { return; }
+
+    if (replicator_.joinable()) { return; }
+
+    bool malformed{false};
+    const auto pending = replication_.Open(malformed);
+
+    if (0 < pending) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Resuming " << pending
+              << " backup writes." << std::endl;
+    }
+
+    replicator_ = std::thread(&StorageMultiplex::replicate, this);
+    replicating_.store(true);
+}
+
 void StorageMultiplex::init_memdb(
     std::unique_ptr<opentxs::api::storage::Plugin>& plugin)
 {
@@ -228,6 +356,7 @@ void StorageMultiplex::InitBackup()
         primary_bucket_,
         config_.fs_backup_directory_,
         null_));
+    init_replication();
 #else
     return;
 #endif
@@ -247,6 +376,7 @@ void StorageMultiplex::InitEncryptedBackup([
         primary_bucket_,
         config_.fs_encrypted_backup_directory_,
         key));
+    init_replication();
 #else
     return;
 #endif
@@ -262,8 +392,9 @@ bool StorageMultiplex::Load(
     if (primary_plugin_->Load(key, checking, value)) { return true; }
 
     if (false == checking) {
-        otInfo << OT_METHOD << __FUNCTION__
-               << ": key not found by primary storage plugin." << std::endl;
+        OT_LOG_IF(otInfo) << OT_METHOD << __FUNCTION__
+                          << ": key not found by primary storage plugin."
+                          << std::endl;
     }
 
     std::size_t count{0};
@@ -279,9 +410,9 @@ bool StorageMultiplex::Load(
         }
 
         if (false == checking) {
-            otInfo << OT_METHOD << __FUNCTION__
-                   << ": key not found by backup storage plugin " << count
-                   << std::endl;
+            OT_LOG_IF(otInfo) << OT_METHOD << __FUNCTION__
+                              << ": key not found by backup storage plugin "
+                              << count << std::endl;
         }
 
         ++count;
@@ -393,6 +524,34 @@ void StorageMultiplex::migrate_primary(
     old.reset(newPlugin.release());
 }
 
+bool StorageMultiplex::repair(const std::string& hash) const
+{
+    auto bucket = Flag::Factory(false);
+    std::unique_ptr<storage::Root> root{nullptr};
+
+    try {
+        root.reset(new storage::Root(
+            *this, hash, std::numeric_limits<std::int64_t>::max(), bucket));
+    } catch (std::runtime_error&) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to load root " << hash
+              << std::endl;
+
+        return false;
+    }
+
+    return synchronize_backups(hash, *root);
+}
+
+void StorageMultiplex::replicate()
+{
+    Replication item{};
+
+    while (replication_.Next(item)) {
+        apply(item);
+        replication_.Pop();
+    }
+}
+
 opentxs::api::storage::Driver& StorageMultiplex::Primary()
 {
     OT_ASSERT(primary_plugin_);
@@ -408,6 +567,22 @@ bool StorageMultiplex::Store(
 {
     OT_ASSERT(primary_plugin_);
 
+    if (replicating_.load()) {
+        const auto output =
+            primary_plugin_->Store(isTransaction, key, value, bucket);
+
+        if (output) {
+            Replication item{};
+            item.transaction_ = isTransaction;
+            item.flag_ = bucket;
+            item.key_ = key;
+            item.value_ = value;
+            replication_.Push(std::move(item));
+        }
+
+        return output;
+    }
+
     std::vector<std::promise<bool>> promises{};
     std::vector<std::future<bool>> futures{};
     promises.push_back(std::promise<bool>());
@@ -452,6 +627,19 @@ bool StorageMultiplex::Store(
 
     bool output = primary_plugin_->Store(isTransaction, key, value);
 
+    if (replicating_.load()) {
+        if (false == output) { return output; }
+
+        Replication item{};
+        item.transaction_ = isTransaction;
+        item.flag_ = primary_bucket_;
+        item.key_ = value;
+        item.value_ = key;
+        replication_.Push(std::move(item));
+
+        return output;
+    }
+
     for (const auto& plugin : backup_plugins_) {
         OT_ASSERT(plugin);
 
@@ -466,6 +654,20 @@ bool StorageMultiplex::StoreRoot(const bool commit, const std::string& hash)
 {
     OT_ASSERT(primary_plugin_);
 
+    if (replicating_.load()) {
+        const auto output = primary_plugin_->StoreRoot(commit, hash);
+
+        if (output) {
+            Replication item{};
+            item.type_ = Replication::Type::Root;
+            item.flag_ = commit;
+            item.key_ = hash;
+            replication_.Push(std::move(item));
+        }
+
+        return output;
+    }
+
     for (const auto& plugin : backup_plugins_) {
         OT_ASSERT(plugin);
 
@@ -475,31 +677,12 @@ bool StorageMultiplex::StoreRoot(const bool commit, const std::string& hash)
     return primary_plugin_->StoreRoot(commit, hash);
 }
 
-void StorageMultiplex::SynchronizePlugins(
+bool StorageMultiplex::synchronize_backups(
     const std::string& hash,
-    const storage::Root& root,
-    const bool syncPrimary)
+    const storage::Root& root) const
 {
     const auto& tree = root.Tree();
-
-    if (syncPrimary) {
-        OT_ASSERT(primary_plugin_);
-
-        otErr << OT_METHOD << __FUNCTION__ << ": Primary plugin is out of sync."
-              << std::endl;
-
-        const auto migrated = tree.Migrate(*primary_plugin_);
-
-        if (migrated) {
-            otErr << OT_METHOD << __FUNCTION__
-                  << ": Successfully restored primary plugin from backup."
-                  << std::endl;
-        } else {
-            otErr << OT_METHOD << __FUNCTION__
-                  << ": Failed to restore primary plugin from backup."
-                  << std::endl;
-        }
-    }
+    bool synchronized{true};
 
     for (const auto& plugin : backup_plugins_) {
         OT_ASSERT(plugin);
@@ -516,20 +699,60 @@ void StorageMultiplex::SynchronizePlugins(
         } else {
             otErr << OT_METHOD << __FUNCTION__
                   << ": Failed to initialize backup plugin." << std::endl;
+            synchronized = false;
         }
 
         if (false == root.Save(*plugin)) {
             otErr << OT_METHOD << __FUNCTION__
                   << ": Failed to update root index object for backup plugin."
                   << std::endl;
+            synchronized = false;
         }
 
         if (false == plugin->StoreRoot(false, hash)) {
             otErr << OT_METHOD << __FUNCTION__
                   << ": Failed to update root hash for backup plugin."
                   << std::endl;
+            synchronized = false;
+        }
+    }
+
+    return synchronized;
+}
+
+void StorageMultiplex::SynchronizePlugins(
+    const std::string& hash,
+    const storage::Root& root,
+    const bool syncPrimary)
+{
+    const auto& tree = root.Tree();
+
+    if (syncPrimary) {
+        OT_ASSERT(primary_plugin_);
+
+        otErr << OT_METHOD << __FUNCTION__ << ": Primary plugin is out of sync."
+              << std::endl;
+
+        const auto migrated = tree.Migrate(*primary_plugin_);
+
+        if (migrated) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Successfully restored primary plugin from backup."
+                  << std::endl;
+        } else {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Failed to restore primary plugin from backup."
+                  << std::endl;
         }
     }
+
+    // Let writes recovered from the journal reach the backups before deciding
+    // whether they need a full migration
+    if (replicating_.load()) { replication_.Wait(); }
+
+    const auto dropped = replication_.Dropped();
+
+    if (synchronize_backups(hash, root)) { replication_.CloseGap(dropped); }
 }
 
 StorageMultiplex::~StorageMultiplex() { Cleanup_StorageMultiplex(); }
@@ -7,6 +7,12 @@
 
 #include "Internal.hpp"
 
+#include "ReplicationQueue.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 namespace opentxs::storage::implementation
 {
 class StorageMultiplex : virtual public opentxs::api::storage::Multiplex
@@ -40,6 +46,7 @@ public:
         std::string& key) const override;
     bool StoreRoot(const bool commit, const std::string& hash) const override;
 
+    std::size_t BackupLag(std::chrono::milliseconds& age) const override;
     std::string BestRoot(bool& primaryOutOfSync) override;
     void InitBackup() override;
     void InitEncryptedBackup(crypto::key::Symmetric& key) override;
@@ -54,6 +61,8 @@ public:
 private:
     friend Factory;
 
+    static const std::size_t REPLICATION_MAX_PENDING;
+
     const api::storage::Storage& storage_;
     const Flag& primary_bucket_;
     const StorageConfig& config_;
@@ -62,6 +71,9 @@ private:
     const Digest digest_;
     const Random random_;
     OTSymmetricKey null_;
+    mutable ReplicationQueue replication_;
+    std::atomic<bool> replicating_;
+    std::thread replicator_;
 
     StorageMultiplex(
         const api::storage::Storage& storage,
@@ -78,6 +90,13 @@ private:
     StorageMultiplex& operator=(const StorageMultiplex&) = delete;
     StorageMultiplex& operator=(StorageMultiplex&&) = delete;
 
+    bool apply(Replication& item) const;
+    /** Synchronizes the backups to a root read from the primary plugin */
+    bool repair(const std::string& hash) const;
+    bool synchronize_backups(
+        const std::string& hash,
+        const storage::Root& root) const;
+
     void Cleanup();
     void Cleanup_StorageMultiplex();
     void init(
@@ -85,11 +104,13 @@ private:
         std::unique_ptr<opentxs::api::storage::Plugin>& plugin);
     void init_fs(std::unique_ptr<opentxs::api::storage::Plugin>& plugin);
     void init_memdb(std::unique_ptr<opentxs::api::storage::Plugin>& plugin);
+    void init_replication();
     void init_sqlite(std::unique_ptr<opentxs::api::storage::Plugin>& plugin);
     void Init_StorageMultiplex(
         const String& primary,
         const bool migrate,
         const String& previous);
     void migrate_primary(const std::string& from, const std::string& to);
+    void replicate();
 };
 }  // namespace opentxs::storage::implementation
@@ -61,20 +61,6 @@ StorageSqlite3::StorageSqlite3(
     Init_StorageSqlite3();
 }
 
-std::string StorageSqlite3::bind_key(
-    const std::string& source,
-    const std::string& key,
-    const std::size_t start) const
-{
-    sqlite3_stmt* statement{nullptr};
-    sqlite3_prepare_v2(db_, source.c_str(), -1, &statement, nullptr);
-    sqlite3_bind_text(statement, start, key.c_str(), key.size(), SQLITE_STATIC);
-    const auto output = expand_sql(statement);
-    sqlite3_finalize(statement);
-
-    return output;
-}
-
 void StorageSqlite3::Cleanup() { Cleanup_StorageSqlite3(); }
 
 void StorageSqlite3::Cleanup_StorageSqlite3() { sqlite3_close(db_); }
@@ -93,7 +79,7 @@ bool StorageSqlite3::commit_transaction(const std::string& rootHash) const
     set_root(rootHash, sql);
     commit(sql);
     pending_.clear();
-    otInfo << sql.str() << std::endl;
+    OT_LOG_IF(otInfo) << sql.str() << std::endl;
 
     return (
         SQLITE_OK ==
@@ -112,7 +98,11 @@ bool StorageSqlite3::Create(const std::string& tablename) const
 
 bool StorageSqlite3::EmptyBucket(const bool bucket) const
 {
-    return Purge(GetTableName(bucket));
+    if (false == Purge(GetTableName(bucket))) { return false; }
+
+    reset_filter(bucket);
+
+    return true;
 }
 
 std::string StorageSqlite3::expand_sql(sqlite3_stmt* statement) const
@@ -143,6 +133,7 @@ void StorageSqlite3::Init_StorageSqlite3()
         Create(config_.sqlite3_primary_bucket_);
         Create(config_.sqlite3_secondary_bucket_);
         Create(config_.sqlite3_control_table_);
+        init_filter();
     } else {
         otErr << OT_METHOD << __FUNCTION__ << "Failed to initialize database."
               << std::endl;
@@ -151,6 +142,39 @@ void StorageSqlite3::Init_StorageSqlite3()
     }
 }
 
+bool StorageSqlite3::list_bucket(const bool bucket, const KeyCallback& cb)
+    const
+{
+    sqlite3_stmt* statement{nullptr};
+    const std::string query = "SELECT k FROM `" + GetTableName(bucket) + "`;";
+
+    if (SQLITE_OK !=
+        sqlite3_prepare_v2(db_, query.c_str(), -1, &statement, nullptr)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to list keys."
+              << std::endl;
+        sqlite3_finalize(statement);
+
+        return false;
+    }
+
+    auto result = sqlite3_step(statement);
+
+    while (SQLITE_ROW == result) {
+        const auto size = sqlite3_column_bytes(statement, 0);
+        const auto key = sqlite3_column_text(statement, 0);
+
+        if (nullptr != key) {
+            cb(std::string(reinterpret_cast<const char*>(key), size));
+        }
+
+        result = sqlite3_step(statement);
+    }
+
+    sqlite3_finalize(statement);
+
+    return (SQLITE_DONE == result);
+}
+
 bool StorageSqlite3::LoadFromBucket(
     const std::string& key,
     std::string& value,
@@ -192,9 +216,9 @@ bool StorageSqlite3::Select(
     sqlite3_stmt* statement{nullptr};
     const std::string query =
         "SELECT v FROM '" + tablename + "' WHERE k GLOB ?1;";
-    const auto sql = bind_key(query, key, 1);
-    sqlite3_prepare_v2(db_, sql.c_str(), -1, &statement, 0);
-    otInfo << sql << std::endl;
+    sqlite3_prepare_v2(db_, query.c_str(), -1, &statement, 0);
+    sqlite3_bind_text(statement, 1, key.c_str(), key.size(), SQLITE_STATIC);
+    OT_LOG_IF(otInfo) << expand_sql(statement) << std::endl;
     auto result = sqlite3_step(statement);
     bool success = false;
     std::size_t retry{3};
@@ -347,7 +371,7 @@ bool StorageSqlite3::Upsert(
     sqlite3_prepare_v2(db_, query.c_str(), -1, &statement, 0);
     sqlite3_bind_text(statement, 1, key.c_str(), key.size(), SQLITE_STATIC);
     sqlite3_bind_blob(statement, 2, value.c_str(), value.size(), SQLITE_STATIC);
-    otInfo << expand_sql(statement) << std::endl;
+    OT_LOG_IF(otInfo) << expand_sql(statement) << std::endl;
     const auto result = sqlite3_step(statement);
     sqlite3_finalize(statement);
 
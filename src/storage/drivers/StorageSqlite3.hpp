@@ -38,15 +38,12 @@ private:
         pending_;
     sqlite3* db_{nullptr};
 
-    std::string bind_key(
-        const std::string& source,
-        const std::string& key,
-        const std::size_t start) const;
     void commit(std::stringstream& sql) const;
     bool commit_transaction(const std::string& rootHash) const;
     bool Create(const std::string& tablename) const;
     std::string expand_sql(sqlite3_stmt* statement) const;
     std::string GetTableName(const bool bucket) const;
+    bool list_bucket(const bool bucket, const KeyCallback& cb) const override;
     bool Select(
         const std::string& key,
         const std::string& tablename,
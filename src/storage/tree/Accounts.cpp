@@ -11,6 +11,10 @@
 
 #include "storage/Plugin.hpp"
 
+#include <map>
+#include <string>
+#include <vector>
+
 #define EXTRACT_SET_BY_VALUE(index, value)                                     \
     {                                                                          \
         try {                                                                  \
@@ -39,27 +43,19 @@
 #define SERIALIZE_INDEX(index, field)                                          \
     {                                                                          \
         for (const auto& [id, accounts] : index) {                             \
-            if (id->empty()) { continue; }                                     \
-                                                                               \
-            auto& listProto = *serialized.add_##field();                       \
+            auto& listProto = *output.add_##field();                           \
             listProto.set_version(INDEX_VERSION);                              \
-            listProto.set_id(id->str());                                       \
+            listProto.set_id(id);                                              \
                                                                                \
             for (const auto& accountID : accounts) {                           \
-                if (accountID->empty()) { continue; }                          \
-                                                                               \
-                listProto.add_list(accountID->str());                          \
-            }                                                                  \
-                                                                               \
-            if (0 == listProto.list_size()) {                                  \
-                serialized.mutable_##field()->RemoveLast();                    \
+                listProto.add_list(accountID);                                 \
             }                                                                  \
         }                                                                      \
     }
 
 #define DESERIALIZE_INDEX(field, index, position)                              \
     {                                                                          \
-        for (const auto& it : serialized->field()) {                           \
+        for (const auto& it : input.field()) {                                 \
             const auto id = Identifier::Factory(it.id());                      \
                                                                                \
             auto& map = index[id];                                             \
@@ -336,18 +332,29 @@ void Accounts::init(const std::string& hash)
     // Upgrade version
     if (ACCOUNT_VERSION > version_) { version_ = ACCOUNT_VERSION; }
 
-    for (const auto& it : serialized->account()) {
-        item_map_.emplace(
-            it.itemid(), Metadata{it.hash(), it.alias(), 0, false});
-    }
+    load_items<proto::StorageAccounts>(
+        *serialized,
+        [](const proto::StorageAccounts& list) -> const ItemList& {
+            return list.account();
+        },
+        [&](const proto::StorageAccounts& list) -> void {
+            load_indices(lock, list);
+        });
+}
 
+// Index pages carry the index entries of their own accounts, so these are
+// merged from the index proto and from every page
+void Accounts::load_indices(
+    const Lock& lock,
+    const proto::StorageAccounts& input)
+{
     DESERIALIZE_INDEX(owner, owner_index_, 0)
     DESERIALIZE_INDEX(signer, signer_index_, 1)
     DESERIALIZE_INDEX(issuer, issuer_index_, 2)
     DESERIALIZE_INDEX(server, server_index_, 3)
     DESERIALIZE_INDEX(unit, contract_index_, 4)
 
-    for (const auto& it : serialized->index()) {
+    for (const auto& it : input.index()) {
         const auto unit = it.type();
         auto& map = unit_index_[unit];
 
@@ -376,55 +383,75 @@ bool Accounts::save(const Lock& lock) const
         OT_FAIL;
     }
 
-    auto serialized = serialize();
-
-    if (false == proto::Validate(serialized, VERBOSE)) { return false; }
-
-    return driver_.StoreProto(serialized, root_);
+    proto::StorageAccounts serialized;
+    serialized.set_version(version_);
+    return save_items<proto::StorageAccounts>(
+        lock,
+        serialized,
+        [](proto::StorageAccounts& list) -> proto::StorageItemHash* {
+            return list.add_account();
+        },
+        proto::STORAGEHASH_RAW,
+        [&](const std::string& prefix, proto::StorageAccounts& list) -> void {
+            serialize_indices(lock, prefix, list);
+        });
 }
 
-proto::StorageAccounts Accounts::serialize() const
+// Adds the index entries for the accounts whose ids start with prefix
+void Accounts::serialize_indices(
+    const Lock& lock,
+    const std::string& prefix,
+    proto::StorageAccounts& output) const
 {
-    proto::StorageAccounts serialized;
-    serialized.set_version(version_);
+    OT_ASSERT(verify_write_lock(lock))
 
-    for (const auto item : item_map_) {
-        const bool goodID = !item.first.empty();
-        const bool goodHash = check_hash(std::get<0>(item.second));
-        const bool good = goodID && goodHash;
-
-        if (good) {
-            serialize_index(
-                item.first,
-                item.second,
-                *serialized.add_account(),
-                proto::STORAGEHASH_RAW);
-        }
+    using Entries = std::map<std::string, std::vector<std::string>>;
+
+    Entries owner{};
+    Entries signer{};
+    Entries issuer{};
+    Entries server{};
+    Entries contract{};
+    std::map<proto::ContactItemType, std::vector<std::string>> units{};
+
+    for (auto it = item_map_.lower_bound(prefix);
+         (item_map_.end() != it) &&
+         (0 == it->first.compare(0, prefix.size(), prefix));
+         ++it) {
+        const auto& id = it->first;
+        const auto data = account_data_.find(Identifier::Factory(id));
+
+        if (account_data_.end() == data) { continue; }
+
+        const auto& [ownerID, signerID, issuerID, serverID, contractID, unit] =
+            data->second;
+        auto add = [&id](const OTIdentifier& key, Entries& index) -> void {
+            if (false == key->empty()) { index[key->str()].emplace_back(id); }
+        };
+        add(ownerID, owner);
+        add(signerID, signer);
+        add(issuerID, issuer);
+        add(serverID, server);
+        add(contractID, contract);
+
+        if (proto::CITEMTYPE_UNKNOWN != unit) { units[unit].emplace_back(id); }
     }
 
-    SERIALIZE_INDEX(owner_index_, owner)
-    SERIALIZE_INDEX(signer_index_, signer)
-    SERIALIZE_INDEX(issuer_index_, issuer)
-    SERIALIZE_INDEX(server_index_, server)
-    SERIALIZE_INDEX(contract_index_, unit)
+    SERIALIZE_INDEX(owner, owner)
+    SERIALIZE_INDEX(signer, signer)
+    SERIALIZE_INDEX(issuer, issuer)
+    SERIALIZE_INDEX(server, server)
+    SERIALIZE_INDEX(contract, unit)
 
-    for (const auto& [type, accounts] : unit_index_) {
-        auto& listProto = *serialized.add_index();
+    for (const auto& [type, accounts] : units) {
+        auto& listProto = *output.add_index();
         listProto.set_version(INDEX_VERSION);
         listProto.set_type(type);
 
         for (const auto& accountID : accounts) {
-            if (accountID->empty()) { continue; }
-
-            listProto.add_account(accountID->str());
-        }
-
-        if (0 == listProto.account_size()) {
-            serialized.mutable_index()->RemoveLast();
+            listProto.add_account(accountID);
         }
     }
-
-    return serialized;
 }
 
 bool Accounts::SetAlias(const std::string& id, const std::string& alias)
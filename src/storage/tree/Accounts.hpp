@@ -97,7 +97,10 @@ private:
     AccountData& get_account_data(
         const Lock& lock,
         const OTIdentifier& accountID) const;
-    proto::StorageAccounts serialize() const;
+    void serialize_indices(
+        const Lock& lock,
+        const std::string& prefix,
+        proto::StorageAccounts& output) const;
 
     bool check_update_account(
         const Lock& lock,
@@ -109,6 +112,7 @@ private:
         const Identifier& contract,
         const proto::ContactItemType unit);
     void init(const std::string& hash) override;
+    void load_indices(const Lock& lock, const proto::StorageAccounts& input);
     bool save(const Lock& lock) const override;
 
     Accounts(
@@ -9,6 +9,10 @@
 
 #include "storage/Plugin.hpp"
 
+#include <string>
+#include <unordered_set>
+#include <vector>
+
 #define CURRENT_VERSION 1
 
 #define OT_METHOD "opentxs::storage::BlockchainTransactions::"
@@ -17,10 +21,14 @@ namespace opentxs
 {
 namespace storage
 {
+const std::string BlockchainTransactions::INDEX_PREFIX{"index/"};
+const std::size_t BlockchainTransactions::SEGMENT_CAPACITY{256};
+
 BlockchainTransactions::BlockchainTransactions(
     const opentxs::api::storage::Driver& storage,
     const std::string& hash)
     : Node(storage, hash)
+    , index_()
 {
     if (check_hash(hash)) {
         init(hash);
@@ -30,11 +38,67 @@ BlockchainTransactions::BlockchainTransactions(
     }
 }
 
+std::string BlockchainTransactions::AddressKey(
+    const std::string& accountID,
+    const BIP44Chain chain,
+    const std::uint32_t index)
+{
+    return INDEX_PREFIX + accountID + (chain ? "/internal/" : "/external/") +
+           std::to_string(index);
+}
+
 bool BlockchainTransactions::Delete(const std::string& id)
 {
     return delete_item(id);
 }
 
+BlockchainTransactions::IndexList& BlockchainTransactions::index(
+    const Lock& lock,
+    const std::string& key) const
+{
+    OT_ASSERT(verify_write_lock(lock))
+
+    auto cached = index_.find(key);
+
+    if (index_.end() != cached) { return cached->second; }
+
+    auto& output = index_[key];
+
+    while (true) {
+        const auto it = item_map_.find(segment_key(key, output.segments_));
+
+        if (item_map_.end() == it) { break; }
+
+        std::shared_ptr<proto::StorageNymList> serialized{nullptr};
+
+        if (false == driver_.LoadProto(std::get<0>(it->second), serialized)) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Failed to load index "
+                  << it->first << std::endl;
+
+            abort();
+        }
+
+        ++output.segments_;
+        output.tail_.clear();
+
+        for (const auto& item : serialized->nym()) {
+            output.txids_.emplace(item.itemid());
+            output.tail_.emplace_back(item.itemid());
+        }
+    }
+
+    return output;
+}
+
+std::set<std::string> BlockchainTransactions::IndexedTransactions(
+    const std::string& key) const
+{
+    Lock lock(write_lock_);
+    const auto& txids = index(lock, key).txids_;
+
+    return {txids.begin(), txids.end()};
+}
+
 void BlockchainTransactions::init(const std::string& hash)
 {
     std::shared_ptr<proto::StorageBlockchainTransactions> serialized{nullptr};
@@ -53,10 +117,28 @@ void BlockchainTransactions::init(const std::string& hash)
     // Upgrade version
     if (CURRENT_VERSION > version_) { version_ = CURRENT_VERSION; }
 
-    for (const auto& it : serialized->transaction()) {
-        item_map_.emplace(
-            it.itemid(), Metadata{it.hash(), it.alias(), 0, false});
+    load_items<proto::StorageBlockchainTransactions>(
+        *serialized,
+        [](const proto::StorageBlockchainTransactions& list)
+            -> const ItemList& { return list.transaction(); });
+}
+
+bool BlockchainTransactions::is_index(const std::string& id)
+{
+    return 0 == id.compare(0, INDEX_PREFIX.size(), INDEX_PREFIX);
+}
+
+ObjectList BlockchainTransactions::List() const
+{
+    ObjectList output{};
+
+    for (auto& item : Node::List()) {
+        if (is_index(item.first)) { continue; }
+
+        output.emplace_back(std::move(item));
     }
+
+    return output;
 }
 
 bool BlockchainTransactions::Load(
@@ -70,6 +152,11 @@ bool BlockchainTransactions::Load(
         id, output, alias, checking);
 }
 
+std::string BlockchainTransactions::OutgoingKey(const std::string& accountID)
+{
+    return INDEX_PREFIX + accountID + "/outgoing";
+}
+
 bool BlockchainTransactions::save(const Lock& lock) const
 {
     if (false == verify_write_lock(lock)) {
@@ -80,9 +167,49 @@ bool BlockchainTransactions::save(const Lock& lock) const
 
     auto serialized = serialize();
 
+    return save_items<proto::StorageBlockchainTransactions>(
+        lock,
+        serialized,
+        [](proto::StorageBlockchainTransactions& list)
+            -> proto::StorageItemHash* { return list.add_transaction(); });
+}
+
+bool BlockchainTransactions::save_segment(
+    const Lock& lock,
+    const std::string& key)
+{
+    const auto& list = index(lock, key);
+
+    OT_ASSERT(0 < list.segments_)
+
+    proto::StorageNymList serialized{};
+    serialized.set_version(version_);
+
+    for (const auto& txid : list.tail_) {
+        const auto it = item_map_.find(txid);
+
+        if (item_map_.end() == it) { continue; }
+
+        serialize_index(txid, it->second, *serialized.add_nym());
+    }
+
     if (false == proto::Validate(serialized, VERBOSE)) { return false; }
 
-    return driver_.StoreProto(serialized, root_);
+    const auto id = segment_key(key, list.segments_ - 1);
+    auto& hash = std::get<0>(item_map_[id]);
+
+    if (false == driver_.StoreProto(serialized, hash)) { return false; }
+
+    mark_dirty(id);
+
+    return true;
+}
+
+std::string BlockchainTransactions::segment_key(
+    const std::string& key,
+    const std::size_t segment)
+{
+    return key + "/" + std::to_string(segment);
 }
 
 proto::StorageBlockchainTransactions BlockchainTransactions::serialize() const
@@ -90,17 +217,6 @@ proto::StorageBlockchainTransactions BlockchainTransactions::serialize() const
     proto::StorageBlockchainTransactions serialized{};
     serialized.set_version(version_);
 
-    for (const auto item : item_map_) {
-        const bool goodID = !item.first.empty();
-        const bool goodHash = check_hash(std::get<0>(item.second));
-        const bool good = goodID && goodHash;
-
-        if (good) {
-            serialize_index(
-                item.first, item.second, *serialized.add_transaction());
-        }
-    }
-
     return serialized;
 }
 
@@ -111,5 +227,62 @@ bool BlockchainTransactions::Store(const proto::BlockchainTransaction& data)
 
     return store_proto(data, data.txid(), alias, plaintext);
 }
+
+bool BlockchainTransactions::Store(
+    const std::vector<IndexedTransaction>& transactions)
+{
+    Lock lock(write_lock_);
+    std::set<std::string> changed{};
+
+    for (const auto& [key, transaction] : transactions) {
+        OT_ASSERT(nullptr != transaction)
+
+        const auto& txid = transaction->txid();
+        auto& hash = std::get<0>(item_map_[txid]);
+        std::string plaintext{};
+
+        if (false == driver_.StoreProto(*transaction, hash, plaintext)) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Failed to store transaction " << txid << std::endl;
+
+            return false;
+        }
+
+        mark_dirty(txid);
+        auto& list = index(lock, key);
+
+        if (false == list.txids_.emplace(txid).second) { continue; }
+
+        // A full segment is never written again
+        if ((0 < list.segments_) && (SEGMENT_CAPACITY <= list.tail_.size())) {
+            const bool pending = (1 == changed.erase(key));
+
+            if (pending && (false == save_segment(lock, key))) {
+                otErr << OT_METHOD << __FUNCTION__ << ": Failed to save index "
+                      << key << std::endl;
+
+                return false;
+            }
+
+            list.tail_.clear();
+        }
+
+        if (list.tail_.empty()) { ++list.segments_; }
+
+        list.tail_.emplace_back(txid);
+        changed.emplace(key);
+    }
+
+    for (const auto& key : changed) {
+        if (false == save_segment(lock, key)) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Failed to save index "
+                  << key << std::endl;
+
+            return false;
+        }
+    }
+
+    return save(lock);
+}
 }  // namespace storage
 }  // namespace opentxs
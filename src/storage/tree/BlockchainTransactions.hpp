@@ -14,6 +14,10 @@
 #include <cstdint>
 #include <map>
 #include <set>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 namespace opentxs
 {
@@ -25,6 +29,18 @@ class Tree;
 class BlockchainTransactions : public Node
 {
 public:
+    /** Index key, transaction */
+    using IndexedTransaction =
+        std::pair<std::string, const proto::BlockchainTransaction*>;
+
+    static std::string AddressKey(
+        const std::string& accountID,
+        const BIP44Chain chain,
+        const std::uint32_t index);
+    static std::string OutgoingKey(const std::string& accountID);
+
+    std::set<std::string> IndexedTransactions(const std::string& key) const;
+    ObjectList List() const override;
     bool Load(
         const std::string& id,
         std::shared_ptr<proto::BlockchainTransaction>& output,
@@ -32,13 +48,38 @@ public:
 
     bool Delete(const std::string& id);
     bool Store(const proto::BlockchainTransaction& data);
+    bool Store(const std::vector<IndexedTransaction>& transactions);
 
     ~BlockchainTransactions() = default;
 
 private:
     friend class Tree;
 
+    /** Transaction ids associated with an address or account
+     *
+     *  The ids are persisted in append only segments of at most
+     *  SEGMENT_CAPACITY ids, each a StorageNymList which is an item of this
+     *  node, so that adding a transaction only rewrites the last segment.
+     */
+    struct IndexList {
+        std::unordered_set<std::string> txids_{};
+        std::vector<std::string> tail_{};
+        std::size_t segments_{0};
+    };
+
+    static const std::string INDEX_PREFIX;
+    static const std::size_t SEGMENT_CAPACITY;
+
+    mutable std::map<std::string, IndexList> index_;
+
+    static bool is_index(const std::string& id);
+    static std::string segment_key(
+        const std::string& key,
+        const std::size_t segment);
+
+    IndexList& index(const Lock& lock, const std::string& key) const;
     bool save(const std::unique_lock<std::mutex>& lock) const override;
+    bool save_segment(const Lock& lock, const std::string& key);
     proto::StorageBlockchainTransactions serialize() const;
 
     void init(const std::string& hash) override;
@@ -44,10 +44,11 @@ void Contexts::init(const std::string& hash)
     // Minimum version is 2
     if (2 > version_) { version_ = 2; }
 
-    for (const auto& it : serialized->nym()) {
-        item_map_.emplace(
-            it.itemid(), Metadata{it.hash(), it.alias(), 0, false});
-    }
+    load_items<proto::StorageNymList>(
+        *serialized,
+        [](const proto::StorageNymList& list) -> const ItemList& {
+            return list.nym();
+        });
 }
 
 bool Contexts::Load(
@@ -68,9 +69,12 @@ bool Contexts::save(const std::unique_lock<std::mutex>& lock) const
 
     auto serialized = serialize();
 
-    if (false == proto::Validate(serialized, VERBOSE)) { return false; }
-
-    return driver_.StoreProto(serialized, root_);
+    return save_items<proto::StorageNymList>(
+        lock,
+        serialized,
+        [](proto::StorageNymList& list) -> proto::StorageItemHash* {
+            return list.add_nym();
+        });
 }
 
 proto::StorageNymList Contexts::serialize() const
@@ -78,16 +82,6 @@ proto::StorageNymList Contexts::serialize() const
     proto::StorageNymList serialized;
     serialized.set_version(version_);
 
-    for (const auto item : item_map_) {
-        const bool goodID = !item.first.empty();
-        const bool goodHash = check_hash(std::get<0>(item.second));
-        const bool good = goodID && goodHash;
-
-        if (good) {
-            serialize_index(item.first, item.second, *serialized.add_nym());
-        }
-    }
-
     return serialized;
 }
 
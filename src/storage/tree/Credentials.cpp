@@ -81,10 +81,11 @@ void Credentials::init(const std::string& hash)
     // Upgrade to version 2
     if (2 > version_) { version_ = 2; }
 
-    for (const auto& it : serialized->cred()) {
-        item_map_.emplace(
-            it.itemid(), Metadata{it.hash(), it.alias(), 0, false});
-    }
+    load_items<proto::StorageCredentials>(
+        *serialized,
+        [](const proto::StorageCredentials& list) -> const ItemList& {
+            return list.cred();
+        });
 }
 
 bool Credentials::Load(
@@ -125,9 +126,12 @@ bool Credentials::save(const std::unique_lock<std::mutex>& lock) const
 
     auto serialized = serialize();
 
-    if (!proto::Validate(serialized, VERBOSE)) { return false; }
-
-    return driver_.StoreProto(serialized, root_);
+    return save_items<proto::StorageCredentials>(
+        lock,
+        serialized,
+        [](proto::StorageCredentials& list) -> proto::StorageItemHash* {
+            return list.add_cred();
+        });
 }
 
 proto::StorageCredentials Credentials::serialize() const
@@ -135,16 +139,6 @@ proto::StorageCredentials Credentials::serialize() const
     proto::StorageCredentials serialized;
     serialized.set_version(version_);
 
-    for (const auto item : item_map_) {
-        const bool goodID = !item.first.empty();
-        const bool goodHash = check_hash(std::get<0>(item.second));
-        const bool good = goodID && goodHash;
-
-        if (good) {
-            serialize_index(item.first, item.second, *serialized.add_cred());
-        }
-    }
-
     return serialized;
 }
 
@@ -179,6 +173,8 @@ bool Credentials::Store(const proto::Credential& cred, const std::string& alias)
 
     if (!alias.empty()) { std::get<1>(metadata) = alias; }
 
+    mark_dirty(id);
+
     return save(lock);
 }
 }  // namespace storage
@@ -11,11 +11,25 @@
 
 #include "storage/Plugin.hpp"
 
+#include <algorithm>
+
 #define OT_METHOD "opentxs::storage::Node::"
 
 namespace opentxs::storage
 {
 const std::string Node::BLANK_HASH = "blankblankblankblankblank";
+const std::size_t Node::MAP_SLICE{100};
+const std::size_t Node::PAGE_CAPACITY{1024};
+const std::string Node::PAGE_ALIAS{"opentxs.storage.page"};
+const std::string Node::PAGE_PREFIX{"opentxs.storage.page."};
+
+namespace
+{
+bool has_prefix(const std::string& id, const std::string& prefix)
+{
+    return 0 == id.compare(0, prefix.size(), prefix);
+}
+}  // namespace
 
 Node::Node(const opentxs::api::storage::Driver& storage, const std::string& key)
     : driver_(storage)
@@ -31,6 +45,19 @@ bool Node::check_hash(const std::string& hash) const
     return !(empty || blank);
 }
 
+std::size_t Node::count_prefix(const std::string& prefix) const
+{
+    std::size_t output{0};
+
+    for (auto it = item_map_.lower_bound(prefix);
+         (item_map_.end() != it) && has_prefix(it->first, prefix);
+         ++it) {
+        ++output;
+    }
+
+    return output;
+}
+
 bool Node::delete_item(const std::string& id)
 {
     Lock lock(write_lock_);
@@ -46,6 +73,8 @@ bool Node::delete_item(const Lock& lock, const std::string& id)
 
     if (0 == items) { return false; }
 
+    mark_dirty(id);
+
     return save(lock);
 }
 
@@ -89,6 +118,68 @@ ObjectList Node::List() const
     return output;
 }
 
+bool Node::is_page(const proto::StorageItemHash& item)
+{
+    const bool alias = (PAGE_ALIAS == item.alias());
+
+    return alias && has_prefix(item.itemid(), PAGE_PREFIX);
+}
+
+std::size_t Node::largest_page(const std::size_t length) const
+{
+    std::size_t output{0};
+    std::size_t run{0};
+    const std::string* previous{nullptr};
+
+    for (const auto& it : item_map_) {
+        const auto& id = it.first;
+
+        if ((nullptr != previous) &&
+            (0 == id.compare(0, length, *previous, 0, length))) {
+            ++run;
+        } else {
+            run = 1;
+        }
+
+        output = std::max(output, run);
+        previous = &id;
+    }
+
+    return output;
+}
+
+// Selects the shortest id prefix which keeps every leaf page within
+// PAGE_CAPACITY items. Prefixes shared by every item add nothing but extra
+// levels, so the root page is keyed by the longest common prefix.
+bool Node::layout_pages() const
+{
+    page_hash_.clear();
+    const auto& first = item_map_.begin()->first;
+    const auto& last = item_map_.rbegin()->first;
+    std::size_t common{0};
+
+    while ((common < first.size()) && (common < last.size()) &&
+           (first[common] == last[common])) {
+        ++common;
+    }
+
+    std::size_t shortest{first.size()};
+
+    for (const auto& it : item_map_) {
+        shortest = std::min(shortest, it.first.size());
+    }
+
+    if (common >= shortest) { return false; }
+
+    page_root_ = first.substr(0, common);
+
+    for (page_depth_ = common + 1; page_depth_ < shortest; ++page_depth_) {
+        if (PAGE_CAPACITY >= largest_page(page_depth_)) { break; }
+    }
+
+    return true;
+}
+
 bool Node::load_raw(
     const std::string& id,
     std::string& output,
@@ -113,6 +204,13 @@ bool Node::load_raw(
     return driver_.Load(std::get<0>(it->second), checking, output);
 }
 
+// Nodes which are not paged rewrite their entire index on every save, so
+// there is no need to track which items changed
+void Node::mark_dirty(const std::string& id) const
+{
+    if (0 != page_depth_) { dirty_.emplace(id); }
+}
+
 bool Node::migrate(
     const std::string& hash,
     const opentxs::api::storage::Driver& to) const
@@ -138,6 +236,7 @@ bool Node::Migrate(const opentxs::api::storage::Driver& to) const
 
     bool output{true};
     output &= migrate(root_, to);
+    output &= migrate_pages(to);
 
     for (const auto& item : item_map_) {
         const auto& hash = std::get<0>(item.second);
@@ -147,6 +246,15 @@ bool Node::Migrate(const opentxs::api::storage::Driver& to) const
     return output;
 }
 
+bool Node::migrate_pages(const opentxs::api::storage::Driver& to) const
+{
+    bool output{true};
+
+    for (const auto& it : page_hash_) { output &= migrate(it.second, to); }
+
+    return output;
+}
+
 std::string Node::normalize_hash(const std::string& hash)
 {
     if (hash.empty()) { return BLANK_HASH; }
@@ -170,6 +278,82 @@ std::string Node::normalize_hash(const std::string& hash)
     return hash;
 }
 
+// Returns the keys of the index pages which must be stored again, leaves
+// first so that every inner page is written after its children
+std::vector<std::string> Node::plan_pages(const Lock& lock) const
+{
+    OT_ASSERT(verify_write_lock(lock))
+
+    std::vector<std::string> output{};
+    std::set<std::string> dirty{};
+    dirty.swap(dirty_);
+
+    if (PAGE_CAPACITY >= item_map_.size()) {
+        reset_pages();
+
+        return output;
+    }
+
+    const auto& first = item_map_.begin()->first;
+    const auto& last = item_map_.rbegin()->first;
+    bool rebuild = (0 == page_depth_) || dirty.empty() ||
+                   (false == has_prefix(first, page_root_)) ||
+                   (false == has_prefix(last, page_root_));
+    std::set<std::string> pages{};
+
+    for (const auto& id : dirty) {
+        if (rebuild) { break; }
+
+        if (page_depth_ > id.size()) {
+            rebuild = true;
+        } else {
+            pages.emplace(id.substr(0, page_depth_));
+        }
+    }
+
+    for (const auto& key : pages) {
+        if (rebuild) { break; }
+
+        rebuild = ((2 * PAGE_CAPACITY) < count_prefix(key));
+    }
+
+    if (rebuild) {
+        pages.clear();
+
+        if (false == layout_pages()) {
+            reset_pages();
+
+            return output;
+        }
+
+        for (const auto& it : item_map_) {
+            pages.emplace_hint(pages.end(), it.first.substr(0, page_depth_));
+        }
+    }
+
+    output.assign(pages.begin(), pages.end());
+
+    for (auto length = page_depth_ - 1; length > page_root_.size(); --length) {
+        std::set<std::string> parents{};
+
+        for (const auto& key : pages) {
+            parents.emplace(key.substr(0, length));
+        }
+
+        output.insert(output.end(), parents.begin(), parents.end());
+        pages.swap(parents);
+    }
+
+    return output;
+}
+
+void Node::reset_pages() const
+{
+    page_depth_ = 0;
+    page_root_.clear();
+    page_hash_.clear();
+}
+
 std::string Node::Root() const
 {
     std::lock_guard<std::mutex> lock_(write_lock_);
@@ -197,10 +381,45 @@ bool Node::set_alias(const std::string& id, const std::string& alias)
     if (!exists) { return false; }
 
     std::get<1>(item_map_[id]) = alias;
+    mark_dirty(id);
 
     return save(lock);
 }
 
+void Node::serialize_page(
+    const std::string& key,
+    std::vector<proto::StorageItemHash>& output,
+    const proto::StorageHashType type) const
+{
+    if ((0 == page_depth_) || (page_depth_ == key.size())) {
+        for (auto it = item_map_.lower_bound(key);
+             (item_map_.end() != it) && has_prefix(it->first, key);
+             ++it) {
+            const auto& [id, metadata] = *it;
+            const bool goodID = !id.empty();
+            const bool goodHash = check_hash(std::get<0>(metadata));
+
+            if (goodID && goodHash) {
+                serialize_index(id, metadata, output.emplace_back(), type);
+            }
+        }
+
+        return;
+    }
+
+    for (auto it = page_hash_.lower_bound(key);
+         (page_hash_.end() != it) && has_prefix(it->first, key);
+         ++it) {
+        const auto& [child, hash] = *it;
+
+        if ((key.size() + 1) != child.size()) { continue; }
+
+        auto& entry = output.emplace_back();
+        set_hash(version_, PAGE_PREFIX + child, hash, entry);
+        entry.set_alias(PAGE_ALIAS);
+    }
+}
+
 void Node::set_hash(
     const std::uint32_t version,
     const std::string& id,
@@ -254,9 +473,40 @@ bool Node::store_raw(
 
     if (!alias.empty()) { std::get<1>(metadata) = alias; }
 
+    mark_dirty(id);
+
     return save(lock);
 }
 
+void Node::set_page(const std::string& key, const std::string& hash) const
+{
+    if (key.empty()) { return; }
+
+    const auto parent = key.substr(0, key.size() - 1);
+
+    if ((0 == page_depth_) || (parent.size() < page_root_.size())) {
+        page_root_ = parent;
+    }
+
+    page_depth_ = std::max(page_depth_, key.size());
+    page_hash_[key] = hash;
+}
+
+std::vector<std::pair<std::string, std::string>> Node::slice(
+    const std::string& after,
+    const std::size_t limit) const
+{
+    std::vector<std::pair<std::string, std::string>> output{};
+    Lock lock(write_lock_);
+    auto it = after.empty() ? item_map_.begin() : item_map_.upper_bound(after);
+
+    for (; (item_map_.end() != it) && (limit > output.size()); ++it) {
+        output.emplace_back(it->first, std::get<0>(it->second));
+    }
+
+    return output;
+}
+
 std::uint32_t Node::UpgradeLevel() const { return original_version_; }
 
 bool Node::verify_write_lock(const Lock& lock) const
@@ -15,8 +15,11 @@
 #include <functional>
 #include <map>
 #include <mutex>
+#include <set>
 #include <string>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 namespace opentxs
 {
@@ -37,6 +40,8 @@ typedef std::tuple<std::string, std::string, std::uint64_t, bool> Metadata;
  *  * Metadata: metadata for the stored object
  */
 typedef std::map<std::string, Metadata> Index;
+/** The repeated field of an index proto which holds its items */
+typedef ::google::protobuf::RepeatedPtrField<proto::StorageItemHash> ItemList;
 
 class Node
 {
@@ -58,6 +63,8 @@ protected:
 
         if (!alias.empty()) { std::get<1>(metadata) = alias; }
 
+        mark_dirty(id);
+
         return save(lock);
     }
 
@@ -112,12 +119,29 @@ protected:
     template <class T>
     void map(const std::function<void(const T&)> input) const
     {
-        Lock lock(write_lock_);
-        const auto copy = item_map_;
-        lock.unlock();
+        std::string last{};
+
+        do {
+            last = map<T>(input, last, MAP_SLICE);
+        } while (false == last.empty());
+    }
 
-        for (const auto& it : copy) {
-            const auto& hash = std::get<0>(it.second);
+    /** Applies a lambda to at most limit items whose ids follow after
+     *
+     *  Only the ids and hashes of the slice are copied out of the index.
+     *  Returns the id of the last item visited, or an empty string if no
+     *  items follow after.
+     */
+    template <class T>
+    std::string map(
+        const std::function<void(const T&)> input,
+        const std::string& after,
+        const std::size_t limit) const
+    {
+        std::string output{};
+
+        for (const auto& [id, hash] : slice(after, limit)) {
+            output = id;
             std::shared_ptr<T> serialized;
 
             if (Node::BLANK_HASH == hash) { continue; }
@@ -126,6 +150,158 @@ protected:
                 input(*serialized);
             }
         }
+
+        return output;
+    }
+
+    /** Populates item_map_ from an index proto
+     *
+     *  Entries which refer to index pages are followed recursively and the
+     *  page layout is recorded so that later saves only rewrite the pages
+     *  which contain modified items. The optional contents lambda is applied
+     *  to the index proto and to every page.
+     *
+     *  Returns false if a page could not be loaded. The node then keeps the
+     *  items it did find but refuses to save, so that the stored index is
+     *  never replaced by an incomplete one.
+     */
+    template <class T>
+    bool load_items(
+        const T& serialized,
+        const std::function<const ItemList&(const T&)> items,
+        const std::function<void(const T&)> contents = {})
+    {
+        if (contents) { contents(serialized); }
+
+        bool output{true};
+
+        for (const auto& it : items(serialized)) {
+            if (false == is_page(it)) {
+                item_map_.emplace(
+                    it.itemid(), Metadata{it.hash(), it.alias(), 0, false});
+
+                continue;
+            }
+
+            std::string raw{};
+            T page{};
+
+            if (false == driver_.Load(it.hash(), true, raw)) {
+                otErr << __FUNCTION__ << ": Index page " << it.hash()
+                      << " is missing" << std::endl;
+                pages_missing_ = true;
+                output = false;
+
+                continue;
+            }
+
+            page.ParseFromArray(raw.data(), raw.size());
+
+            if (false == proto::Validate(page, VERBOSE)) {
+                otErr << __FUNCTION__ << ": Index page " << it.hash()
+                      << " is invalid" << std::endl;
+                pages_missing_ = true;
+                output = false;
+
+                continue;
+            }
+
+            set_page(it.itemid().substr(PAGE_PREFIX.size()), it.hash());
+            output &= load_items(page, items, contents);
+        }
+
+        return output;
+    }
+
+    /** Adds the items of the node to an index proto
+     *
+     *  Small nodes store every item in the index proto. Once a node holds
+     *  more than PAGE_CAPACITY items they are distributed over a tree of
+     *  index pages of the same proto type, keyed by id prefix, and only the
+     *  pages on the path to a modified item are stored again.
+     *
+     *  Pages are written with the version of the index proto, and page
+     *  references are ordinary items distinguished by a reserved id prefix
+     *  and alias, so paging needs no new proto versions. The optional
+     *  contents lambda adds per item data for the ids starting with a prefix
+     *  to the leaf page for that prefix, or to the index proto itself if the
+     *  node is not paged.
+     */
+    template <class T>
+    bool serialize_items(
+        const Lock& lock,
+        T& output,
+        const std::function<proto::StorageItemHash*(T&)> add,
+        const proto::StorageHashType type = proto::STORAGEHASH_PROTO,
+        const std::function<void(const std::string&, T&)> contents = {}) const
+    {
+        if (pages_missing_) {
+            otErr << __FUNCTION__ << ": Index pages failed to load. Refusing "
+                  << "to overwrite the stored index." << std::endl;
+
+            return false;
+        }
+
+        const auto keys = plan_pages(lock);
+        std::vector<proto::StorageItemHash> entries{};
+
+        for (const auto& key : keys) {
+            entries.clear();
+            serialize_page(key, entries, type);
+
+            if (entries.empty()) {
+                page_hash_.erase(key);
+
+                continue;
+            }
+
+            T page{};
+            page.set_version(output.version());
+
+            for (auto& entry : entries) { add(page)->Swap(&entry); }
+
+            if (contents && (page_depth_ == key.size())) {
+                contents(key, page);
+            }
+
+            const bool valid = proto::Validate(page, VERBOSE);
+
+            if ((false == valid) ||
+                (false == driver_.StoreProto(page, page_hash_[key]))) {
+                reset_pages();
+
+                return false;
+            }
+        }
+
+        entries.clear();
+        serialize_page(page_root_, entries, type);
+
+        for (auto& entry : entries) { add(output)->Swap(&entry); }
+
+        if (contents && (0 == page_depth_)) { contents(page_root_, output); }
+
+        return true;
+    }
+
+    /** Adds the items of the node to an index proto, validates it and stores
+     *  it as the root of the node */
+    template <class T>
+    bool save_items(
+        const Lock& lock,
+        T& serialized,
+        const std::function<proto::StorageItemHash*(T&)> add,
+        const proto::StorageHashType type = proto::STORAGEHASH_PROTO,
+        const std::function<void(const std::string&, T&)> contents = {}) const
+    {
+        const bool items =
+            serialize_items<T>(lock, serialized, add, type, contents);
+
+        if (false == items) { return false; }
+
+        if (false == proto::Validate(serialized, VERBOSE)) { return false; }
+
+        return driver_.StoreProto(serialized, root_);
     }
 
     template <class T>
@@ -169,6 +345,10 @@ protected:
     friend class Root;
 
     static const std::string BLANK_HASH;
+    static const std::size_t MAP_SLICE;
+    static const std::size_t PAGE_CAPACITY;
+    static const std::string PAGE_ALIAS;
+    static const std::string PAGE_PREFIX;
 
     const opentxs::api::storage::Driver& driver_;
 
@@ -178,10 +358,21 @@ protected:
 
     mutable std::mutex write_lock_;
     mutable Index item_map_;
-
+    // Ids of items modified since the last save
+    mutable std::set<std::string> dirty_{};
+    // Length of the id prefix which selects a leaf page, or zero if the
+    // items are stored directly in the index proto
+    mutable std::size_t page_depth_{0};
+    mutable std::string page_root_{};
+    mutable std::map<std::string, std::string> page_hash_{};
+    // Set if any index page failed to load
+    bool pages_missing_{false};
+
+    static bool is_page(const proto::StorageItemHash& item);
     static std::string normalize_hash(const std::string& hash);
 
     bool check_hash(const std::string& hash) const;
+    std::size_t count_prefix(const std::string& prefix) const;
     std::uint64_t extract_revision(const proto::Contact& input) const;
     std::uint64_t extract_revision(const proto::CredentialIndex& input) const;
     std::uint64_t extract_revision(const proto::Seed& input) const;
@@ -191,15 +382,29 @@ protected:
         std::string& output,
         std::string& alias,
         const bool checking) const;
+    std::size_t largest_page(const std::size_t length) const;
+    bool layout_pages() const;
+    void mark_dirty(const std::string& id) const;
     bool migrate(
         const std::string& hash,
         const opentxs::api::storage::Driver& to) const;
+    bool migrate_pages(const opentxs::api::storage::Driver& to) const;
+    std::vector<std::string> plan_pages(const Lock& lock) const;
+    void reset_pages() const;
     virtual bool save(const Lock& lock) const = 0;
     void serialize_index(
         const std::string& id,
         const Metadata& metadata,
         proto::StorageItemHash& output,
         const proto::StorageHashType type = proto::STORAGEHASH_PROTO) const;
+    void serialize_page(
+        const std::string& key,
+        std::vector<proto::StorageItemHash>& output,
+        const proto::StorageHashType type) const;
+    void set_page(const std::string& key, const std::string& hash) const;
+    std::vector<std::pair<std::string, std::string>> slice(
+        const std::string& after,
+        const std::size_t limit) const;
 
     bool delete_item(const std::string& id);
     bool delete_item(const Lock& lock, const std::string& id);
@@ -68,10 +68,11 @@ void Nyms::init(const std::string& hash)
         version_ = original_version_;
     }
 
-    for (const auto& it : serialized->nym()) {
-        item_map_.emplace(
-            it.itemid(), Metadata{it.hash(), it.alias(), 0, false});
-    }
+    load_items<proto::StorageNymList>(
+        *serialized,
+        [](const proto::StorageNymList& list) -> const ItemList& {
+            return list.nym();
+        });
 
     for (const auto& nymID : serialized->localnymid()) {
         local_nyms_.emplace(nymID);
@@ -82,21 +83,43 @@ const std::set<std::string> Nyms::LocalNyms() const { return local_nyms_; }
 
 void Nyms::Map(NymLambda lambda) const
 {
-    Lock lock(write_lock_);
-    const auto copy = item_map_;
-    lock.unlock();
+    std::string last{};
 
-    for (const auto it : copy) {
-        const auto& id = it.first;
-        const auto& node = *nym(id);
-        const auto& hash = node.credentials_;
+    do {
+        last = Map(lambda, last, MAP_SLICE);
+    } while (false == last.empty());
+}
 
-        std::shared_ptr<proto::CredentialIndex> serialized;
+// Reads the credential index hash directly from each nym index instead of
+// instantiating (and caching) a child node for every nym visited
+std::string Nyms::Map(
+    NymLambda lambda,
+    const std::string& after,
+    const std::size_t limit) const
+{
+    std::string output{};
+
+    for (const auto& [id, hash] : slice(after, limit)) {
+        output = id;
+
+        if (false == check_hash(hash)) { continue; }
+
+        std::shared_ptr<proto::StorageNym> nym;
+
+        if (false == driver_.LoadProto(hash, nym, false)) { continue; }
+
+        const auto credentials = normalize_hash(nym->credlist().hash());
 
-        if (Node::BLANK_HASH == hash) { continue; }
+        if (Node::BLANK_HASH == credentials) { continue; }
 
-        if (driver_.LoadProto(hash, serialized, false)) { lambda(*serialized); }
+        std::shared_ptr<proto::CredentialIndex> serialized;
+
+        if (driver_.LoadProto(credentials, serialized, false)) {
+            lambda(*serialized);
+        }
     }
+
+    return output;
 }
 
 bool Nyms::Migrate(const opentxs::api::storage::Driver& to) const
@@ -110,6 +133,7 @@ bool Nyms::Migrate(const opentxs::api::storage::Driver& to) const
     }
 
     output &= migrate(root_, to);
+    output &= migrate_pages(to);
 
     return output;
 }
@@ -196,11 +220,14 @@ bool Nyms::save(const Lock& lock) const
 
     auto serialized = serialize();
 
-    if (!proto::Validate(serialized, VERBOSE)) { return false; }
-
-    OT_ASSERT(CURRENT_VERSION == serialized.version())
+    OT_ASSERT(CURRENT_VERSION <= serialized.version())
 
-    return driver_.StoreProto(serialized, root_);
+    return save_items<proto::StorageNymList>(
+        lock,
+        serialized,
+        [](proto::StorageNymList& list) -> proto::StorageItemHash* {
+            return list.add_nym();
+        });
 }
 
 void Nyms::save(class Nym* nym, const Lock& lock, const std::string& id)
@@ -223,6 +250,8 @@ void Nyms::save(class Nym* nym, const Lock& lock, const std::string& id)
 
     if (nym->private_.get()) { local_nyms_.emplace(nym->nymid_); }
 
+    mark_dirty(id);
+
     if (!save(lock)) {
         otErr << OT_METHOD << __FUNCTION__ << ": Save error" << std::endl;
         abort();
@@ -234,16 +263,6 @@ proto::StorageNymList Nyms::serialize() const
     proto::StorageNymList serialized;
     serialized.set_version(version_);
 
-    for (const auto item : item_map_) {
-        const bool goodID = !item.first.empty();
-        const bool goodHash = check_hash(std::get<0>(item.second));
-        const bool good = goodID && goodHash;
-
-        if (good) {
-            serialize_index(item.first, item.second, *serialized.add_nym());
-        }
-    }
-
     for (const auto& nymID : local_nyms_) { serialized.add_localnymid(nymID); }
 
     return serialized;
@@ -54,6 +54,10 @@ public:
     bool Exists(const std::string& id) const;
     const std::set<std::string> LocalNyms() const;
     void Map(NymLambda lambda) const;
+    std::string Map(
+        NymLambda lambda,
+        const std::string& after,
+        const std::size_t limit) const;
     bool Migrate(const opentxs::api::storage::Driver& to) const override;
     const class Nym& Nym(const std::string& id) const;
 
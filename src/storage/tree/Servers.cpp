@@ -49,10 +49,11 @@ void Servers::init(const std::string& hash)
     // Upgrade to version 2
     if (2 > version_) { version_ = 2; }
 
-    for (const auto& it : serialized->server()) {
-        item_map_.emplace(
-            it.itemid(), Metadata{it.hash(), it.alias(), 0, false});
-    }
+    load_items<proto::StorageServers>(
+        *serialized,
+        [](const proto::StorageServers& list) -> const ItemList& {
+            return list.server();
+        });
 }
 
 bool Servers::Load(
@@ -69,6 +70,14 @@ void Servers::Map(ServerLambda lambda) const
     map<proto::ServerContract>(lambda);
 }
 
+std::string Servers::Map(
+    ServerLambda lambda,
+    const std::string& after,
+    const std::size_t limit) const
+{
+    return map<proto::ServerContract>(lambda, after, limit);
+}
+
 bool Servers::save(const std::unique_lock<std::mutex>& lock) const
 {
     if (!verify_write_lock(lock)) {
@@ -78,9 +87,12 @@ bool Servers::save(const std::unique_lock<std::mutex>& lock) const
 
     auto serialized = serialize();
 
-    if (!proto::Validate(serialized, VERBOSE)) { return false; }
-
-    return driver_.StoreProto(serialized, root_);
+    return save_items<proto::StorageServers>(
+        lock,
+        serialized,
+        [](proto::StorageServers& list) -> proto::StorageItemHash* {
+            return list.add_server();
+        });
 }
 
 proto::StorageServers Servers::serialize() const
@@ -88,16 +100,6 @@ proto::StorageServers Servers::serialize() const
     proto::StorageServers serialized;
     serialized.set_version(version_);
 
-    for (const auto item : item_map_) {
-        const bool goodID = !item.first.empty();
-        const bool goodHash = check_hash(std::get<0>(item.second));
-        const bool good = goodID && goodHash;
-
-        if (good) {
-            serialize_index(item.first, item.second, *serialized.add_server());
-        }
-    }
-
     return serialized;
 }
 
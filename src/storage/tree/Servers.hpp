@@ -45,6 +45,10 @@ public:
         std::string& alias,
         const bool checking) const;
     void Map(ServerLambda lambda) const;
+    std::string Map(
+        ServerLambda lambda,
+        const std::string& after,
+        const std::size_t limit) const;
 
     bool Delete(const std::string& id);
     bool SetAlias(const std::string& id, const std::string& alias);
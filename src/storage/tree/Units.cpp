@@ -46,10 +46,11 @@ void Units::init(const std::string& hash)
     // Upgrade to version 2
     if (2 > version_) { version_ = 2; }
 
-    for (const auto& it : serialized->unit()) {
-        item_map_.emplace(
-            it.itemid(), Metadata{it.hash(), it.alias(), 0, false});
-    }
+    load_items<proto::StorageUnits>(
+        *serialized,
+        [](const proto::StorageUnits& list) -> const ItemList& {
+            return list.unit();
+        });
 }
 
 bool Units::Load(
@@ -63,6 +64,14 @@ bool Units::Load(
 
 void Units::Map(UnitLambda lambda) const { map<proto::UnitDefinition>(lambda); }
 
+std::string Units::Map(
+    UnitLambda lambda,
+    const std::string& after,
+    const std::size_t limit) const
+{
+    return map<proto::UnitDefinition>(lambda, after, limit);
+}
+
 bool Units::save(const std::unique_lock<std::mutex>& lock) const
 {
     if (!verify_write_lock(lock)) {
@@ -72,9 +81,12 @@ bool Units::save(const std::unique_lock<std::mutex>& lock) const
 
     auto serialized = serialize();
 
-    if (!proto::Validate(serialized, VERBOSE)) { return false; }
-
-    return driver_.StoreProto(serialized, root_);
+    return save_items<proto::StorageUnits>(
+        lock,
+        serialized,
+        [](proto::StorageUnits& list) -> proto::StorageItemHash* {
+            return list.add_unit();
+        });
 }
 
 proto::StorageUnits Units::serialize() const
@@ -82,16 +94,6 @@ proto::StorageUnits Units::serialize() const
     proto::StorageUnits serialized;
     serialized.set_version(version_);
 
-    for (const auto item : item_map_) {
-        const bool goodID = !item.first.empty();
-        const bool goodHash = check_hash(std::get<0>(item.second));
-        const bool good = goodID && goodHash;
-
-        if (good) {
-            serialize_index(item.first, item.second, *serialized.add_unit());
-        }
-    }
-
     return serialized;
 }
 
@@ -270,7 +270,13 @@ void AccountActivity::process_workflow(
 {
     const auto workflow = api_.Workflow().LoadWorkflow(nym_id_, workflowID);
 
-    OT_ASSERT(workflow)
+    // Any rows already shown for this workflow are removed by the caller
+    if (false == bool(workflow)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to load workflow "
+              << workflowID.str() << std::endl;
+
+        return;
+    }
 
     const auto rows = extract_rows(*workflow);
 
@@ -288,14 +294,35 @@ void AccountActivity::process_workflow(const network::zeromq::Message& message)
 {
     wait_for_startup();
 
-    OT_ASSERT(1 == message.Body().size());
+    OT_ASSERT(2 == message.Body().size());
 
-    const std::string id(*message.Body().begin());
+    const std::string id(message.Body().at(0));
     const auto accountID = Identifier::Factory(id);
 
     OT_ASSERT(false == accountID->empty())
 
-    if (account_id_ == accountID) { startup(); }
+    if (account_id_ != accountID) { return; }
+
+    const auto workflowID =
+        Identifier::Factory(std::string(message.Body().at(1)));
+
+    OT_ASSERT(false == workflowID->empty())
+
+    // Only the rows belonging to the changed workflow are updated
+    std::set<AccountActivityRowID> active{};
+    process_workflow(workflowID, active);
+    std::set<AccountActivityRowID> inactive{};
+
+    for (const auto& type : {proto::PAYMENTEVENTTYPE_CREATE,
+                             proto::PAYMENTEVENTTYPE_CONVEY,
+                             proto::PAYMENTEVENTTYPE_CANCEL,
+                             proto::PAYMENTEVENTTYPE_ACCEPT}) {
+        AccountActivityRowID key{workflowID, type};
+
+        if (0 == active.count(key)) { inactive.emplace(std::move(key)); }
+    }
+
+    delete_items(inactive);
 }
 
 void AccountActivity::startup()
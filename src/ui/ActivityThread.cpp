@@ -26,12 +26,18 @@
 #include "opentxs/ui/ActivityThreadItem.hpp"
 #include "opentxs/Types.hpp"
 
+#include "core/RecentSet.hpp"
+#include "internal/api/Internal.hpp"
+
 #include "ActivityThreadItemBlank.hpp"
 #include "InternalUI.hpp"
 #include "List.hpp"
 
+#include <algorithm>
+#include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <thread>
 #include <tuple>
@@ -48,12 +54,13 @@ namespace opentxs
 {
 ui::ActivityThread* Factory::ActivityThread(
     const api::client::Manager& api,
+    const api::internal::Timer& timer,
     const network::zeromq::PublishSocket& publisher,
     const Identifier& nymID,
     const Identifier& threadID)
 {
     return new ui::implementation::ActivityThread(
-        api, publisher, nymID, threadID);
+        api, timer, publisher, nymID, threadID);
 }
 }  // namespace opentxs
 
@@ -61,6 +68,7 @@ namespace opentxs::ui::implementation
 {
 ActivityThread::ActivityThread(
     const api::client::Manager& api,
+    const api::internal::Timer& timer,
     const network::zeromq::PublishSocket& publisher,
     const Identifier& nymID,
     const Identifier& threadID)
@@ -75,6 +83,13 @@ ActivityThread::ActivityThread(
     , draft_tasks_()
     , contact_(nullptr)
     , contact_thread_(nullptr)
+    , page_lock_()
+    , oldest_(
+          std::chrono::system_clock::time_point::max(),
+          std::numeric_limits<std::uint64_t>::max())
+    , timer_(timer)
+    , fetched_lock_()
+    , fetched_(ACTIVITY_THREAD_LOADED_ROW_LIMIT)
 {
     init();
     setup_listeners(listeners_);
@@ -226,6 +241,21 @@ std::string ActivityThread::DisplayName() const
     return comma(names);
 }
 
+void ActivityThread::fetched(const ActivityThreadRowID& id) const
+{
+    Lock fetchedLock(fetched_lock_);
+    const auto evict = fetched_.Touch(id);
+    fetchedLock.unlock();
+
+    if (evict.empty()) { return; }
+
+    // Rows which have not been displayed recently release their contents
+    // and will reload them if they are displayed again
+    Lock lock(lock_);
+
+    for (const auto& row : evict) { find_by_id(lock, row).unload(); }
+}
+
 std::string ActivityThread::GetDraft() const
 {
     sLock lock(draft_lock_);
@@ -255,16 +285,57 @@ void ActivityThread::load_thread(const proto::StorageThread& thread)
         participants_.emplace(Identifier::Factory(id));
     }
 
-    otWarn << OT_METHOD << __FUNCTION__ << ": Loading " << thread.item().size()
-           << " items." << std::endl;
-
-    for (const auto& item : thread.item()) { process_item(item); }
+    otWarn << OT_METHOD << __FUNCTION__ << ": Thread contains "
+           << thread.item().size() << " items." << std::endl;
 
+    load_page(thread);
     startup_complete_->On();
 }
 
+bool ActivityThread::load_page(const proto::StorageThread& thread) const
+{
+    Lock lock(page_lock_);
+    std::size_t added{0};
+    auto oldest = oldest_;
+
+    for (const auto* item : sort_items(thread)) {
+        const auto key = sort_key(*item);
+
+        if (false == (key < oldest_)) { continue; }
+
+        // Items which share a sort key are always loaded together
+        if ((ACTIVITY_THREAD_PAGE_SIZE <= added) && (key < oldest)) {
+            oldest_ = oldest;
+
+            return true;
+        }
+
+        process_item(*item);
+        oldest = key;
+        ++added;
+    }
+
+    // Every item in the thread has been loaded
+    oldest_ = {};
+
+    return 0 < added;
+}
+
+bool ActivityThread::LoadMore() const
+{
+    wait_for_startup();
+    const auto thread = api_.Activity().Thread(nym_id_, threadID_);
+
+    if (false == bool(thread)) { return false; }
+
+    return load_page(*thread);
+}
+
 void ActivityThread::new_thread()
 {
+    Lock lock(page_lock_);
+    oldest_ = {};
+    lock.unlock();
     participants_.emplace(threadID_);
     UpdateNotify();
     startup_complete_->On();
@@ -291,15 +362,13 @@ std::string ActivityThread::PaymentCode(
 }
 
 ActivityThreadRowID ActivityThread::process_item(
-    const proto::StorageThreadItem& item)
+    const proto::StorageThreadItem& item) const
 {
     const ActivityThreadRowID id{Identifier::Factory(item.id()),
                                  static_cast<StorageBox>(item.box()),
                                  Identifier::Factory(item.account())};
-    const ActivityThreadSortKey key{std::chrono::seconds(item.time()),
-                                    item.index()};
     const CustomData custom{new std::string};
-    add_item(id, key, custom);
+    add_item(id, sort_key(item), custom);
 
     return id;
 }
@@ -323,15 +392,27 @@ void ActivityThread::process_thread(const network::zeromq::Message& message)
     OT_ASSERT(thread)
 
     std::set<ActivityThreadRowID> active{};
+    Lock lock(page_lock_);
 
     for (const auto& item : thread->item()) {
+        // Older items are only added by LoadMore()
+        if (sort_key(item) < oldest_) { continue; }
+
         const auto id = process_item(item);
         active.emplace(id);
     }
 
+    lock.unlock();
     delete_inactive(active);
 }
 
+void ActivityThread::row_removed(const Lock&, const ActivityThreadRowID& id)
+    const
+{
+    Lock fetchedLock(fetched_lock_);
+    fetched_.Erase(id);
+}
+
 bool ActivityThread::same(
     const ActivityThreadRowID& lhs,
     const ActivityThreadRowID& rhs) const
@@ -345,6 +426,35 @@ bool ActivityThread::same(
     return sameID && sameBox && sameAccount;
 }
 
+std::vector<const proto::StorageThreadItem*> ActivityThread::sort_items(
+    const proto::StorageThread& thread)
+{
+    std::vector<const proto::StorageThreadItem*> output{};
+    output.reserve(thread.item().size());
+
+    for (const auto& item : thread.item()) { output.emplace_back(&item); }
+
+    // Newest first
+    std::sort(
+        output.begin(),
+        output.end(),
+        [](const proto::StorageThreadItem* lhs,
+           const proto::StorageThreadItem* rhs) -> bool {
+            return sort_key(*rhs) < sort_key(*lhs);
+        });
+
+    return output;
+}
+
+ActivityThreadSortKey ActivityThread::sort_key(
+    const proto::StorageThreadItem& item)
+{
+    const std::chrono::system_clock::time_point time{
+        std::chrono::seconds(item.time())};
+
+    return ActivityThreadSortKey{time, item.index()};
+}
+
 bool ActivityThread::SendDraft() const
 {
     eLock draftLock(draft_lock_);
@@ -387,7 +497,7 @@ bool ActivityThread::SendDraft() const
     draft_tasks_.insert(id);
     const CustomData custom{new std::string(draft_)};
     draft_.clear();
-    const_cast<ActivityThread&>(*this).add_item(id, key, custom);
+    add_item(id, key, custom);
 
     return true;
 }
@@ -7,6 +7,11 @@
 
 #include "Internal.hpp"
 
+#include <vector>
+
+#define ACTIVITY_THREAD_PAGE_SIZE 50
+#define ACTIVITY_THREAD_LOADED_ROW_LIMIT 200
+
 namespace std
 {
 using STORAGEID = std::
@@ -65,7 +70,9 @@ class ActivityThread final : public ActivityThreadList
 {
 public:
     std::string DisplayName() const override;
+    void fetched(const ActivityThreadRowID& id) const override;
     std::string GetDraft() const override;
+    bool LoadMore() const override;
     std::string Participants() const override;
     std::string PaymentCode(
         const proto::ContactItemType currency) const override;
@@ -74,6 +81,7 @@ public:
     bool SendDraft() const override;
     bool SetDraft(const std::string& draft) const override;
     std::string ThreadID() const override;
+    const api::internal::Timer& timer() const override { return timer_; }
 
     ~ActivityThread();
 
@@ -89,6 +97,17 @@ private:
     mutable std::set<ActivityThreadRowID> draft_tasks_;
     std::shared_ptr<const opentxs::Contact> contact_;
     std::unique_ptr<std::thread> contact_thread_{nullptr};
+    mutable std::mutex page_lock_;
+    // Items older than this key have not been loaded into the list yet
+    mutable ActivityThreadSortKey oldest_;
+    const api::internal::Timer& timer_;
+    mutable std::mutex fetched_lock_;
+    // Rows which currently hold their contents, most recently displayed first
+    mutable RecentSet<ActivityThreadRowID> fetched_;
+
+    static ActivityThreadSortKey sort_key(const proto::StorageThreadItem& item);
+    static std::vector<const proto::StorageThreadItem*> sort_items(
+        const proto::StorageThread& thread);
 
     bool check_draft(const ActivityThreadRowID& id) const;
     void check_drafts() const;
@@ -97,16 +116,21 @@ private:
         const ActivityThreadRowID& id,
         const ActivityThreadSortKey& index,
         const CustomData& custom) const override;
+    bool load_page(const proto::StorageThread& thread) const;
+    ActivityThreadRowID process_item(
+        const proto::StorageThreadItem& item) const;
+    void row_removed(const Lock& lock, const ActivityThreadRowID& id)
+        const override;
 
     void init_contact();
     void load_thread(const proto::StorageThread& thread);
     void new_thread();
-    ActivityThreadRowID process_item(const proto::StorageThreadItem& item);
     void process_thread(const network::zeromq::Message& message);
     void startup();
 
     ActivityThread(
         const api::client::Manager& api,
+        const api::internal::Timer& timer,
         const network::zeromq::PublishSocket& publisher,
         const Identifier& nymID,
         const Identifier& threadID);
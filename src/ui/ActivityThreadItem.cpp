@@ -13,9 +13,16 @@
 #include "opentxs/core/Lockable.hpp"
 #include "opentxs/ui/ActivityThreadItem.hpp"
 
+#include "internal/api/Internal.hpp"
+
 #include "InternalUI.hpp"
 #include "Row.hpp"
 
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
 #include "ActivityThreadItem.hpp"
 
 template class opentxs::SharedPimpl<opentxs::ui::ActivityThreadItem>;
@@ -41,9 +48,38 @@ ActivityThreadItem::ActivityThreadItem(
     , text_(extract_custom<std::string>(custom))
     , loading_(Flag::Factory(loading))
     , pending_(Flag::Factory(pending))
+    , lazy_(loading)
+    , load_lock_()
+    , requested_(Flag::Factory(false))
+    , generation_(0)
+    , load_(0)
 {
 }
 
+void ActivityThreadItem::clear(const eLock&) { text_.clear(); }
+
+void ActivityThreadItem::fetch() const
+{
+    if (false == lazy_) { return; }
+
+    parent_.fetched(row_id_);
+    Lock lock(load_lock_);
+
+    if (requested_.get()) { return; }
+
+    // At most one load per row is outstanding, so stop_loading only needs to
+    // wait for the most recent one
+    if (0 != load_) { parent_.timer().Cancel(load_); }
+
+    requested_->On();
+    const auto generation = generation_;
+    auto* row = const_cast<ActivityThreadItem*>(this);
+    load_ = parent_.timer().Schedule(
+        std::chrono::milliseconds(0),
+        std::chrono::milliseconds(0),
+        [row, generation]() -> void { row->load(generation); });
+}
+
 bool ActivityThreadItem::MarkRead() const
 {
     return api_.Activity().MarkRead(
@@ -62,13 +98,42 @@ void ActivityThreadItem::reindex(
     }
 }
 
+void ActivityThreadItem::stop_loading()
+{
+    Lock lock(load_lock_);
+
+    if (0 != load_) { parent_.timer().Cancel(load_); }
+
+    load_ = 0;
+}
+
 std::string ActivityThreadItem::Text() const
 {
+    fetch();
     sLock lock(shared_lock_);
 
     return text_;
 }
 
+void ActivityThreadItem::unload()
+{
+    if (false == lazy_) { return; }
+
+    Lock loadLock(load_lock_);
+    eLock lock(shared_lock_);
+    clear(lock);
+    loading_->On();
+    requested_->Off();
+    // A load which is still in progress must not restore the contents
+    ++generation_;
+}
+
+bool ActivityThreadItem::wanted(const eLock&, const std::uint64_t generation)
+    const
+{
+    return requested_.get() && (generation == generation_);
+}
+
 std::chrono::system_clock::time_point ActivityThreadItem::Timestamp() const
 {
     sLock lock(shared_lock_);
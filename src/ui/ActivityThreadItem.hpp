@@ -29,6 +29,7 @@ public:
 
     void reindex(const ActivityThreadSortKey& key, const CustomData& custom)
         override;
+    void unload() override;
 
     virtual ~ActivityThreadItem() = default;
 
@@ -41,6 +42,31 @@ protected:
     std::string text_;
     OTFlag loading_;
     OTFlag pending_;
+    // Rows constructed in the loading state read their contents from storage
+    // the first time they are displayed, and may discard them afterwards
+    const bool lazy_;
+    mutable std::mutex load_lock_;
+    mutable OTFlag requested_;
+    // Incremented by unload() while holding both load_lock_ and shared_lock_
+    mutable std::uint64_t generation_;
+    mutable std::uint64_t load_;
+
+    /** Discards the contents which load() reads from storage */
+    virtual void clear(const eLock& lock);
+    /** Starts loading the row contents if they are not already present */
+    void fetch() const;
+    /** Reads the row contents from storage on a timer worker thread
+     *
+     *  Implementations must call wanted() while holding shared_lock_
+     *  exclusively and store their results only if it returns true.
+     */
+    virtual void load(const std::uint64_t) {}
+    /** Cancels or waits for a pending load. Must be called by subclass
+     *  destructors */
+    void stop_loading();
+    /** Returns false if the row was unloaded after the load of the specified
+     *  generation was scheduled */
+    bool wanted(const eLock& lock, const std::uint64_t generation) const;
 
     ActivityThreadItem(
         const ActivityThreadInternalInterface& parent,
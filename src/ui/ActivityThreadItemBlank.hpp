@@ -34,6 +34,7 @@ public:
     OTIdentifier WidgetID() const override { return Identifier::Factory(); }
 
     void reindex(const ActivityThreadSortKey&, const CustomData&) override {}
+    void unload() override {}
 
     ActivityThreadItemBlank() = default;
     ~ActivityThreadItemBlank() = default;
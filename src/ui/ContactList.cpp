@@ -72,6 +72,10 @@ ContactList::ContactList(
 
     OT_ASSERT(false == owner_contact_id_->empty())
 
+    // The owner row is displayed first but is not one of the sorted rows
+    Lock lock(lock_);
+    record_change(lock, Change::Insert, owner_contact_id_);
+    lock.unlock();
     init();
     setup_listeners(listeners_);
     startup_.reset(new std::thread(&ContactList::startup, this));
@@ -82,7 +86,7 @@ ContactList::ContactList(
 void ContactList::add_item(
     const ContactListRowID& id,
     const ContactListSortKey& index,
-    const CustomData& custom)
+    const CustomData& custom) const
 {
     otErr << OT_METHOD << __FUNCTION__ << ": Widget ID: " << WidgetID()->str()
           << std::endl;
@@ -97,6 +101,21 @@ void ContactList::add_item(
     ContactListList::add_item(id, index, custom);
 }
 
+SharedPimpl<ContactListRowInterface> ContactList::At(
+    const std::size_t index,
+    const std::uint64_t version) const
+{
+    if (0 < index) { return ContactListList::At(index - 1, version); }
+
+    Lock lock(lock_);
+
+    if (version != version_) {
+        return SharedPimpl<ContactListRowInterface>(blank_p_);
+    }
+
+    return SharedPimpl<ContactListRowInterface>(owner_);
+}
+
 void ContactList::construct_row(
     const ContactListRowID& id,
     const ContactListSortKey& index,
@@ -120,6 +139,19 @@ std::shared_ptr<const ContactListRowInternal> ContactList::first(
     return owner_;
 }
 
+std::uint64_t ContactList::Handle(
+    const std::size_t index,
+    const std::uint64_t version) const
+{
+    if (0 < index) { return ContactListList::Handle(index - 1, version); }
+
+    Lock lock(lock_);
+
+    if (version != version_) { return 0; }
+
+    return handles_.at(owner_contact_id_);
+}
+
 void ContactList::process_contact(const network::zeromq::Message& message)
 {
     wait_for_startup();
@@ -134,6 +166,11 @@ void ContactList::process_contact(const network::zeromq::Message& message)
     add_item(contactID, name, {});
 }
 
+std::size_t ContactList::Size() const
+{
+    return ContactListList::Size() + 1;
+}
+
 void ContactList::startup()
 {
     const auto contacts = api_.Contacts().ContactList();
@@ -21,7 +21,13 @@ using ContactListList = List<
 class ContactList final : public ContactListList
 {
 public:
+    SharedPimpl<ContactListRowInterface> At(
+        const std::size_t index,
+        const std::uint64_t version) const override;
+    std::uint64_t Handle(const std::size_t index, const std::uint64_t version)
+        const override;
     const Identifier& ID() const override { return owner_contact_id_; }
+    std::size_t Size() const override;
 
     ~ContactList() = default;
 
@@ -32,6 +38,10 @@ private:
     const OTIdentifier owner_contact_id_;
     std::shared_ptr<ContactListRowInternal> owner_;
 
+    void add_item(
+        const ContactListRowID& id,
+        const ContactListSortKey& index,
+        const CustomData& custom) const override;
     void construct_row(
         const ContactListRowID& id,
         const ContactListSortKey& index,
@@ -43,10 +53,6 @@ private:
         return ContactListList::last(id);
     }
 
-    void add_item(
-        const ContactListRowID& id,
-        const ContactListSortKey& index,
-        const CustomData& custom) override;
     void process_contact(const network::zeromq::Message& message);
     void startup();
 
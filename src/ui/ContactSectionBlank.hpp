@@ -18,6 +18,22 @@ class ContactSectionBlank final : public ContactRowInternal
 {
 public:
     std::string Name(const std::string& lang) const override { return {}; }
+    OTUIContactSubsection At(
+        const std::size_t,
+        const std::uint64_t) const override
+    {
+        const std::shared_ptr<const ui::ContactSubsection> empty;
+
+        return OTUIContactSubsection{empty};
+    }
+    bool Changes(const std::uint64_t, ChangeSet&) const override
+    {
+        return false;
+    }
+    std::uint64_t Handle(const std::size_t, const std::uint64_t) const override
+    {
+        return 0;
+    }
     OTUIContactSubsection First() const override
     {
         const std::shared_ptr<const ui::ContactSubsection> empty;
@@ -31,6 +47,8 @@ public:
 
         return OTUIContactSubsection{empty};
     }
+    std::size_t Size() const override { return 0; }
+    std::uint64_t Version() const override { return 0; }
     proto::ContactSectionName Type() const override { return {}; }
     bool Valid() const override { return false; }
     OTIdentifier WidgetID() const override { return Identifier::Factory(); }
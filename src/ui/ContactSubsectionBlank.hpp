@@ -18,6 +18,20 @@ class ContactSubsectionBlank final : public ContactSectionRowInternal
 {
 public:
     std::string Name(const std::string& lang) const override { return {}; }
+    OTUIContactItem At(const std::size_t, const std::uint64_t) const override
+    {
+        const std::shared_ptr<const ui::ContactItem> empty;
+
+        return OTUIContactItem{empty};
+    }
+    bool Changes(const std::uint64_t, ChangeSet&) const override
+    {
+        return false;
+    }
+    std::uint64_t Handle(const std::size_t, const std::uint64_t) const override
+    {
+        return 0;
+    }
     OTUIContactItem First() const override
     {
         const std::shared_ptr<const ui::ContactItem> empty;
@@ -31,6 +45,8 @@ public:
 
         return OTUIContactItem{empty};
     }
+    std::size_t Size() const override { return 0; }
+    std::uint64_t Version() const override { return 0; }
     proto::ContactItemType Type() const override { return {}; }
     bool Valid() const override { return false; }
     OTIdentifier WidgetID() const override { return Identifier::Factory(); }
@@ -50,15 +50,22 @@ struct ActivitySummaryItem : virtual public ui::ActivitySummaryItem {
         const implementation::CustomData& custom) = 0;
 };
 struct ActivityThread {
+    /** Called by a row every time its contents are displayed */
+    virtual void fetched(
+        const implementation::ActivityThreadRowID& id) const = 0;
     virtual bool last(const implementation::ActivityThreadRowID& id) const = 0;
     virtual OTIdentifier WidgetID() const = 0;
     // custom
     virtual std::string ThreadID() const = 0;
+    /** Runs the storage reads of rows which load their contents on demand */
+    virtual const api::internal::Timer& timer() const = 0;
 };
 struct ActivityThreadItem : virtual public ui::ActivityThreadItem {
     virtual void reindex(
         const implementation::ActivityThreadSortKey& key,
         const implementation::CustomData& custom) = 0;
+    /** Discards contents which can be reloaded from storage on demand */
+    virtual void unload() = 0;
 };
 struct BalanceItem : virtual public ui::BalanceItem {
     virtual void reindex(
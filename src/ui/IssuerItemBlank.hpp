@@ -22,6 +22,21 @@ public:
     // IssuerItem
     bool ConnectionState() const override { return {}; }
     std::string Debug() const override { return {}; }
+    OTUIAccountSummaryItem At(
+        const std::size_t,
+        const std::uint64_t) const override
+    {
+        return OTUIAccountSummaryItem{
+            std::make_shared<AccountSummaryItemBlank>()};
+    }
+    bool Changes(const std::uint64_t, ChangeSet&) const override
+    {
+        return false;
+    }
+    std::uint64_t Handle(const std::size_t, const std::uint64_t) const override
+    {
+        return 0;
+    }
     OTUIAccountSummaryItem First() const override
     {
         return OTUIAccountSummaryItem{
@@ -33,6 +48,8 @@ public:
         return OTUIAccountSummaryItem{
             std::make_shared<AccountSummaryItemBlank>()};
     }
+    std::size_t Size() const override { return 0; }
+    std::uint64_t Version() const override { return 0; }
     bool Trusted() const override { return {}; }
 
     void reindex(const AccountSummarySortKey&, const CustomData&) override {}
@@ -9,10 +9,16 @@
 
 #include "Widget.hpp"
 
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #define STARTUP_WAIT_MILLISECONDS 100
+#define LIST_CHANGE_LIMIT 1024
 
 #define LIST_METHOD "opentxs::ui::implementation::List::"
 
@@ -73,6 +79,66 @@ public:
     using Sort = sort_order<Outer, InternalInterface>;
     using OuterIterator = typename Sort::iterator;
 
+    SharedPimpl<RowInterface> At(
+        const std::size_t index,
+        const std::uint64_t version) const override
+    {
+        Lock lock(lock_);
+
+        if (version != version_) { return SharedPimpl<RowInterface>(blank_p_); }
+
+        const auto& rows = snapshot(lock);
+
+        if (index >= rows.size()) {
+            return SharedPimpl<RowInterface>(blank_p_);
+        }
+
+        return SharedPimpl<RowInterface>(rows.at(index).second);
+    }
+    bool Changes(const std::uint64_t since, ui::List::ChangeSet& output)
+        const override
+    {
+        Lock lock(lock_);
+        output = {};
+        output.version_ = version_;
+
+        if ((since < oldest_change_) || (since > version_)) { return false; }
+
+        auto& inserted = output.inserted_;
+        auto& removed = output.removed_;
+        auto& moved = output.moved_;
+
+        for (const auto& change : changes_) {
+            const auto& version = std::get<0>(change);
+            const auto& type = std::get<1>(change);
+            const auto& handle = std::get<2>(change);
+
+            if (version <= since) { continue; }
+
+            switch (type) {
+                case Change::Insert: {
+                    inserted.emplace(handle);
+                } break;
+                case Change::Remove: {
+                    moved.erase(handle);
+
+                    // Rows which were inserted and removed within the range
+                    // are not reported at all
+                    if (0 == inserted.erase(handle)) {
+                        removed.emplace(handle);
+                    }
+                } break;
+                case Change::Move: {
+                    if (0 == inserted.count(handle)) { moved.emplace(handle); }
+                } break;
+                default: {
+                    OT_FAIL
+                }
+            }
+        }
+
+        return true;
+    }
     SharedPimpl<RowInterface> First() const override
     {
         Lock lock(lock_);
@@ -87,6 +153,19 @@ public:
         return start_.get() && same(id, last_id_);
     }
 
+    std::uint64_t Handle(const std::size_t index, const std::uint64_t version)
+        const override
+    {
+        Lock lock(lock_);
+
+        if (version != version_) { return 0; }
+
+        const auto& rows = snapshot(lock);
+
+        if (index >= rows.size()) { return 0; }
+
+        return rows.at(index).first;
+    }
     SharedPimpl<RowInterface> Next() const override
     {
         Lock lock(lock_);
@@ -95,6 +174,18 @@ public:
 
         return SharedPimpl<RowInterface>(next(lock));
     }
+    std::size_t Size() const override
+    {
+        Lock lock(lock_);
+
+        return names_.size();
+    }
+    std::uint64_t Version() const override
+    {
+        Lock lock(lock_);
+
+        return version_;
+    }
 
     OTIdentifier WidgetID() const override { return widget_id_; }
 
@@ -108,6 +199,10 @@ public:
 
 protected:
     using ReverseType = std::map<RowID, SortKey>;
+    using Snapshot = std::vector<
+        std::pair<std::uint64_t, std::shared_ptr<const RowInternal>>>;
+
+    enum class Change : std::uint8_t { Insert, Remove, Move };
 
     const OTIdentifier nym_id_;
     mutable Outer items_;
@@ -121,7 +216,22 @@ protected:
     std::unique_ptr<std::thread> startup_{nullptr};
     const std::shared_ptr<const RowInternal> blank_p_{nullptr};
     const RowInternal& blank_;
+    mutable std::uint64_t version_;
+    mutable std::uint64_t oldest_change_;
+    mutable std::uint64_t next_handle_;
+    mutable std::map<RowID, std::uint64_t> handles_;
+    mutable std::deque<std::tuple<std::uint64_t, Change, std::uint64_t>>
+        changes_;
+    mutable Snapshot snapshot_;
+    mutable bool snapshot_current_;
 
+    virtual void add_item(
+        const RowID& id,
+        const SortKey& index,
+        const CustomData& custom) const
+    {
+        insert_outer(id, index, custom);
+    }
     virtual void construct_row(
         const RowID& id,
         const SortKey& index,
@@ -164,6 +274,21 @@ protected:
 
         UpdateNotify();
     }
+    /** Removes the specified rows, ignoring any which do not exist */
+    void delete_items(const std::set<RowID>& ids) const
+    {
+        Lock lock(lock_);
+        bool changed{false};
+
+        for (const auto& id : ids) {
+            if (0 < names_.count(id)) {
+                delete_item(lock, id);
+                changed = true;
+            }
+        }
+
+        if (changed) { UpdateNotify(); }
+    }
     void delete_item(const Lock& lock, const RowID& id) const
     {
         OT_ASSERT(verify_lock(lock))
@@ -185,6 +310,9 @@ protected:
         const auto indexDeleted = names_.erase(id);
 
         OT_ASSERT(1 == indexDeleted)
+
+        record_change(lock, Change::Remove, id);
+        row_removed(lock, id);
     }
     /** Returns first contact, or blank if none exists. Sets up iterators for
      *  next row
@@ -313,6 +441,33 @@ protected:
 
         return true;
     }
+    void insert_outer(
+        const RowID& id,
+        const SortKey& index,
+        const CustomData& custom) const
+    {
+        Lock lock(lock_);
+
+        if (0 == names_.count(id)) {
+            construct_row(id, index, custom);
+
+            OT_ASSERT(1 == items_.count(index))
+            OT_ASSERT(1 == names_.count(id))
+
+            record_change(lock, Change::Insert, id);
+
+            UpdateNotify();
+
+            return;
+        }
+
+        const auto& oldIndex = names_.at(id);
+
+        if (oldIndex == index) { return; }
+
+        reindex_item(lock, id, oldIndex, index, custom);
+        UpdateNotify();
+    }
     /** Returns the next item and increments iterators */
     const std::shared_ptr<const RowInternal> next(const Lock& lock) const
     {
@@ -356,11 +511,61 @@ protected:
         names_[id] = newIndex;
         row->reindex(newIndex, custom);
         items_[newIndex].emplace(id, std::move(row));
+        record_change(lock, Change::Move, id);
     }
+    /** Assigns handles to new rows and appends to the change log */
+    void record_change(const Lock& lock, const Change type, const RowID& id)
+        const
+    {
+        OT_ASSERT(verify_lock(lock))
+
+        std::uint64_t handle{0};
+
+        if (Change::Insert == type) {
+            handle = ++next_handle_;
+            handles_[id] = handle;
+        } else {
+            handle = handles_.at(id);
+
+            if (Change::Remove == type) { handles_.erase(id); }
+        }
+
+        changes_.emplace_back(++version_, type, handle);
+
+        while (LIST_CHANGE_LIMIT < changes_.size()) {
+            oldest_change_ = std::get<0>(changes_.front());
+            changes_.pop_front();
+        }
+
+        snapshot_current_ = false;
+    }
+    /** Called after a row has been deleted from the list */
+    virtual void row_removed(const Lock&, const RowID&) const {}
     virtual bool same(const RowID& lhs, const RowID& rhs) const
     {
         return (lhs == rhs);
     }
+    /** Returns every row in display order, rebuilding the cached copy only
+     *  if the list has changed since the previous call */
+    const Snapshot& snapshot(const Lock& lock) const
+    {
+        OT_ASSERT(verify_lock(lock))
+
+        if (snapshot_current_) { return snapshot_; }
+
+        snapshot_.clear();
+        snapshot_.reserve(names_.size());
+
+        for (auto outer = outer_first(); outer != outer_end(); ++outer) {
+            for (const auto& it : outer->second) {
+                snapshot_.emplace_back(handles_.at(it.first), it.second);
+            }
+        }
+
+        snapshot_current_ = true;
+
+        return snapshot_;
+    }
     void valid_iterators() const
     {
         OT_ASSERT(outer_end() != outer_)
@@ -376,40 +581,7 @@ protected:
         }
     }
 
-    virtual void add_item(
-        const RowID& id,
-        const SortKey& index,
-        const CustomData& custom)
-    {
-        insert_outer(id, index, custom);
-    }
     void init() { outer_ = outer_first(); }
-    void insert_outer(
-        const RowID& id,
-        const SortKey& index,
-        const CustomData& custom)
-    {
-        Lock lock(lock_);
-
-        if (0 == names_.count(id)) {
-            construct_row(id, index, custom);
-
-            OT_ASSERT(1 == items_.count(index))
-            OT_ASSERT(1 == names_.count(id))
-
-            UpdateNotify();
-
-            return;
-        }
-
-        const auto& oldIndex = names_.at(id);
-
-        if (oldIndex == index) { return; }
-
-        reindex_item(lock, id, oldIndex, index, custom);
-        UpdateNotify();
-    }
-
     List(
         const api::client::Manager& api,
         const network::zeromq::PublishSocket& publisher,
@@ -428,6 +600,13 @@ protected:
         , startup_(nullptr)
         , blank_p_(new RowBlank)
         , blank_(*blank_p_)
+        , version_(0)
+        , oldest_change_(0)
+        , next_handle_(0)
+        , handles_()
+        , changes_()
+        , snapshot_()
+        , snapshot_current_(false)
     {
         OT_ASSERT(blank_p_);
     }
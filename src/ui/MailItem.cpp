@@ -18,7 +18,7 @@
 #include "Row.hpp"
 
 #include <memory>
-#include <thread>
+#include <cstdint>
 
 #include "MailItem.hpp"
 
@@ -83,7 +83,6 @@ MailItem::MailItem(
           custom,
           loading,
           pending)
-    , load_(nullptr)
 {
     OT_ASSERT(false == nym_id_.empty());
     OT_ASSERT(false == item_id_.empty())
@@ -108,33 +107,12 @@ MailItem::MailItem(
           true,
           false)
 {
-    switch (box_) {
-        case StorageBox::MAILINBOX:
-        case StorageBox::MAILOUTBOX: {
-            load_.reset(new std::thread(&MailItem::load, this));
-        } break;
-        case StorageBox::SENTPEERREQUEST:
-        case StorageBox::INCOMINGPEERREQUEST:
-        case StorageBox::SENTPEERREPLY:
-        case StorageBox::INCOMINGPEERREPLY:
-        case StorageBox::FINISHEDPEERREQUEST:
-        case StorageBox::FINISHEDPEERREPLY:
-        case StorageBox::PROCESSEDPEERREQUEST:
-        case StorageBox::PROCESSEDPEERREPLY:
-        case StorageBox::INCOMINGBLOCKCHAIN:
-        case StorageBox::OUTGOINGBLOCKCHAIN:
-        case StorageBox::INCOMINGCHEQUE:
-        case StorageBox::OUTGOINGCHEQUE:
-        case StorageBox::DRAFT:
-        case StorageBox::UNKNOWN:
-        default: {
-        }
-    }
-
-    OT_ASSERT(load_)
+    // The message body is read from storage when the row is first displayed
+    OT_ASSERT(
+        (StorageBox::MAILINBOX == box_) || (StorageBox::MAILOUTBOX == box_))
 }
 
-void MailItem::load()
+void MailItem::load(const std::uint64_t generation)
 {
     std::shared_ptr<const std::string> text{nullptr};
 
@@ -165,14 +143,14 @@ void MailItem::load()
     OT_ASSERT(text)
 
     eLock lock(shared_lock_);
+
+    if (false == wanted(lock, generation)) { return; }
+
     text_ = *text;
     loading_->Off();
     pending_->Off();
     UpdateNotify();
 }
 
-MailItem::~MailItem()
-{
-    if (load_ && load_->joinable()) { load_->join(); }
-}
+MailItem::~MailItem() { stop_loading(); }
 }  // namespace opentxs::ui::implementation
@@ -19,9 +19,7 @@ public:
 private:
     friend opentxs::Factory;
 
-    std::unique_ptr<std::thread> load_{nullptr};
-
-    void load();
+    void load(const std::uint64_t generation) override;
 
     MailItem(
         const ActivityThreadInternalInterface& parent,
@@ -20,7 +20,7 @@
 #include "Row.hpp"
 
 #include <memory>
-#include <thread>
+#include <cstdint>
 
 #include "PaymentItem.hpp"
 
@@ -63,39 +63,19 @@ PaymentItem::PaymentItem(
     , display_amount_()
     , memo_()
     , amount_(0)
-    , load_(nullptr)
 {
     OT_ASSERT(false == nym_id_.empty())
     OT_ASSERT(false == item_id_.empty())
 
-    switch (box_) {
-        case StorageBox::INCOMINGCHEQUE:
-        case StorageBox::OUTGOINGCHEQUE: {
-            load_.reset(new std::thread(&PaymentItem::load, this));
-        } break;
-        case StorageBox::SENTPEERREQUEST:
-        case StorageBox::INCOMINGPEERREQUEST:
-        case StorageBox::SENTPEERREPLY:
-        case StorageBox::INCOMINGPEERREPLY:
-        case StorageBox::FINISHEDPEERREQUEST:
-        case StorageBox::FINISHEDPEERREPLY:
-        case StorageBox::PROCESSEDPEERREQUEST:
-        case StorageBox::PROCESSEDPEERREPLY:
-        case StorageBox::MAILINBOX:
-        case StorageBox::MAILOUTBOX:
-        case StorageBox::INCOMINGBLOCKCHAIN:
-        case StorageBox::OUTGOINGBLOCKCHAIN:
-        case StorageBox::DRAFT:
-        case StorageBox::UNKNOWN:
-        default: {
-        }
-    }
-
-    OT_ASSERT(load_)
+    // The cheque is read from storage when the row is first displayed
+    OT_ASSERT(
+        (StorageBox::INCOMINGCHEQUE == box_) ||
+        (StorageBox::OUTGOINGCHEQUE == box_))
 }
 
 opentxs::Amount PaymentItem::Amount() const
 {
+    fetch();
     sLock lock(shared_lock_);
 
     return amount_;
@@ -103,12 +83,13 @@ opentxs::Amount PaymentItem::Amount() const
 
 std::string PaymentItem::DisplayAmount() const
 {
+    fetch();
     sLock lock(shared_lock_);
 
     return display_amount_;
 }
 
-void PaymentItem::load()
+void PaymentItem::load(const std::uint64_t generation)
 {
     std::shared_ptr<const std::string> text{nullptr};
     std::string displayAmount{};
@@ -155,6 +136,9 @@ void PaymentItem::load()
     OT_ASSERT(text)
 
     eLock lock(shared_lock_);
+
+    if (false == wanted(lock, generation)) { return; }
+
     text_ = *text;
     display_amount_ = displayAmount;
     memo_ = memo;
@@ -166,13 +150,19 @@ void PaymentItem::load()
 
 std::string PaymentItem::Memo() const
 {
+    fetch();
     sLock lock(shared_lock_);
 
     return memo_;
 }
 
-PaymentItem::~PaymentItem()
+void PaymentItem::clear(const eLock& lock)
 {
-    if (load_ && load_->joinable()) { load_->join(); }
+    ActivityThreadItem::clear(lock);
+    display_amount_.clear();
+    memo_.clear();
+    amount_ = 0;
 }
+
+PaymentItem::~PaymentItem() { stop_loading(); }
 }  // namespace opentxs::ui::implementation
@@ -26,9 +26,9 @@ private:
     std::string display_amount_{};
     std::string memo_{};
     opentxs::Amount amount_{0};
-    std::unique_ptr<std::thread> load_{nullptr};
 
-    void load();
+    void clear(const eLock& lock) override;
+    void load(const std::uint64_t generation) override;
 
     PaymentItem(
         const ActivityThreadInternalInterface& parent,
@@ -26,6 +26,22 @@ public:
         return false;
     }
     bool Delete(const int, const std::string&) const override { return false; }
+    OTUIProfileSubsection At(
+        const std::size_t,
+        const std::uint64_t) const override
+    {
+        const std::shared_ptr<const ui::ProfileSubsection> empty;
+
+        return OTUIProfileSubsection{empty};
+    }
+    bool Changes(const std::uint64_t, ChangeSet&) const override
+    {
+        return false;
+    }
+    std::uint64_t Handle(const std::size_t, const std::uint64_t) const override
+    {
+        return 0;
+    }
     OTUIProfileSubsection First() const override
     {
         const std::shared_ptr<const ui::ProfileSubsection> empty;
@@ -41,6 +57,8 @@ public:
 
         return OTUIProfileSubsection{empty};
     }
+    std::size_t Size() const override { return 0; }
+    std::uint64_t Version() const override { return 0; }
     bool SetActive(const int, const std::string&, const bool) const override
     {
         return false;
@@ -22,6 +22,20 @@ public:
         return false;
     }
     bool Delete(const std::string&) const override { return false; }
+    OTUIProfileItem At(const std::size_t, const std::uint64_t) const override
+    {
+        const std::shared_ptr<const ui::ProfileItem> empty;
+
+        return OTUIProfileItem{empty};
+    }
+    bool Changes(const std::uint64_t, ChangeSet&) const override
+    {
+        return false;
+    }
+    std::uint64_t Handle(const std::size_t, const std::uint64_t) const override
+    {
+        return 0;
+    }
     OTUIProfileItem First() const override
     {
         const std::shared_ptr<const ui::ProfileItem> empty;
@@ -36,6 +50,8 @@ public:
 
         return OTUIProfileItem{empty};
     }
+    std::size_t Size() const override { return 0; }
+    std::uint64_t Version() const override { return 0; }
     proto::ContactItemType Type() const override { return {}; }
     bool SetActive(const std::string&, const bool) const override
     {
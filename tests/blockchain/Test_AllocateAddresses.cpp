@@ -0,0 +1,126 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace opentxs;
+
+namespace
+{
+class Test_AllocateAddresses : public ::testing::Test
+{
+public:
+    const opentxs::api::client::Manager& client_;
+
+    Test_AllocateAddresses()
+        : client_(opentxs::OT::App().StartClient({}, 0))
+    {
+    }
+};
+
+TEST_F(Test_AllocateAddresses, testGapLimit)
+{
+    const auto nymID = Identifier::Factory(client_.Exec().CreateNymHD(
+        proto::CITEMTYPE_INDIVIDUAL, "testGapLimit", "", 110));
+    const OTIdentifier accountID = client_.Blockchain().NewAccount(
+        nymID, BlockchainAccountType::BIP44, proto::CITEMTYPE_BTC);
+
+    ASSERT_EQ(
+        20,
+        client_.Blockchain().AllocateAddresses(
+            nymID, accountID, 20, EXTERNAL_CHAIN));
+    ASSERT_EQ(
+        0,
+        client_.Blockchain().AllocateAddresses(
+            nymID, accountID, 20, EXTERNAL_CHAIN));
+    ASSERT_EQ(
+        5,
+        client_.Blockchain().AllocateAddresses(
+            nymID, accountID, 5, INTERNAL_CHAIN));
+
+    const auto account = client_.Blockchain().Account(nymID, accountID);
+
+    ASSERT_TRUE(account);
+    EXPECT_EQ(20, account->externalindex());
+    EXPECT_EQ(5, account->internalindex());
+
+    // Addresses derived in a batch must match individually loaded addresses
+    // and be present in the reverse index
+    for (std::uint32_t i = 0; i < 20; ++i) {
+        const auto address =
+            client_.Blockchain().LoadAddress(nymID, accountID, i, false);
+
+        ASSERT_TRUE(address);
+
+        auto foundAccount = Identifier::Factory();
+        BIP44Chain foundChain{INTERNAL_CHAIN};
+        std::uint32_t foundIndex{0};
+
+        ASSERT_TRUE(client_.Blockchain().LookupAddress(
+            nymID,
+            proto::CITEMTYPE_BTC,
+            address->address(),
+            foundAccount,
+            foundChain,
+            foundIndex));
+        EXPECT_EQ(accountID->str(), foundAccount->str());
+        EXPECT_EQ(EXTERNAL_CHAIN, foundChain);
+        EXPECT_EQ(i, foundIndex);
+    }
+
+    const auto next = client_.Blockchain().AllocateAddress(
+        nymID, accountID, "", INTERNAL_CHAIN);
+
+    ASSERT_TRUE(next);
+    EXPECT_EQ(5, next->index());
+}
+
+TEST_F(Test_AllocateAddresses, testLookupOwnerAndChain)
+{
+    const auto nymID = Identifier::Factory(client_.Exec().CreateNymHD(
+        proto::CITEMTYPE_INDIVIDUAL, "testLookupOwner", "", 111));
+    const auto otherNymID = Identifier::Factory(client_.Exec().CreateNymHD(
+        proto::CITEMTYPE_INDIVIDUAL, "testLookupOther", "", 112));
+    const OTIdentifier accountID = client_.Blockchain().NewAccount(
+        nymID, BlockchainAccountType::BIP44, proto::CITEMTYPE_BTC);
+    const auto address = client_.Blockchain().AllocateAddress(
+        nymID, accountID, "", EXTERNAL_CHAIN);
+
+    ASSERT_TRUE(address);
+
+    auto foundAccount = Identifier::Factory();
+    BIP44Chain foundChain{INTERNAL_CHAIN};
+    std::uint32_t foundIndex{0};
+
+    EXPECT_TRUE(client_.Blockchain().LookupAddress(
+        nymID,
+        proto::CITEMTYPE_BTC,
+        address->address(),
+        foundAccount,
+        foundChain,
+        foundIndex));
+    EXPECT_EQ(accountID->str(), foundAccount->str());
+
+    // The address is already in the index, but belongs to a different owner
+    EXPECT_FALSE(client_.Blockchain().LookupAddress(
+        otherNymID,
+        proto::CITEMTYPE_BTC,
+        address->address(),
+        foundAccount,
+        foundChain,
+        foundIndex));
+
+    // or to a different chain
+    EXPECT_FALSE(client_.Blockchain().LookupAddress(
+        nymID,
+        proto::CITEMTYPE_BCH,
+        address->address(),
+        foundAccount,
+        foundChain,
+        foundIndex));
+}
+}  // namespace
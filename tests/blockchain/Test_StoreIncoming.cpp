@@ -7,6 +7,10 @@
 
 #include <gtest/gtest.h>
 
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
 using namespace opentxs;
 
 namespace
@@ -304,4 +308,93 @@ TEST_F(Test_StoreIncoming, testIncomingDeposit_UnknownContact)
     EXPECT_TRUE(Deposit.unread());
 }
 
+TEST_F(Test_StoreIncoming, testIncomingBatch)
+{
+    const auto nymID = Identifier::Factory(Alice);
+    const auto first =
+        client_.Blockchain().AllocateAddress(nymID, AccountID, "Batch 1");
+    const auto second =
+        client_.Blockchain().AllocateAddress(nymID, AccountID, "Batch 2");
+
+    ASSERT_TRUE(bool(first));
+    ASSERT_TRUE(bool(second));
+
+    std::unique_ptr<proto::BlockchainTransaction> TxA{MakeTransaction(
+        "b5d1f2bb4e7a5e5a2d07ad86e1cfc6ff0b8b7f01b0ed3e4d96a43c1bcf8d5a11")};
+    std::unique_ptr<proto::BlockchainTransaction> TxB{MakeTransaction(
+        "0f58fbb2e3fa3d74e6bf7bd8f3a0a0e62ac2e5a21c1c78b5d6f0d1a2b3c4d5e6")};
+    const api::client::Blockchain::IncomingTransactions batch{
+        {EXTERNAL_CHAIN, first->index(), *TxA},
+        {EXTERNAL_CHAIN, first->index(), *TxB},
+        {EXTERNAL_CHAIN, second->index(), *TxB},
+        {EXTERNAL_CHAIN, first->index(), *TxA}};
+
+    EXPECT_TRUE(client_.Blockchain().StoreIncoming(nymID, AccountID, batch));
+
+    const auto loadedFirst = client_.Blockchain().LoadAddress(
+        nymID, AccountID, first->index(), EXTERNAL_CHAIN);
+    const auto loadedSecond = client_.Blockchain().LoadAddress(
+        nymID, AccountID, second->index(), EXTERNAL_CHAIN);
+
+    ASSERT_TRUE(bool(loadedFirst));
+    ASSERT_TRUE(bool(loadedSecond));
+    EXPECT_EQ(2, loadedFirst->incoming_size());
+    EXPECT_EQ(1, loadedSecond->incoming_size());
+    EXPECT_STREQ(TxB->txid().c_str(), loadedSecond->incoming(0).c_str());
+    EXPECT_TRUE(bool(client_.Blockchain().Transaction(TxA->txid())));
+    EXPECT_TRUE(bool(client_.Blockchain().Transaction(TxB->txid())));
+}
+
+TEST_F(Test_StoreIncoming, testIncomingManySegments)
+{
+    const auto nymID = Identifier::Factory(Alice);
+    const auto address =
+        client_.Blockchain().AllocateAddress(nymID, AccountID, "Segments");
+
+    ASSERT_TRUE(bool(address));
+
+    // Transaction ids are stored in segments of 256, so this batch fills one
+    // segment and starts the next
+    const std::size_t count{300};
+    std::vector<std::unique_ptr<proto::BlockchainTransaction>> transactions{};
+    api::client::Blockchain::IncomingTransactions batch{};
+
+    for (std::size_t i = 0; i <= count; ++i) {
+        std::stringstream txid{};
+        txid << "5e6d" << std::hex << std::setfill('0') << std::setw(60) << i;
+        transactions.emplace_back(MakeTransaction(txid.str()));
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+        batch.emplace_back(EXTERNAL_CHAIN, address->index(), *transactions[i]);
+    }
+
+    ASSERT_TRUE(client_.Blockchain().StoreIncoming(nymID, AccountID, batch));
+
+    auto loaded = client_.Blockchain().LoadAddress(
+        nymID, AccountID, address->index(), EXTERNAL_CHAIN);
+
+    ASSERT_TRUE(bool(loaded));
+    EXPECT_EQ(count, loaded->incoming_size());
+
+    // A later transaction is appended to the last segment
+    ASSERT_TRUE(client_.Blockchain().StoreIncoming(
+        nymID,
+        AccountID,
+        address->index(),
+        EXTERNAL_CHAIN,
+        *transactions[count]));
+
+    loaded = client_.Blockchain().LoadAddress(
+        nymID, AccountID, address->index(), EXTERNAL_CHAIN);
+
+    ASSERT_TRUE(bool(loaded));
+    EXPECT_EQ(count + 1, loaded->incoming_size());
+
+    for (const auto& transaction : transactions) {
+        const auto& txid = transaction->txid();
+
+        EXPECT_TRUE(bool(client_.Blockchain().Transaction(txid)));
+    }
+}
 }  // namespace
@@ -0,0 +1,214 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace opentxs;
+
+namespace
+{
+class Test_SignatureCache : public ::testing::Test
+{
+public:
+    const opentxs::api::client::Manager& client_;
+    const std::string seed_;
+    const std::string nym_id_;
+    const ConstNym nym_;
+
+    Test_SignatureCache()
+        : client_(opentxs::OT::App().StartClient({}, 0))
+        , seed_(client_.Exec().Wallet_ImportSeed(
+              "spike nominee miss inquiry fee nothing belt list other daughter "
+              "leave valley twelve gossip paper",
+              ""))
+        , nym_id_(client_.Exec().CreateNymHD(
+              proto::CITEMTYPE_INDIVIDUAL,
+              "Alice",
+              seed_,
+              0))
+        , nym_(client_.Wallet().Nym(Identifier::Factory(nym_id_)))
+    {
+    }
+
+    std::unique_ptr<Message> signed_message(const std::string& request)
+    {
+        auto output = client_.Factory().Message();
+
+        if (false == bool(output)) { return output; }
+
+        output->m_strCommand.Set("getRequestNumber");
+        output->m_strNymID.Set(nym_id_.c_str());
+        output->m_strNotaryID.Set(nym_id_.c_str());
+        output->m_strRequestNum.Set(request.c_str());
+
+        if (false == output->SignContract(*nym_)) {
+            output.reset();
+        } else {
+            output->SaveContract();
+        }
+
+        return output;
+    }
+
+    std::string raw(const Message& message)
+    {
+        auto output = String::Factory();
+        message.SaveContractRaw(output);
+
+        return output->Get();
+    }
+
+    /** Returns the position of the first signature in a raw contract */
+    std::size_t signature(const std::string& raw)
+    {
+        const auto end = raw.find(" SIGNATURE-----");
+
+        if (std::string::npos == end) { return end; }
+
+        return raw.rfind("-----BEGIN ", end);
+    }
+
+    bool verify(const std::string& raw)
+    {
+        auto message = client_.Factory().Message();
+
+        if (false == bool(message)) { return false; }
+
+        if (false == message->LoadContractFromString(String::Factory(raw))) {
+            return false;
+        }
+
+        return message->VerifySignature(*nym_);
+    }
+};
+
+TEST_F(Test_SignatureCache, repeated_verification)
+{
+    ASSERT_TRUE(bool(nym_));
+
+    const auto message = signed_message("1");
+
+    ASSERT_TRUE(bool(message));
+
+    Contract::ClearSignatureCache();
+
+    ASSERT_TRUE(message->VerifySignature(*nym_));
+
+    const auto first = Contract::SignatureCache();
+
+    EXPECT_EQ(0, first.hits_);
+    EXPECT_EQ(1, first.inserts_);
+    EXPECT_EQ(1, first.size_);
+
+    ASSERT_TRUE(message->VerifySignature(*nym_));
+
+    const auto second = Contract::SignatureCache();
+
+    EXPECT_EQ(1, second.hits_);
+    EXPECT_EQ(first.inserts_, second.inserts_);
+    EXPECT_EQ(1, second.size_);
+}
+
+TEST_F(Test_SignatureCache, reloaded_and_distinct_contents)
+{
+    ASSERT_TRUE(bool(nym_));
+
+    const auto original = signed_message("2");
+    const auto other = signed_message("3");
+
+    ASSERT_TRUE(bool(original));
+    ASSERT_TRUE(bool(other));
+
+    Contract::ClearSignatureCache();
+
+    ASSERT_TRUE(original->VerifySignature(*nym_));
+
+    // A copy parsed from the saved form carries the same contents and
+    // signature, so verifying it is answered by the cache
+    auto raw = String::Factory();
+
+    ASSERT_TRUE(original->SaveContractRaw(raw));
+
+    auto copy = client_.Factory().Message();
+
+    ASSERT_TRUE(bool(copy));
+    ASSERT_TRUE(copy->LoadContractFromString(raw));
+    ASSERT_TRUE(copy->VerifySignature(*nym_));
+
+    const auto reloaded = Contract::SignatureCache();
+
+    EXPECT_EQ(1, reloaded.hits_);
+    EXPECT_EQ(1, reloaded.inserts_);
+
+    // Different contents from the same signer are not answered by the cache
+    ASSERT_TRUE(other->VerifySignature(*nym_));
+
+    const auto distinct = Contract::SignatureCache();
+
+    EXPECT_EQ(reloaded.hits_, distinct.hits_);
+    EXPECT_EQ(2, distinct.inserts_);
+    EXPECT_EQ(2, distinct.size_);
+}
+
+TEST_F(Test_SignatureCache, tampered_contract)
+{
+    ASSERT_TRUE(bool(nym_));
+
+    const auto first = signed_message("4");
+    const auto second = signed_message("5");
+
+    ASSERT_TRUE(bool(first));
+    ASSERT_TRUE(bool(second));
+
+    Contract::ClearSignatureCache();
+
+    // Both genuine signatures are in the cache
+    ASSERT_TRUE(first->VerifySignature(*nym_));
+    ASSERT_TRUE(second->VerifySignature(*nym_));
+
+    const auto before = Contract::SignatureCache();
+    const auto original = raw(*first);
+    const auto other = raw(*second);
+
+    ASSERT_TRUE(verify(original));
+
+    const auto genuine = Contract::SignatureCache();
+
+    EXPECT_EQ(before.hits_ + 1, genuine.hits_);
+
+    // Changed contents under the original signature
+    const std::string number{"requestNum=\"4\""};
+    auto contents = original;
+    const auto request = contents.find(number);
+
+    ASSERT_NE(std::string::npos, request);
+
+    contents.replace(request, number.size(), "requestNum=\"6\"");
+
+    EXPECT_FALSE(verify(contents));
+
+    // The original contents under a valid signature by the same key over
+    // other contents
+    const auto position = signature(original);
+    const auto otherPosition = signature(other);
+
+    ASSERT_NE(std::string::npos, position);
+    ASSERT_NE(std::string::npos, otherPosition);
+
+    const auto swapped =
+        original.substr(0, position) + other.substr(otherPosition);
+
+    ASSERT_NE(original, swapped);
+    EXPECT_FALSE(verify(swapped));
+
+    const auto after = Contract::SignatureCache();
+
+    EXPECT_EQ(genuine.hits_, after.hits_);
+    EXPECT_EQ(genuine.inserts_, after.inserts_);
+    EXPECT_EQ(2, after.size_);
+}
+}  // namespace
@@ -0,0 +1,90 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <set>
+#include <string>
+#include <vector>
+
+#define SLICE_LIMIT 2
+
+using namespace opentxs;
+
+namespace
+{
+class Test_StorageMap : public ::testing::Test
+{
+public:
+    const opentxs::api::client::Manager& client_;
+    std::set<std::string> created_;
+
+    Test_StorageMap()
+        : client_(opentxs::OT::App().StartClient({}, 0))
+        , created_()
+    {
+        for (std::int32_t i = 0; i < 5; ++i) {
+            created_.emplace(client_.Exec().CreateNymHD(
+                proto::CITEMTYPE_INDIVIDUAL,
+                "testStorageMap_" + std::to_string(i),
+                "",
+                80 + i));
+        }
+    }
+};
+
+TEST_F(Test_StorageMap, public_nyms_in_slices)
+{
+    std::set<std::string> stored{};
+
+    for (const auto& [id, alias] : client_.Storage().NymList()) {
+        stored.emplace(id);
+    }
+
+    std::vector<std::string> slice{};
+    std::set<std::string> visited{};
+    std::string after{};
+    NymLambda lambda = [&](const proto::CredentialIndex& nym) -> void {
+        slice.emplace_back(nym.nymid());
+    };
+    std::size_t slices{0};
+
+    do {
+        slice.clear();
+        const auto cursor =
+            client_.Storage().MapPublicNyms(lambda, after, SLICE_LIMIT);
+
+        ASSERT_GE(SLICE_LIMIT, slice.size());
+
+        for (const auto& id : slice) {
+            // Every id of a slice follows the cursor it was started from
+            EXPECT_LT(after, id);
+            EXPECT_GE(cursor, id);
+            EXPECT_TRUE(visited.emplace(id).second);
+        }
+
+        after = cursor;
+        ++slices;
+    } while (false == after.empty());
+
+    // The final call finds nothing after the last id and ends the walk
+    EXPECT_EQ(1 + (stored.size() + SLICE_LIMIT - 1) / SLICE_LIMIT, slices);
+
+    for (const auto& id : created_) { EXPECT_EQ(1, visited.count(id)); }
+
+    for (const auto& id : visited) { EXPECT_EQ(1, stored.count(id)); }
+
+    // Starting from the last id ends the walk at once
+    slice.clear();
+
+    EXPECT_TRUE(client_.Storage()
+                    .MapPublicNyms(lambda, *stored.rbegin(), SLICE_LIMIT)
+                    .empty());
+    EXPECT_TRUE(slice.empty());
+}
+}  // namespace
@@ -0,0 +1,93 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+
+#include "Internal.hpp"
+#include "core/ExpiringCache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+
+using namespace opentxs;
+
+namespace
+{
+using Cache = ExpiringCache<int, std::string>;
+
+TEST(ExpiringCache, evicts_least_recently_used)
+{
+    Cache cache{3, std::chrono::seconds(300)};
+    std::string value{};
+    cache.Insert(1, "one");
+    cache.Insert(2, "two");
+    cache.Insert(3, "three");
+
+    // Reading the oldest entry protects it from the next eviction
+    ASSERT_TRUE(cache.Find(1, value));
+    EXPECT_EQ("one", value);
+
+    cache.Insert(4, "four");
+
+    EXPECT_EQ(3, cache.Size());
+    EXPECT_TRUE(cache.Find(1, value));
+    EXPECT_FALSE(cache.Find(2, value));
+    EXPECT_TRUE(cache.Find(3, value));
+    EXPECT_TRUE(cache.Find(4, value));
+
+    // Replacing an entry does not evict anything else
+    cache.Insert(3, "drei");
+
+    EXPECT_EQ(3, cache.Size());
+    ASSERT_TRUE(cache.Find(3, value));
+    EXPECT_EQ("drei", value);
+}
+
+TEST(ExpiringCache, expires_after_insertion)
+{
+    Cache cache{8, std::chrono::seconds(60)};
+    const auto start = Cache::Clock::now();
+    std::string value{};
+    cache.Insert(1, "one", start);
+    cache.Insert(2, "two", start + std::chrono::seconds(30));
+
+    // Reading an entry does not extend its lifetime
+    EXPECT_TRUE(cache.Find(1, value, start + std::chrono::seconds(59)));
+    EXPECT_FALSE(cache.Find(1, value, start + std::chrono::seconds(60)));
+    EXPECT_EQ(1, cache.Size());
+
+    cache.Insert(3, "three", start + std::chrono::seconds(60));
+
+    EXPECT_EQ(0, cache.Purge(start + std::chrono::seconds(89)));
+    EXPECT_EQ(1, cache.Purge(start + std::chrono::seconds(90)));
+    EXPECT_EQ(1, cache.Size());
+    EXPECT_EQ(1, cache.Purge(start + std::chrono::seconds(120)));
+    EXPECT_EQ(0, cache.Size());
+}
+
+TEST(ExpiringCache, modify_and_clear)
+{
+    Cache cache{2, std::chrono::seconds(300)};
+    std::string value{};
+    cache.Insert(1, "one");
+    cache.Insert(2, "two");
+
+    EXPECT_FALSE(cache.Modify(3, [](std::string& item) { item = "three"; }));
+    ASSERT_TRUE(cache.Modify(1, [](std::string& item) { item = "uno"; }));
+
+    // Modifying an entry does not count as using it
+    cache.Insert(3, "three");
+
+    EXPECT_FALSE(cache.Find(1, value));
+    EXPECT_TRUE(cache.Find(2, value));
+
+    cache.Clear();
+
+    EXPECT_EQ(0, cache.Size());
+    EXPECT_FALSE(cache.Find(2, value));
+}
+}  // namespace
@@ -0,0 +1,75 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace opentxs;
+
+namespace
+{
+class Test_Log : public ::testing::Test
+{
+public:
+    const int original_;
+    int evaluated_;
+
+    std::string expensive()
+    {
+        ++evaluated_;
+
+        return std::string(4096, 'x');
+    }
+
+    Test_Log()
+        : original_(LogSource::Verbosity())
+        , evaluated_(0)
+    {
+    }
+
+    ~Test_Log() { LogSource::SetVerbosity(original_); }
+};
+
+TEST_F(Test_Log, disabled_levels_skip_formatting)
+{
+    LogSource::SetVerbosity(0);
+
+    EXPECT_FALSE(otInfo.Enabled());
+    EXPECT_FALSE(otLog3.Enabled());
+    EXPECT_TRUE(otOut.Enabled());
+    EXPECT_TRUE(otErr.Enabled());
+    EXPECT_FALSE(LogSource(1).Enabled());
+
+    OT_LOG_IF(otInfo) << expensive() << std::endl;
+    OT_LOG_IF(otLog3) << expensive() << std::endl;
+
+    EXPECT_EQ(0, evaluated_);
+
+    // Without the macro the argument is built, but nothing reaches the buffer
+    otInfo << expensive() << std::endl;
+
+    EXPECT_EQ(1, evaluated_);
+}
+
+TEST_F(Test_Log, enabled_levels)
+{
+    LogSource::SetVerbosity(2);
+
+    EXPECT_TRUE(otWarn.Enabled());
+    EXPECT_TRUE(otInfo.Enabled());
+    EXPECT_FALSE(otLog3.Enabled());
+    EXPECT_TRUE(LogSource(2).Enabled());
+    EXPECT_FALSE(LogSource(3).Enabled());
+
+    // A verbosity of -1 silences everything except errors
+    LogSource::SetVerbosity(-1);
+
+    EXPECT_FALSE(otOut.Enabled());
+    EXPECT_TRUE(otErr.Enabled());
+}
+}  // namespace
@@ -0,0 +1,133 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace opentxs;
+
+namespace
+{
+TEST(NumList, add_and_remove)
+{
+    NumList list;
+
+    ASSERT_TRUE(list.Add(5));
+    ASSERT_TRUE(list.Add(7));
+    ASSERT_TRUE(list.Add(6));
+    ASSERT_FALSE(list.Add(6));
+    ASSERT_EQ(3, list.Count());
+    ASSERT_TRUE(list.Verify(std::set<std::int64_t>{5, 6, 7}));
+    ASSERT_TRUE(list.Remove(6));
+    ASSERT_FALSE(list.Remove(6));
+    ASSERT_FALSE(list.Verify(6));
+    ASSERT_TRUE(list.Verify(5));
+    ASSERT_TRUE(list.Verify(7));
+    ASSERT_EQ(2, list.Count());
+}
+
+TEST(NumList, serialize_ranges)
+{
+    NumList list(std::set<std::int64_t>{1, 2, 3, 4, 7, 9, 10, 20});
+    String serialized;
+
+    ASSERT_TRUE(list.Output(serialized, true));
+    EXPECT_STREQ("1-4,7,9,10,20", serialized.Get());
+
+    NumList parsed(serialized);
+
+    EXPECT_TRUE(parsed.Verify(list));
+    EXPECT_EQ(8, parsed.Count());
+
+    // Readers which may not understand runs get every number
+    String legacy;
+
+    ASSERT_TRUE(list.Output(legacy));
+    EXPECT_STREQ("1,2,3,4,7,9,10,20", legacy.Get());
+}
+
+TEST(NumList, reject_malformed_ranges)
+{
+    for (const auto& input :
+         {"-3", "3-", "1--3", "1-2-3", "1-a", "1-,2"}) {
+        NumList parsed;
+
+        EXPECT_FALSE(parsed.Add(std::string(input))) << input;
+        EXPECT_FALSE(parsed.Verify(3)) << input;
+    }
+}
+
+TEST(NumList, reject_reversed_range)
+{
+    NumList parsed;
+
+    EXPECT_FALSE(parsed.Add(std::string("1,9-5")));
+    EXPECT_EQ(1, parsed.Count());
+    EXPECT_FALSE(parsed.Verify(5));
+    EXPECT_FALSE(parsed.Verify(9));
+}
+
+TEST(NumList, reject_huge_ranges)
+{
+    NumList parsed;
+
+    // A range of every positive number would exhaust memory if expanded
+    EXPECT_FALSE(parsed.Add(std::string("1-9223372036854775807")));
+    EXPECT_EQ(0, parsed.Count());
+
+    // Numbers which do not fit in 64 bits are rejected rather than wrapped
+    EXPECT_FALSE(parsed.Add(std::string("5-92233720368547758070")));
+    EXPECT_FALSE(parsed.Add(std::string("18446744073709551621")));
+    EXPECT_EQ(0, parsed.Count());
+
+    // The limit applies to the total of all ranges in the same string
+    const auto limit = std::int64_t{OT_NUMLIST_MAX_RANGE_NUMBERS};
+
+    EXPECT_TRUE(parsed.Add("1-" + std::to_string(limit)));
+    EXPECT_EQ(limit, parsed.Count());
+
+    parsed.Release();
+
+    EXPECT_FALSE(parsed.Add(
+        "1-" + std::to_string(limit / 2) + "," + std::to_string(limit) + "-" +
+        std::to_string(limit + (limit / 2))));
+    EXPECT_EQ(limit / 2, parsed.Count());
+}
+
+TEST(NumList, parse_legacy_format)
+{
+    NumList parsed(std::string("3, 1,2"));
+    std::set<std::int64_t> output;
+
+    ASSERT_TRUE(parsed.Output(output));
+    EXPECT_EQ((std::set<std::int64_t>{1, 2, 3}), output);
+}
+
+TEST(NumList, verify_any)
+{
+    const NumList list(std::set<std::int64_t>{10, 11, 12, 13});
+
+    EXPECT_TRUE(list.VerifyAny(NumList(std::string("1-10"))));
+    EXPECT_FALSE(list.VerifyAny(NumList(std::string("1-9,14-20"))));
+    EXPECT_TRUE(list.VerifyAny(std::set<std::int64_t>{12}));
+    EXPECT_FALSE(list.VerifyAny(std::set<std::int64_t>{9, 14}));
+}
+
+TEST(NumList, pop_in_order)
+{
+    NumList list(std::string("4-6,2"));
+    std::int64_t number{0};
+
+    for (const std::int64_t expected : {2, 4, 5, 6}) {
+        ASSERT_TRUE(list.Peek(number));
+        EXPECT_EQ(expected, number);
+        ASSERT_TRUE(list.Pop());
+    }
+
+    EXPECT_FALSE(list.Peek(number));
+    EXPECT_EQ(0, list.Count());
+}
+}  // namespace
@@ -0,0 +1,54 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+
+#include "Internal.hpp"
+#include "core/RecentSet.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace opentxs;
+
+namespace
+{
+using Set = RecentSet<int>;
+using Evicted = std::vector<int>;
+
+TEST(RecentSet, evicts_least_recently_used)
+{
+    Set set{3};
+
+    EXPECT_TRUE(set.Touch(1).empty());
+    EXPECT_TRUE(set.Touch(2).empty());
+    EXPECT_TRUE(set.Touch(3).empty());
+
+    // Using the oldest key again protects it from the next eviction
+    EXPECT_TRUE(set.Touch(1).empty());
+    EXPECT_EQ(Evicted{2}, set.Touch(4));
+    EXPECT_EQ(3, set.Size());
+    EXPECT_EQ(Evicted{3}, set.Touch(5));
+
+    // Touching a key which is already present never evicts anything
+    EXPECT_TRUE(set.Touch(4).empty());
+    EXPECT_TRUE(set.Touch(5).empty());
+    EXPECT_EQ(Evicted{1}, set.Touch(2));
+}
+
+TEST(RecentSet, erase)
+{
+    Set set{2};
+    set.Touch(1);
+    set.Touch(2);
+    set.Erase(1);
+    set.Erase(3);
+
+    EXPECT_EQ(1, set.Size());
+    EXPECT_TRUE(set.Touch(3).empty());
+    EXPECT_EQ(Evicted{2}, set.Touch(1));
+}
+}  // namespace
@@ -0,0 +1,288 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+
+#include "Internal.hpp"
+#include "storage/drivers/ReplicationQueue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#define TEST_JOURNAL "test_replication_queue.journal"
+
+using namespace opentxs;
+
+namespace
+{
+using Queue = storage::implementation::ReplicationQueue;
+using Replication = storage::implementation::Replication;
+
+class Test_ReplicationQueue : public ::testing::Test
+{
+public:
+    Test_ReplicationQueue() { std::remove(TEST_JOURNAL); }
+
+    ~Test_ReplicationQueue() { std::remove(TEST_JOURNAL); }
+};
+
+Replication object(const std::string& key)
+{
+    Replication output{};
+    output.type_ = Replication::Type::Object;
+    output.flag_ = true;
+    output.key_ = key;
+    output.value_ = "value of " + key;
+
+    return output;
+}
+
+Replication root(const std::string& key)
+{
+    Replication output{};
+    output.type_ = Replication::Type::Root;
+    output.key_ = key;
+
+    return output;
+}
+
+std::size_t journal_lines()
+{
+    std::ifstream file(TEST_JOURNAL);
+    std::string line{};
+    std::size_t output{0};
+
+    while (std::getline(file, line)) { ++output; }
+
+    return output;
+}
+
+TEST_F(Test_ReplicationQueue, recover_journal)
+{
+    {
+        Queue queue{TEST_JOURNAL, 8};
+        bool malformed{true};
+
+        ASSERT_EQ(0, queue.Open(malformed));
+        EXPECT_FALSE(malformed);
+
+        queue.Push(object("a"));
+        queue.Push(object("b"));
+        queue.Push(root("root"));
+        queue.Shutdown();
+    }
+
+    Queue queue{TEST_JOURNAL, 8};
+    bool malformed{true};
+
+    ASSERT_EQ(3, queue.Open(malformed));
+    EXPECT_FALSE(malformed);
+    EXPECT_EQ(3, queue.Size());
+
+    Replication item{};
+
+    ASSERT_TRUE(queue.Next(item));
+    EXPECT_EQ(Replication::Type::Object, item.type_);
+    EXPECT_TRUE(item.flag_);
+    EXPECT_EQ("a", item.key_);
+    // Only keys are journaled, so values are read back from the primary
+    EXPECT_TRUE(item.value_.empty());
+
+    queue.Pop();
+
+    ASSERT_TRUE(queue.Next(item));
+    EXPECT_EQ("b", item.key_);
+
+    queue.Pop();
+
+    ASSERT_TRUE(queue.Next(item));
+    EXPECT_EQ(Replication::Type::Root, item.type_);
+    EXPECT_EQ("root", item.key_);
+}
+
+TEST_F(Test_ReplicationQueue, malformed_entry)
+{
+    {
+        std::ofstream file(TEST_JOURNAL);
+        file << "not an entry\n"
+             << "9 0 0 key\n"
+             << "0 0 1 key\n";
+    }
+
+    Queue queue{TEST_JOURNAL, 8};
+    bool malformed{false};
+
+    EXPECT_EQ(1, queue.Open(malformed));
+    EXPECT_TRUE(malformed);
+
+    // The lost writes can only be recovered by a full synchronization
+    EXPECT_TRUE(queue.Gap());
+}
+
+TEST_F(Test_ReplicationQueue, trim_as_applied)
+{
+    Queue queue{TEST_JOURNAL, 8};
+    bool malformed{false};
+    queue.Open(malformed);
+
+    for (const auto& key : {"a", "b", "c", "d"}) { queue.Push(object(key)); }
+
+    EXPECT_EQ(4, journal_lines());
+
+    // The journal is rewritten once the applied entries outnumber the
+    // pending ones, and never loses a pending entry
+    queue.Pop();
+
+    EXPECT_EQ(4, journal_lines());
+
+    queue.Pop();
+
+    EXPECT_EQ(2, journal_lines());
+
+    queue.Pop();
+
+    EXPECT_EQ(1, journal_lines());
+
+    queue.Pop();
+
+    EXPECT_EQ(0, journal_lines());
+    EXPECT_EQ(0, queue.Size());
+
+    // Writes after a trim are appended to the new journal
+    queue.Push(object("e"));
+
+    EXPECT_EQ(1, journal_lines());
+}
+
+TEST_F(Test_ReplicationQueue, gap_drops_objects)
+{
+    {
+        Queue queue{TEST_JOURNAL, 8};
+        bool malformed{false};
+        queue.Open(malformed);
+        queue.Push(object("a"));
+        queue.SetGap();
+
+        EXPECT_TRUE(queue.Gap());
+
+        // Objects written during a gap are covered by the synchronization
+        // which closes it, so only roots and bucket operations are queued
+        queue.Push(object("b"));
+        queue.Push(object("c"));
+        queue.Push(root("root"));
+
+        EXPECT_EQ(2, queue.Dropped());
+        EXPECT_EQ(2, queue.Size());
+        EXPECT_EQ(3, journal_lines());
+
+        // The journal is trimmed as usual and keeps the gap
+        queue.Pop();
+        queue.Pop();
+
+        EXPECT_EQ(0, queue.Size());
+        EXPECT_EQ(1, journal_lines());
+    }
+
+    Queue queue{TEST_JOURNAL, 8};
+    bool malformed{true};
+
+    EXPECT_EQ(0, queue.Open(malformed));
+    EXPECT_FALSE(malformed);
+    EXPECT_TRUE(queue.Gap());
+
+    queue.Push(object("d"));
+
+    EXPECT_EQ(0, queue.Size());
+}
+
+TEST_F(Test_ReplicationQueue, close_gap)
+{
+    Queue queue{TEST_JOURNAL, 8};
+    bool malformed{false};
+    queue.Open(malformed);
+    queue.SetGap();
+    queue.Push(object("a"));
+    queue.Push(root("first"));
+    queue.Push(object("b"));
+    queue.Push(root("second"));
+    Replication item{};
+
+    ASSERT_TRUE(queue.Next(item));
+    EXPECT_EQ("first", item.key_);
+    EXPECT_EQ(1, item.dropped_);
+    EXPECT_TRUE(queue.LaterRoot());
+
+    // An object was dropped after the first root was queued, so a backup
+    // synchronized to it would still be missing that object
+    EXPECT_FALSE(queue.CloseGap(item.dropped_));
+    EXPECT_TRUE(queue.Gap());
+
+    queue.Pop();
+
+    ASSERT_TRUE(queue.Next(item));
+    EXPECT_EQ("second", item.key_);
+    EXPECT_FALSE(queue.LaterRoot());
+    EXPECT_TRUE(queue.CloseGap(item.dropped_));
+    EXPECT_FALSE(queue.Gap());
+
+    // The gap entry is removed from the journal
+    EXPECT_EQ(1, journal_lines());
+
+    queue.Pop();
+    queue.Push(object("c"));
+
+    EXPECT_EQ(1, queue.Size());
+}
+
+TEST_F(Test_ReplicationQueue, max_pending)
+{
+    Queue queue{TEST_JOURNAL, 2};
+    bool malformed{false};
+    queue.Open(malformed);
+    queue.Push(object("a"));
+    queue.Push(object("b"));
+    std::atomic<bool> pushed{false};
+    std::thread writer([&]() -> void {
+        queue.Push(object("c"));
+        pushed.store(true);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // A full queue holds the writer back until an entry is applied
+    EXPECT_FALSE(pushed.load());
+    EXPECT_EQ(2, queue.Size());
+
+    queue.Pop();
+    writer.join();
+
+    EXPECT_TRUE(pushed.load());
+    EXPECT_EQ(2, queue.Size());
+
+    Replication item{};
+
+    ASSERT_TRUE(queue.Next(item));
+    EXPECT_EQ("b", item.key_);
+}
+
+TEST_F(Test_ReplicationQueue, shutdown_releases_writer)
+{
+    Queue queue{TEST_JOURNAL, 1};
+    bool malformed{false};
+    queue.Open(malformed);
+    queue.Push(object("a"));
+    std::thread writer([&]() -> void { queue.Push(object("b")); });
+    queue.Shutdown();
+    writer.join();
+    Replication item{};
+
+    EXPECT_FALSE(queue.Next(item));
+}
+}  // namespace
@@ -0,0 +1,242 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+
+#include "Internal.hpp"
+#include "storage/Plugin.hpp"
+#include "storage/StorageConfig.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+
+// Plugin::FILTER_MINIMUM_CAPACITY
+#define TEST_FILTER_CAPACITY 65536
+
+using namespace opentxs;
+
+namespace
+{
+/** Keeps both buckets in memory and counts the reads which reach them */
+class FilteredDriver final : public opentxs::Plugin
+{
+public:
+    mutable std::array<std::map<std::string, std::string>, 2> buckets_{};
+    mutable std::size_t reads_{0};
+    mutable bool fail_empty_{false};
+
+    bool EmptyBucket(const bool bucket) const final
+    {
+        if (fail_empty_) { return false; }
+
+        buckets_.at(bucket ? 1 : 0).clear();
+        reset_filter(bucket);
+
+        return true;
+    }
+    bool LoadFromBucket(
+        const std::string& key,
+        std::string& value,
+        const bool bucket) const final
+    {
+        ++reads_;
+        const auto& map = buckets_.at(bucket ? 1 : 0);
+        const auto it = map.find(key);
+
+        if (map.end() == it) { return false; }
+
+        value = it->second;
+
+        return true;
+    }
+    std::string LoadRoot() const final { return {}; }
+    bool StoreRoot(const bool, const std::string&) const final { return true; }
+
+    void Cleanup() final {}
+    void Init() { init_filter(); }
+
+    FilteredDriver(
+        const api::storage::Storage& storage,
+        const StorageConfig& config,
+        const Digest& hash,
+        const Random& random,
+        const Flag& bucket)
+        : ot_super(storage, config, hash, random, bucket)
+    {
+    }
+
+    ~FilteredDriver() = default;
+
+private:
+    using ot_super = opentxs::Plugin;
+
+    bool list_bucket(const bool bucket, const KeyCallback& cb) const final
+    {
+        for (const auto& it : buckets_.at(bucket ? 1 : 0)) { cb(it.first); }
+
+        return true;
+    }
+    void store(
+        const bool,
+        const std::string& key,
+        const std::string& value,
+        const bool bucket,
+        std::promise<bool>* promise) const final
+    {
+        buckets_.at(bucket ? 1 : 0)[key] = value;
+        promise->set_value(true);
+    }
+};
+
+class Test_StorageFilter : public ::testing::Test
+{
+public:
+    const opentxs::api::client::Manager& client_;
+    const StorageConfig config_;
+    const Digest digest_;
+    const Random random_;
+    const OTFlag bucket_;
+
+    Test_StorageFilter()
+        : client_(opentxs::OT::App().StartClient({}, 0))
+        , config_()
+        , digest_([](const std::uint32_t,
+                     const std::string& value,
+                     std::string& key) -> bool {
+            key = value;
+
+            return true;
+        })
+        , random_([]() -> std::string { return "random"; })
+        , bucket_(Flag::Factory(false))
+    {
+    }
+
+    std::unique_ptr<FilteredDriver> driver() const
+    {
+        std::unique_ptr<FilteredDriver> output{new FilteredDriver(
+            client_.Storage(), config_, digest_, random_, bucket_)};
+        output->Init();
+
+        return output;
+    }
+
+    /** True if every key is found, wherever the filter says to look */
+    bool found(const FilteredDriver& driver, const std::size_t count) const
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            std::string value{};
+
+            if (false == driver.Load(key(i), true, value)) { return false; }
+
+            if (key(i) != value) { return false; }
+        }
+
+        return true;
+    }
+
+    static std::string key(const std::size_t i)
+    {
+        return "key" + std::to_string(i);
+    }
+
+    static void store(
+        const FilteredDriver& driver,
+        const std::size_t count,
+        const bool bucket)
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            driver.Store(false, key(i), key(i), bucket);
+        }
+    }
+};
+
+TEST_F(Test_StorageFilter, no_false_negatives_after_store)
+{
+    const auto plugin = driver();
+    store(*plugin, 1000, false);
+    store(*plugin, 10, true);
+
+    EXPECT_TRUE(found(*plugin, 1000));
+
+    // Both filters rule the key out, so neither bucket is read
+    plugin->reads_ = 0;
+    std::string value{};
+
+    EXPECT_FALSE(plugin->Load("absent", true, value));
+    EXPECT_EQ(0, plugin->reads_);
+}
+
+TEST_F(Test_StorageFilter, no_false_negatives_after_restart)
+{
+    const auto before = driver();
+    store(*before, 1000, false);
+    store(*before, 500, true);
+
+    // A new instance builds its filters from the keys the driver lists
+    std::unique_ptr<FilteredDriver> after{new FilteredDriver(
+        client_.Storage(), config_, digest_, random_, bucket_)};
+    after->buckets_ = before->buckets_;
+    after->Init();
+
+    EXPECT_TRUE(found(*after, 1000));
+
+    after->reads_ = 0;
+    std::string value{};
+
+    EXPECT_FALSE(after->Load("absent", true, value));
+    EXPECT_EQ(0, after->reads_);
+}
+
+TEST_F(Test_StorageFilter, no_false_negatives_after_empty)
+{
+    const auto plugin = driver();
+    store(*plugin, 1000, true);
+
+    // A failed garbage collection keeps the keys which are still stored
+    plugin->fail_empty_ = true;
+
+    EXPECT_FALSE(plugin->EmptyBucket(true));
+    EXPECT_TRUE(found(*plugin, 1000));
+
+    plugin->fail_empty_ = false;
+
+    ASSERT_TRUE(plugin->EmptyBucket(true));
+
+    std::string value{};
+
+    EXPECT_FALSE(plugin->Load(key(0), true, value));
+
+    // Keys stored after the bucket was emptied are found again
+    store(*plugin, 100, true);
+
+    EXPECT_TRUE(found(*plugin, 100));
+}
+
+TEST_F(Test_StorageFilter, no_false_negatives_over_capacity)
+{
+    const auto plugin = driver();
+    store(*plugin, 100, false);
+    plugin->reads_ = 0;
+    std::string value{};
+
+    EXPECT_FALSE(plugin->Load("absent", true, value));
+    EXPECT_EQ(0, plugin->reads_);
+
+    // A full filter answers "maybe", so lookups fall back to the driver
+    const std::size_t count{TEST_FILTER_CAPACITY + 1};
+    store(*plugin, count, false);
+
+    EXPECT_FALSE(plugin->Load("absent", true, value));
+    EXPECT_LT(0, plugin->reads_);
+    EXPECT_TRUE(found(*plugin, count));
+}
+}  // namespace
@@ -0,0 +1,238 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+
+#include "Internal.hpp"
+#include "storage/tree/Node.hpp"
+#include "storage/Plugin.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <future>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#define TEST_NODE_VERSION 2
+
+using namespace opentxs;
+
+namespace
+{
+class MemoryDriver final : public api::storage::Driver
+{
+public:
+    mutable std::map<std::string, std::string> objects_{};
+    mutable std::size_t stored_{0};
+
+    bool EmptyBucket(const bool) const final { return true; }
+    bool Load(const std::string& key, const bool, std::string& value)
+        const final
+    {
+        const auto it = objects_.find(key);
+
+        if (objects_.end() == it) { return false; }
+
+        value = it->second;
+
+        return true;
+    }
+    bool LoadFromBucket(
+        const std::string& key,
+        std::string& value,
+        const bool) const final
+    {
+        return Load(key, false, value);
+    }
+    bool Store(
+        const bool,
+        const std::string& key,
+        const std::string& value,
+        const bool) const final
+    {
+        objects_[key] = value;
+
+        return true;
+    }
+    void Store(
+        const bool isTransaction,
+        const std::string& key,
+        const std::string& value,
+        const bool bucket,
+        std::promise<bool>& promise) const final
+    {
+        promise.set_value(Store(isTransaction, key, value, bucket));
+    }
+    bool Store(const bool, const std::string& value, std::string& key)
+        const final
+    {
+        const auto number = std::to_string(++stored_);
+        key = "hash" + std::string(28 - number.size(), '0') + number;
+        objects_[key] = value;
+
+        return true;
+    }
+    bool Migrate(const std::string&, const Driver&) const final { return true; }
+    std::string LoadRoot() const final { return {}; }
+    bool StoreRoot(const bool, const std::string&) const final { return true; }
+};
+
+class TestNode final : public storage::Node
+{
+public:
+    static std::size_t Capacity() { return PAGE_CAPACITY; }
+
+    bool Add(const std::string& id) { return store_raw(id, id, ""); }
+    bool Complete() const { return false == pages_missing_; }
+    std::size_t Depth() const { return page_depth_; }
+    std::map<std::string, std::string> Pages() const { return page_hash_; }
+    bool Remove(const std::string& id) { return delete_item(id); }
+    std::uint32_t StoredVersion() const
+    {
+        std::shared_ptr<proto::StorageUnits> serialized{nullptr};
+        driver_.LoadProto(root_, serialized);
+
+        return serialized->version();
+    }
+
+    TestNode(const api::storage::Driver& driver, const std::string& hash)
+        : Node(driver, hash)
+    {
+        if (check_hash(hash)) {
+            init(hash);
+        } else {
+            version_ = TEST_NODE_VERSION;
+            root_ = Node::BLANK_HASH;
+        }
+    }
+
+private:
+    void init(const std::string& hash) final
+    {
+        std::shared_ptr<proto::StorageUnits> serialized{nullptr};
+        driver_.LoadProto(hash, serialized);
+        version_ = serialized->version();
+        load_items<proto::StorageUnits>(
+            *serialized,
+            [](const proto::StorageUnits& list) -> const storage::ItemList& {
+                return list.unit();
+            });
+    }
+    bool save(const Lock& lock) const final
+    {
+        proto::StorageUnits serialized{};
+        serialized.set_version(version_);
+
+        // The same path the storage tree nodes save through, which validates
+        // the index proto against the current opentxs-proto version tables
+        return save_items<proto::StorageUnits>(
+            lock,
+            serialized,
+            [](proto::StorageUnits& list) -> proto::StorageItemHash* {
+                return list.add_unit();
+            });
+    }
+};
+
+// Spreads the ids over the key space the way real identifiers are
+std::string item_id(const std::size_t index)
+{
+    const std::uint64_t mixed = (index + 1) * 0x9E3779B97F4A7C15ULL;
+    std::stringstream output{};
+    output << "ot" << std::hex << std::setfill('0') << std::setw(16) << mixed
+           << std::setw(16) << index;
+
+    return output.str();
+}
+
+void fill(TestNode& node, const std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i) {
+        ASSERT_TRUE(node.Add(item_id(i)));
+    }
+}
+
+TEST(StorageNode, split_merge_reload)
+{
+    MemoryDriver driver{};
+    TestNode node{driver, ""};
+    const auto capacity = TestNode::Capacity();
+    fill(node, capacity);
+
+    EXPECT_EQ(0, node.Depth());
+    EXPECT_EQ(TEST_NODE_VERSION, node.StoredVersion());
+
+    // One item more than fits in the index splits it into pages
+    ASSERT_TRUE(node.Add(item_id(capacity)));
+    EXPECT_LT(0, node.Depth());
+    EXPECT_FALSE(node.Pages().empty());
+    // Paging does not require a new version of the index proto
+    EXPECT_EQ(TEST_NODE_VERSION, node.StoredVersion());
+
+    {
+        TestNode reloaded{driver, node.Root()};
+
+        EXPECT_TRUE(reloaded.Complete());
+        EXPECT_EQ(capacity + 1, reloaded.List().size());
+        EXPECT_EQ(node.List(), reloaded.List());
+        EXPECT_EQ(node.Depth(), reloaded.Depth());
+        EXPECT_EQ(node.Pages(), reloaded.Pages());
+    }
+
+    // A change rewrites the item, its leaf page, the inner pages above that
+    // leaf and the index, but none of the other pages
+    const auto before = driver.stored_;
+
+    ASSERT_TRUE(node.Add(item_id(capacity + 1)));
+    EXPECT_GT(node.Pages().size(), driver.stored_ - before);
+
+    {
+        TestNode reloaded{driver, node.Root()};
+
+        EXPECT_EQ(node.List(), reloaded.List());
+    }
+
+    // Removing items until they fit again merges the pages into the index
+    ASSERT_TRUE(node.Remove(item_id(0)));
+    ASSERT_TRUE(node.Remove(item_id(1)));
+    EXPECT_EQ(0, node.Depth());
+    EXPECT_TRUE(node.Pages().empty());
+
+    {
+        TestNode reloaded{driver, node.Root()};
+
+        EXPECT_TRUE(reloaded.Complete());
+        EXPECT_EQ(capacity, reloaded.List().size());
+        EXPECT_EQ(node.List(), reloaded.List());
+        EXPECT_EQ(0, reloaded.Depth());
+    }
+}
+
+TEST(StorageNode, missing_page)
+{
+    MemoryDriver driver{};
+    TestNode node{driver, ""};
+    const auto capacity = TestNode::Capacity();
+    fill(node, capacity + 1);
+
+    ASSERT_FALSE(node.Pages().empty());
+
+    driver.objects_.erase(node.Pages().begin()->second);
+    TestNode reloaded{driver, node.Root()};
+
+    EXPECT_FALSE(reloaded.Complete());
+    EXPECT_GT(capacity + 1, reloaded.List().size());
+
+    // The incomplete index must never replace the stored one
+    const auto root = reloaded.Root();
+
+    EXPECT_FALSE(reloaded.Add(item_id(capacity + 1)));
+    EXPECT_EQ(root, reloaded.Root());
+}
+}  // namespace
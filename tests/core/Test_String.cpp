@@ -0,0 +1,143 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+#include "opentxs/core/util/Tag.hpp"
+
+#include "Internal.hpp"
+#include "core/InternalCore.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <string>
+#include <string_view>
+
+using namespace opentxs;
+
+namespace
+{
+TEST(String, concatenate)
+{
+    String value;
+    std::string expected{};
+
+    for (int i = 0; i < 5000; ++i) {
+        const auto piece = std::to_string(i) + ",";
+        value.Concatenate(piece);
+        expected += piece;
+
+        if (0 == (i % 1000)) {
+            value.Concatenate(value);
+            expected += expected;
+        }
+    }
+
+    value.Concatenate("%s-%d", "end", 1);
+    expected += "end-1";
+
+    EXPECT_STREQ(expected.c_str(), value.Get());
+    EXPECT_EQ(expected.size(), value.GetLength());
+}
+
+TEST(String, reserve)
+{
+    String value;
+    value.Reserve(1024);
+
+    EXPECT_FALSE(value.Exists());
+    EXPECT_EQ(0, value.GetLength());
+
+    value.Concatenate(String("abc"));
+    value.Reserve(2048);
+    value.Concatenate(std::string("def"));
+
+    EXPECT_STREQ("abcdef", value.Get());
+
+    String copy(value);
+
+    EXPECT_TRUE(copy == value);
+
+    value.Release();
+
+    EXPECT_FALSE(value.Exists());
+}
+
+TEST(String, tag_output)
+{
+    Tag tag("outer");
+    tag.add_attribute("a", "1");
+    tag.add_attribute("b", "two");
+    tag.add_tag("inner", "text");
+    TagPtr empty = std::make_shared<Tag>("empty");
+    empty->add_attribute("c", "3");
+    tag.add_tag(empty);
+
+    std::string serialized{};
+    tag.output(serialized);
+
+    EXPECT_EQ(
+        "<outer\n a=\"1\"\n b=\"two\">\n<inner>\ntext\n</inner>\n"
+        "<empty\n c=\"3\" />\n\n</outer>\n",
+        serialized);
+    EXPECT_EQ(serialized.size(), tag.size_hint());
+
+    String output("prefix ");
+    tag.output(output);
+
+    EXPECT_EQ("prefix " + serialized, std::string(output.Get()));
+}
+
+// Contract::ParseRawFile relies on next_line splitting text exactly as sgets
+TEST(String, next_line_matches_sgets)
+{
+    std::mt19937 random{47};
+    std::uniform_int_distribution<int> choice(0, 99);
+    std::uniform_int_distribution<int> letter('!', '~');
+    std::uniform_int_distribution<std::size_t> run(2040, 4200);
+
+    for (int i = 0; i < 500; ++i) {
+        std::string text{};
+        const auto length = choice(random) * 40;
+
+        while (text.size() < static_cast<std::size_t>(length)) {
+            const auto pick = choice(random);
+
+            if (10 > pick) {
+                text += '\n';
+            } else if (12 > pick) {
+                text += "\n\n";
+            } else if (13 > pick) {
+                // Lines at and beyond the sgets buffer size
+                text += std::string(run(random), 'x');
+            } else {
+                text += static_cast<char>(letter(random));
+            }
+        }
+
+        String value(text);
+        value.reset();
+        const std::string_view view(value.Get(), value.GetLength());
+        std::size_t position{0};
+        std::string_view line{};
+        char buffer[2100];
+        bool more{true};
+
+        while (more) {
+            std::memset(buffer, 0, sizeof(buffer));
+            more = value.sgets(buffer, 2048);
+            const auto next = internal::next_line(view, position, line);
+
+            ASSERT_EQ(more, next);
+            ASSERT_EQ(std::string(buffer), std::string(line));
+        }
+
+        // Both stay at the end once it has been reached
+        EXPECT_FALSE(internal::next_line(view, position, line));
+        EXPECT_TRUE(line.empty());
+    }
+}
+}  // namespace
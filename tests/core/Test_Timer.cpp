@@ -0,0 +1,187 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+
+#include "Internal.hpp"
+#include "internal/api/Internal.hpp"
+#include "Factory.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// Upper bound for events which should happen within milliseconds. Only
+// reached when a test fails, so it can be generous enough for loaded machines.
+#define TIMER_TEST_DEADLINE_SECONDS 30
+
+using namespace opentxs;
+
+namespace
+{
+class Counter
+{
+public:
+    int Get() const
+    {
+        Lock lock(lock_);
+
+        return value_;
+    }
+
+    void Increment()
+    {
+        Lock lock(lock_);
+        ++value_;
+        lock.unlock();
+        changed_.notify_all();
+    }
+
+    // Returns false if the count did not reach target before the deadline
+    bool WaitFor(const int target) const
+    {
+        Lock lock(lock_);
+
+        return changed_.wait_for(
+            lock, std::chrono::seconds(TIMER_TEST_DEADLINE_SECONDS), [&]() {
+                return target <= value_;
+            });
+    }
+
+private:
+    mutable std::mutex lock_{};
+    mutable std::condition_variable changed_{};
+    int value_{0};
+};
+
+TEST(Timer, one_shot_and_periodic)
+{
+    const std::unique_ptr<api::internal::Timer> timer{Factory::Timer()};
+    Counter once{};
+    Counter periodic{};
+    timer->Schedule(
+        std::chrono::milliseconds(20),
+        std::chrono::milliseconds(0),
+        [&]() -> void { once.Increment(); });
+    const auto id = timer->Schedule(
+        std::chrono::milliseconds(0),
+        std::chrono::milliseconds(20),
+        [&]() -> void { periodic.Increment(); });
+
+    ASSERT_TRUE(once.WaitFor(1));
+    ASSERT_TRUE(periodic.WaitFor(5));
+
+    // Cancel waits for a run in progress, so the count is final afterwards
+    timer->Cancel(id);
+    const int count = periodic.Get();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    EXPECT_EQ(1, once.Get());
+    EXPECT_EQ(count, periodic.Get());
+}
+
+TEST(Timer, cascade_and_reschedule)
+{
+    const std::unique_ptr<api::internal::Timer> timer{Factory::Timer()};
+    Counter outer{};
+    Counter moved{};
+    const auto start = std::chrono::steady_clock::now();
+    // Longer than one revolution of the innermost wheel
+    timer->Schedule(
+        std::chrono::milliseconds(2700),
+        std::chrono::milliseconds(0),
+        [&]() -> void { outer.Increment(); });
+    const auto id = timer->Schedule(
+        std::chrono::hours(1),
+        std::chrono::milliseconds(0),
+        [&]() -> void { moved.Increment(); });
+
+    ASSERT_TRUE(timer->Reschedule(id, std::chrono::milliseconds(50)));
+    ASSERT_TRUE(moved.WaitFor(1));
+    ASSERT_TRUE(outer.WaitFor(1));
+
+    // Deadlines are counted in whole 10 ms ticks, so a timer may fire up to
+    // one tick early but never more, however late it may be
+    EXPECT_LE(
+        std::chrono::milliseconds(2690),
+        std::chrono::steady_clock::now() - start);
+    EXPECT_EQ(1, moved.Get());
+    EXPECT_FALSE(timer->Reschedule(id, std::chrono::milliseconds(50)));
+}
+
+TEST(Timer, long_tasks_do_not_delay_short_ones)
+{
+    const std::unique_ptr<api::internal::Timer> timer{Factory::Timer()};
+    const auto busy = std::thread::hardware_concurrency() + 2;
+    std::mutex lock{};
+    std::condition_variable released{};
+    bool release{false};
+    Counter started{};
+    Counter finished{};
+    Counter quick{};
+
+    // Enough long tasks to occupy every worker if there were only one pool
+    for (unsigned int i = 0; i < busy; ++i) {
+        timer->ScheduleLong(
+            std::chrono::milliseconds(0),
+            std::chrono::milliseconds(0),
+            [&]() -> void {
+                started.Increment();
+                Lock wait(lock);
+                released.wait(wait, [&]() -> bool { return release; });
+                wait.unlock();
+                finished.Increment();
+            });
+    }
+
+    ASSERT_TRUE(started.WaitFor(1));
+
+    timer->Schedule(
+        std::chrono::milliseconds(0),
+        std::chrono::milliseconds(0),
+        [&]() -> void { quick.Increment(); });
+
+    EXPECT_TRUE(quick.WaitFor(1));
+
+    Lock wait(lock);
+    release = true;
+    wait.unlock();
+    released.notify_all();
+
+    EXPECT_TRUE(finished.WaitFor(static_cast<int>(busy)));
+}
+
+TEST(Timer, cancel_from_task)
+{
+    const std::unique_ptr<api::internal::Timer> timer{Factory::Timer()};
+    Counter runs{};
+    Counter cancelled{};
+    api::internal::Timer::TimerID id{0};
+    std::mutex lock{};
+    Lock hold(lock);
+
+    // A task which cancels itself returns without waiting for its own run
+    id = timer->Schedule(
+        std::chrono::milliseconds(0),
+        std::chrono::milliseconds(10),
+        [&]() -> void {
+            Lock wait(lock);
+            runs.Increment();
+            timer->Cancel(id);
+            cancelled.Increment();
+        });
+    hold.unlock();
+
+    ASSERT_TRUE(cancelled.WaitFor(1));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    EXPECT_EQ(1, runs.Get());
+}
+}  // namespace
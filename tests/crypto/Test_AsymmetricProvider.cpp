@@ -4,9 +4,17 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include "opentxs/opentxs.hpp"
+#include "opentxs/core/crypto/LowLevelKeyGenerator.hpp"
+
+#include "Internal.hpp"
+#include "crypto/key/Asymmetric.hpp"
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <string>
+#include <thread>
+
 using namespace opentxs;
 
 namespace
@@ -130,6 +138,35 @@ public:
 
         return haveSig || verified;
     }
+
+    bool batch_signature(
+        const crypto::AsymmetricProvider& lib,
+        const crypto::key::Asymmetric& key,
+        const proto::HashType hash,
+        const std::size_t count,
+        const bool corrupt)
+    {
+        std::vector<OTData> plaintexts{};
+        std::vector<OTData> signatures{};
+        plaintexts.reserve(count);
+        signatures.reserve(count);
+        crypto::AsymmetricProvider::SignatureBatch batch{};
+
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto text = plaintext_string_1_ + std::to_string(i);
+            auto& plaintext = plaintexts.emplace_back(
+                Data::Factory(text.data(), text.size()));
+            auto& sig = signatures.emplace_back(Data::Factory());
+
+            if (false == lib.Sign(plaintext, key, hash, sig)) { return false; }
+
+            batch.emplace_back(plaintext.get(), key, sig.get(), hash);
+        }
+
+        if (corrupt) { signatures.back()->Assign(plaintexts.back()); }
+
+        return lib.VerifyBatch(batch);
+    }
 };
 
 #if OT_CRYPTO_SUPPORTED_KEY_ED25519
@@ -155,6 +192,17 @@ TEST_F(Test_Signatures, Ed25519_HD_Signatures)
         false,
         test_signature(plaintext_1, ed25519_, ed25519_hd_, hash_ripemd160_));
 }
+
+TEST_F(Test_Signatures, Ed25519_Batch_Signatures)
+{
+    EXPECT_EQ(true, ed25519_.VerifyBatch({}));
+    EXPECT_EQ(
+        true,
+        batch_signature(ed25519_, ed25519_hd_, hash_blake256_, 100, false));
+    EXPECT_EQ(
+        false,
+        batch_signature(ed25519_, ed25519_hd_, hash_blake256_, 100, true));
+}
 #endif  // OT_CRYPTO_SUPPORTED_KEY_ED25519
 
 #if OT_CRYPTO_SUPPORTED_KEY_SECP256K1
@@ -183,6 +231,149 @@ TEST_F(Test_Signatures, Secp256k1_HD_Signatures)
 }
 #endif  // OT_CRYPTO_SUPPORTED_KEY_ED25519
 
+#if OT_CRYPTO_SUPPORTED_KEY_RSA
+TEST_F(Test_Signatures, RSA_Batch_Signatures)
+{
+    const auto nym = client_.Wallet().Nym(NymParameters(1024));
+
+    ASSERT_TRUE(nym);
+
+    const auto& key = nym->GetPrivateSignKey(proto::AKEYTYPE_LEGACY);
+    const auto& rsa = client_.Crypto().RSA();
+
+    // Every signature in the batch shares one key, whose OpenSSL state must
+    // not be touched from more than one thread
+    EXPECT_EQ(true, batch_signature(rsa, key, hash_sha256_, 64, false));
+    EXPECT_EQ(false, batch_signature(rsa, key, hash_sha256_, 64, true));
+}
+#endif  // OT_CRYPTO_SUPPORTED_KEY_RSA
+
+#if OT_CRYPTO_SUPPORTED_KEY_SECP256K1
+TEST_F(Test_Signatures, Private_Cache_Expires)
+{
+    using Key = crypto::key::implementation::Asymmetric;
+    const auto* key = dynamic_cast<const Key*>(&secp256k1_hd_.get());
+
+    ASSERT_NE(nullptr, key);
+
+    const std::string value{"decrypted private key"};
+    OTPassword secret{};
+    secret.setMemory(value.data(), value.size());
+    OTPassword cached{};
+    const auto start = Key::CacheClock::now();
+    key->CachePrivate(secp256k1_, secret, start);
+
+    ASSERT_TRUE(key->CachedPrivate(
+        secp256k1_, cached, start + std::chrono::seconds(OT_KEY_TIMER - 1)));
+    EXPECT_TRUE(cached.Compare(secret));
+    EXPECT_FALSE(key->CachedPrivate(ed25519_, cached, start));
+    EXPECT_FALSE(key->CachedPrivate(
+        secp256k1_, cached, start + std::chrono::seconds(OT_KEY_TIMER)));
+
+    // An expired entry is wiped, not merely hidden from later lookups
+    EXPECT_FALSE(key->CachedPrivate(secp256k1_, cached, start));
+
+    // Signing through the provider still works once the entry is gone
+    EXPECT_EQ(
+        true,
+        test_signature(plaintext_1, secp256k1_, secp256k1_hd_, hash_sha256_));
+}
+
+TEST_F(Test_Signatures, Private_Cache_Purged_Without_Access)
+{
+    using Key = crypto::key::implementation::Asymmetric;
+    const auto* key = dynamic_cast<const Key*>(&secp256k1_hd_.get());
+
+    ASSERT_NE(nullptr, key);
+
+    const std::string value{"decrypted private key"};
+    OTPassword secret{};
+    secret.setMemory(value.data(), value.size());
+    OTPassword cached{};
+    // Cached long enough ago that the entry expires shortly
+    const auto start = Key::CacheClock::now() -
+                       std::chrono::seconds(OT_KEY_TIMER) +
+                       std::chrono::milliseconds(200);
+    key->CachePrivate(secp256k1_, secret, start);
+    // A lookup as of the time the entry was cached never purges it, so it
+    // only reports whether the entry is still held
+    const auto held = [&]() -> bool {
+        return key->CachedPrivate(secp256k1_, cached, start);
+    };
+
+    ASSERT_TRUE(held());
+
+    const auto deadline =
+        Key::CacheClock::now() + std::chrono::seconds(OT_KEY_TIMER);
+
+    while (held() && (Key::CacheClock::now() < deadline)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    EXPECT_FALSE(held());
+}
+
+TEST_F(Test_Signatures, Cache_Cleared_By_SetKey)
+{
+    using Key = crypto::key::implementation::Asymmetric;
+    auto& curve =
+        dynamic_cast<crypto::key::EllipticCurve&>(secp256k1_hd_.get());
+    const auto* key = dynamic_cast<const Key*>(&curve);
+
+    ASSERT_NE(nullptr, key);
+    ASSERT_EQ(
+        true,
+        test_signature(plaintext_1, secp256k1_, secp256k1_hd_, hash_sha256_));
+
+    // Signing and verifying populated both halves of the cache
+    OTPassword cached{};
+    auto parsed = Data::Factory();
+
+    EXPECT_TRUE(key->CachedPrivate(secp256k1_, cached));
+    EXPECT_TRUE(key->CachedPublic(secp256k1_, parsed));
+
+    auto publicKey = Data::Factory();
+
+    ASSERT_TRUE(curve.GetPublicKey(publicKey));
+    ASSERT_TRUE(curve.SetKey(publicKey));
+    EXPECT_FALSE(key->CachedPrivate(secp256k1_, cached));
+    EXPECT_FALSE(key->CachedPublic(secp256k1_, parsed));
+}
+
+TEST_F(Test_Signatures, Cached_ID_Follows_Key)
+{
+    auto& curve =
+        dynamic_cast<crypto::key::EllipticCurve&>(secp256k1_hd_.get());
+    auto publicKey = Data::Factory();
+
+    ASSERT_TRUE(curve.GetPublicKey(publicKey));
+    ASSERT_TRUE(curve.SetKey(publicKey));
+
+    auto first = Identifier::Factory();
+    auto second = Identifier::Factory();
+
+    ASSERT_TRUE(curve.CalculateID(first));
+    ASSERT_TRUE(curve.CalculateID(second));
+    EXPECT_EQ(first->str(), second->str());
+
+    // Changing the key must not return the id of the old one
+    std::string bytes(
+        static_cast<const char*>(publicKey->data()), publicKey->size());
+    bytes.back() ^= 0x01;
+    auto changed = Identifier::Factory();
+
+    ASSERT_TRUE(curve.SetKey(Data::Factory(bytes.data(), bytes.size())));
+    ASSERT_TRUE(curve.CalculateID(changed));
+    EXPECT_NE(first->str(), changed->str());
+
+    auto restored = Identifier::Factory();
+
+    ASSERT_TRUE(curve.SetKey(publicKey));
+    ASSERT_TRUE(curve.CalculateID(restored));
+    EXPECT_EQ(first->str(), restored->str());
+}
+#endif  // OT_CRYPTO_SUPPORTED_KEY_SECP256K1
+
 #if OT_CRYPTO_USING_LIBSECP256K1
 #if OT_CRYPTO_USING_TREZOR
 TEST_F(Test_Signatures, Crosscheck_Trezor_Secp256k1)
@@ -41,6 +41,7 @@
 #include "Internal.hpp"
 #include "opentxs/crypto/library/Bitcoin.hpp"
 #include "opentxs/crypto/library/Trezor.hpp"
+#include "internal/api/Internal.hpp"
 #include "Factory.hpp"
 
 #include <gtest/gtest.h>
@@ -55,7 +56,9 @@ public:
     const opentxs::api::client::Manager& client_;
     const api::Crypto& crypto_;
 #if OT_CRYPTO_USING_TREZOR
-    const std::unique_ptr<crypto::Trezor> trezor_{Factory::Trezor(crypto_)};
+    const std::unique_ptr<api::internal::Timer> timer_{Factory::Timer()};
+    const std::unique_ptr<crypto::Trezor> trezor_{
+        Factory::Trezor(crypto_, *timer_)};
 #endif
 #if OT_CRYPTO_USING_LIBBITCOIN
     const std::unique_ptr<crypto::Bitcoin> bitcoin_{Factory::Bitcoin(crypto_)};
@@ -90,6 +93,50 @@ TEST_F(Test_Bitcoin_Providers, Trezor)
 }
 #endif  // OT_CRYPTO_USING_TREZOR
 
+#if OT_CRYPTO_USING_TREZOR && OT_CRYPTO_WITH_BIP32
+TEST_F(Test_Bitcoin_Providers, Trezor_cached_derivation)
+{
+    const crypto::Bip32& cached = *trezor_;
+    OTPassword seed{};
+
+    ASSERT_EQ(64, seed.randomizeMemory(64));
+
+    const auto hardened = static_cast<std::uint32_t>(Bip32Child::HARDENED);
+    const auto derive = [&](const crypto::Bip32& library,
+                            const std::uint32_t account,
+                            const std::uint32_t index) -> std::string {
+        proto::HDPath path{};
+        path.add_child(44 | hardened);
+        path.add_child(0 | hardened);
+        path.add_child(account | hardened);
+        path.add_child(0);
+        path.add_child(index);
+        const auto key =
+            library.GetHDKey(EcdsaCurve::SECP256K1, seed, path);
+
+        if (false == bool(key)) { return {}; }
+
+        return key->SerializeAsString();
+    };
+
+    // Siblings share cached ancestors, and revisiting the first account after
+    // many others have been derived must still produce the keys an uncached
+    // derivation produces
+    for (const std::uint32_t account : {0, 1, 2, 3, 0}) {
+        for (std::uint32_t index = 0; index < 4; ++index) {
+            // A new provider has nothing cached, so it derives every
+            // ancestor from the seed
+            const std::unique_ptr<crypto::Trezor> uncached{
+                Factory::Trezor(crypto_, *timer_)};
+            const auto expected = derive(*uncached, account, index);
+
+            ASSERT_FALSE(expected.empty());
+            EXPECT_EQ(expected, derive(cached, account, index));
+        }
+    }
+}
+#endif  // OT_CRYPTO_USING_TREZOR && OT_CRYPTO_WITH_BIP32
+
 
 #if OT_CRYPTO_USING_LIBBITCOIN
 TEST_F(Test_Bitcoin_Providers, Libbitcoin)
@@ -4,11 +4,18 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include "opentxs/opentxs.hpp"
+#include "opentxs/core/cron/OTCron.hpp"
+#include "opentxs/core/trade/OTMarket.hpp"
 #include "server/Server.hpp"
 #include "server/Transactor.hpp"
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
 using namespace opentxs;
 
 #define CHEQUE_AMOUNT 144488
@@ -20,6 +27,7 @@ using namespace opentxs;
 #define NYMBOX_SAME false
 #define NO_TRANSACTION false
 #define SUCCESS true
+#define TEST_CRON_FILE "test-cron.crn"
 #define TRANSACTION true
 #define UNIT_DEFINITION_CONTRACT_NAME "Mt Gox USD"
 #define UNIT_DEFINITION_TERMS "YOLO"
@@ -61,6 +69,41 @@ public:
         if (false == init_) { init(); }
     }
 
+    // The market takes ownership of the offer if it is added
+    bool add_offer(
+        OTMarket& market,
+        const Nym& signer,
+        const bool selling,
+        const std::int64_t price,
+        const std::int64_t total,
+        const std::int64_t finished,
+        const TransactionNumber number)
+    {
+        auto offer = server_.Factory().Offer(
+            server_id_,
+            market.GetInstrumentDefinitionID(),
+            market.GetCurrencyID(),
+            market.GetScale());
+
+        if (false == bool(offer)) { return false; }
+
+        offer->MakeOffer(selling, price, total, market.GetScale(), number);
+        offer->IncrementFinishedSoFar(finished);
+
+        if (false == offer->SignContract(signer)) { return false; }
+        if (false == offer->SaveContract()) { return false; }
+
+        const auto now = OTTimeGetCurrentTime();
+
+        if (false == market.AddOffer(nullptr, *offer, false, now)) {
+            return false;
+        }
+
+        offer.release();
+
+        return true;
+    }
+
     void break_consensus()
     {
         TransactionNumber newNumber{0};
@@ -71,6 +114,16 @@ public:
         context.It().IssueNumber(newNumber);
     }
 
+    void erase_test_cron()
+    {
+        OTDB::EraseValueByKey(
+            server_.DataFolder(),
+            OTFolders::Cron().Get(),
+            TEST_CRON_FILE,
+            "",
+            "");
+    }
+
     void import_server_contract(
         const ServerContract& contract,
         const opentxs::api::client::Manager& client)
@@ -485,6 +538,26 @@ TEST_F(Test_Basic, getBoxReceipt_transaction_numbers)
     const auto& transaction = *transactionMap.begin()->second;
 
     EXPECT_FALSE(transaction.IsAbbreviated());
+
+    // The client announced that it parses runs, so the notary wrote its
+    // block of numbers as a single run
+    NumList numbers{};
+    transactionMap.begin()->second->GetNumList(numbers);
+
+    EXPECT_EQ(100, numbers.Count());
+
+    String raw{};
+
+    ASSERT_TRUE(transaction.SaveContractRaw(raw));
+
+    std::int64_t first{0};
+
+    ASSERT_TRUE(numbers.Peek(first));
+
+    const auto run = "totalListOfNumbers=\"" + std::to_string(first) + "-" +
+                     std::to_string(first + 99) + "\"";
+
+    EXPECT_NE(std::string::npos, std::string(raw.Get()).find(run));
 }
 
 TEST_F(Test_Basic, processNymbox)
@@ -1731,7 +1804,7 @@ TEST_F(Test_Basic, getAccountData_after_cheque_deposited)
     EXPECT_FALSE(inbox->LoadBoxReceipt(number));
 }
 
-TEST_F(Test_Basic, getBoxReceipt_cheque_receipt)
+TEST_F(Test_Basic, getBoxReceipts_known_receipts)
 {
     const auto accountID = find_issuer_account();
     const RequestNumber sequence{15};
@@ -1761,6 +1834,125 @@ TEST_F(Test_Basic, getBoxReceipt_cheque_receipt)
 
     ASSERT_NE(0, number);
 
+    // The known list names the receipt in the box along with one the box
+    // does not hold, which the server must ignore
+    const NumList known{std::set<std::int64_t>{number, number + 1000}};
+    verify_state_pre(*clientContext, serverContext.It(), sequence);
+    const auto [requestNumber, transactionNumber, reply] =
+        client_1_.OTAPI().getBoxReceipts(
+            serverContext.It(), accountID, INBOX_TYPE, known);
+    const auto& [result, message] = reply;
+    verify_state_post(
+        client_1_,
+        *clientContext,
+        serverContext.It(),
+        sequence,
+        requestNumber,
+        transactionNumber,
+        result,
+        message,
+        SUCCESS,
+        NYMBOX_UPDATED,
+        NO_TRANSACTION,
+        0);
+
+    EXPECT_FALSE(message->m_bBool);
+    EXPECT_FALSE(message->m_ascPayload.Exists());
+
+    const auto clientAccount = client_1_.Wallet().Account(accountID);
+    std::unique_ptr<Ledger> inbox{
+        clientAccount.get().LoadInbox(*serverContext.It().Nym())};
+
+    ASSERT_TRUE(inbox);
+
+    const auto& transaction = *inbox->GetTransactionMap().begin()->second;
+
+    EXPECT_TRUE(transaction.IsAbbreviated());
+    EXPECT_FALSE(inbox->LoadBoxReceipt(number));
+}
+
+TEST_F(Test_Basic, getBoxReceipts_cheque_receipt)
+{
+    const auto accountID = find_issuer_account();
+    const RequestNumber sequence{16};
+    auto serverContext =
+        client_1_.Wallet().mutable_ServerContext(alice_nym_id_, server_id_);
+    auto clientContext =
+        server_.Wallet().ClientContext(server_.NymID(), alice_nym_id_);
+
+    ASSERT_TRUE(clientContext);
+
+    verify_state_pre(*clientContext, serverContext.It(), sequence);
+    const auto [requestNumber, transactionNumber, reply] =
+        client_1_.OTAPI().getBoxReceipts(
+            serverContext.It(), accountID, INBOX_TYPE, NumList());
+    const auto& [result, message] = reply;
+    verify_state_post(
+        client_1_,
+        *clientContext,
+        serverContext.It(),
+        sequence,
+        requestNumber,
+        transactionNumber,
+        result,
+        message,
+        SUCCESS,
+        NYMBOX_UPDATED,
+        NO_TRANSACTION,
+        0);
+
+    EXPECT_FALSE(message->m_bBool);
+    EXPECT_TRUE(message->m_ascPayload.Exists());
+
+    // The receipt the client lacked was sent and saved
+    const auto clientAccount = client_1_.Wallet().Account(accountID);
+    std::unique_ptr<Ledger> inbox{
+        clientAccount.get().LoadInbox(*serverContext.It().Nym())};
+
+    ASSERT_TRUE(inbox);
+
+    const auto& transactionMap = inbox->GetTransactionMap();
+
+    ASSERT_EQ(1, transactionMap.size());
+
+    const TransactionNumber number{transactionMap.begin()->first};
+    const auto& transaction = *transactionMap.begin()->second;
+
+    EXPECT_FALSE(transaction.IsAbbreviated());
+    EXPECT_EQ(transactionType::chequeReceipt, transaction.GetType());
+    EXPECT_TRUE(inbox->LoadBoxReceipt(number));
+}
+
+TEST_F(Test_Basic, getBoxReceipt_cheque_receipt)
+{
+    const auto accountID = find_issuer_account();
+    const RequestNumber sequence{17};
+    auto serverContext =
+        client_1_.Wallet().mutable_ServerContext(alice_nym_id_, server_id_);
+    auto clientContext =
+        server_.Wallet().ClientContext(server_.NymID(), alice_nym_id_);
+
+    ASSERT_TRUE(clientContext);
+
+    TransactionNumber number{0};
+
+    {
+        const auto clientAccount = client_1_.Wallet().Account(accountID);
+
+        std::unique_ptr<Ledger> inbox{
+            clientAccount.get().LoadInbox(*serverContext.It().Nym())};
+
+        ASSERT_TRUE(inbox);
+
+        const auto& transactionMap = inbox->GetTransactionMap();
+
+        ASSERT_EQ(1, transactionMap.size());
+
+        number = {transactionMap.begin()->first};
+    }
+
+    ASSERT_NE(0, number);
+
     verify_state_pre(*clientContext, serverContext.It(), sequence);
     const auto [requestNumber, transactionNumber, reply] =
         client_1_.OTAPI().getBoxReceipt(
@@ -1796,7 +1988,7 @@ TEST_F(Test_Basic, getBoxReceipt_cheque_receipt)
 
 TEST_F(Test_Basic, getNymbox_after_cheque_deposited)
 {
-    const RequestNumber sequence{16};
+    const RequestNumber sequence{18};
     auto serverContext =
         client_1_.Wallet().mutable_ServerContext(alice_nym_id_, server_id_);
     auto clientContext =
@@ -1825,7 +2017,7 @@ TEST_F(Test_Basic, getNymbox_after_cheque_deposited)
 
 TEST_F(Test_Basic, processInbox)
 {
-    const RequestNumber sequence{17};
+    const RequestNumber sequence{19};
     auto serverContext =
         client_1_.Wallet().mutable_ServerContext(alice_nym_id_, server_id_);
     auto clientContext =
@@ -1901,7 +2093,7 @@ TEST_F(Test_Basic, processInbox)
 
 TEST_F(Test_Basic, getNymbox_after_processInbox)
 {
-    const RequestNumber sequence{18};
+    const RequestNumber sequence{20};
     auto serverContext =
         client_1_.Wallet().mutable_ServerContext(alice_nym_id_, server_id_);
     auto clientContext =
@@ -1931,7 +2123,7 @@ TEST_F(Test_Basic, getNymbox_after_processInbox)
 TEST_F(Test_Basic, resync)
 {
     break_consensus();
-    const RequestNumber sequence{19};
+    const RequestNumber sequence{21};
     auto serverContext =
         client_1_.Wallet().mutable_ServerContext(alice_nym_id_, server_id_);
     auto clientContext =
@@ -1959,4 +2151,686 @@ TEST_F(Test_Basic, resync)
         NO_TRANSACTION,
         0);
 }
+
+TEST_F(Test_Basic, getBoxReceipts_after_processInbox)
+{
+    const RequestNumber sequence{22};
+    auto serverContext =
+        client_1_.Wallet().mutable_ServerContext(alice_nym_id_, server_id_);
+    auto clientContext =
+        server_.Wallet().ClientContext(server_.NymID(), alice_nym_id_);
+
+    ASSERT_TRUE(clientContext);
+
+    const auto accountID = find_issuer_account();
+
+    ASSERT_FALSE(accountID->empty());
+
+    verify_state_pre(*clientContext, serverContext.It(), sequence);
+    const auto [requestNumber, transactionNumber, reply] =
+        client_1_.OTAPI().getBoxReceipts(
+            serverContext.It(), accountID, INBOX_TYPE, NumList());
+    const auto& [result, message] = reply;
+    verify_state_post(
+        client_1_,
+        *clientContext,
+        serverContext.It(),
+        sequence,
+        requestNumber,
+        transactionNumber,
+        result,
+        message,
+        SUCCESS,
+        NYMBOX_SAME,
+        NO_TRANSACTION,
+        0);
+
+    // The inbox was emptied by processInbox, so there is nothing to send
+    EXPECT_FALSE(message->m_bBool);
+    EXPECT_FALSE(message->m_ascPayload.Exists());
+}
+
+TEST_F(Test_Basic, getMarketList)
+{
+    const RequestNumber sequence{23};
+    auto serverContext =
+        client_1_.Wallet().mutable_ServerContext(alice_nym_id_, server_id_);
+    auto clientContext =
+        server_.Wallet().ClientContext(server_.NymID(), alice_nym_id_);
+
+    ASSERT_TRUE(clientContext);
+
+    const auto market = server_.Server().Cron().GetOrCreateMarket(
+        find_unit_definition_id(), Identifier::Random(), 1);
+
+    ASSERT_TRUE(market);
+
+    const auto marketID = Identifier::Factory(*market);
+    verify_state_pre(*clientContext, serverContext.It(), sequence);
+    const auto [requestNumber, transactionNumber, reply] =
+        client_1_.OTAPI().getMarketList(serverContext.It());
+    const auto& [result, message] = reply;
+    verify_state_post(
+        client_1_,
+        *clientContext,
+        serverContext.It(),
+        sequence,
+        requestNumber,
+        transactionNumber,
+        result,
+        message,
+        SUCCESS,
+        NYMBOX_SAME,
+        NO_TRANSACTION,
+        0);
+
+    ASSERT_LT(0, message->m_lDepth);
+
+    std::unique_ptr<OTDB::MarketList> list{
+        dynamic_cast<OTDB::MarketList*>(OTDB::DecodeObject(
+            OTDB::STORED_OBJ_MARKET_LIST, message->m_ascPayload.Get()))};
+
+    ASSERT_TRUE(list);
+
+    bool found{false};
+
+    for (std::size_t i = 0; i < list->GetMarketDataCount(); ++i) {
+        const auto* data = list->GetMarketData(i);
+
+        if (marketID->str() != data->market_id) { continue; }
+
+        found = true;
+
+        EXPECT_EQ("1", data->scale);
+        EXPECT_EQ("0", data->number_bids);
+        EXPECT_EQ("0", data->number_asks);
+    }
+
+    EXPECT_TRUE(found);
+}
+
+TEST_F(Test_Basic, retried_request_gets_cached_reply)
+{
+    const RequestNumber sequence{24};
+    auto serverContext =
+        client_1_.Wallet().mutable_ServerContext(alice_nym_id_, server_id_);
+    auto clientContext =
+        server_.Wallet().ClientContext(server_.NymID(), alice_nym_id_);
+
+    ASSERT_TRUE(clientContext);
+
+    verify_state_pre(*clientContext, serverContext.It(), sequence);
+    auto [requestNumber, request] = serverContext.It().InitializeServerCommand(
+        MessageType::getMarketList, -1);
+
+    ASSERT_EQ(sequence, requestNumber);
+    ASSERT_TRUE(request);
+    ASSERT_TRUE(serverContext.It().FinalizeServerCommand(*request));
+
+    const String serialized(*request);
+    auto& processor = server_.Server().CommandProcessor();
+    std::mutex mutex{};
+    Lock lock(mutex);
+    auto original = server_.Factory().Message();
+
+    ASSERT_TRUE(original);
+    ASSERT_TRUE(processor.ProcessUserCommand(*request, *original, lock));
+    EXPECT_TRUE(original->m_bSuccess);
+
+    const String sent(*original);
+    clientContext =
+        server_.Wallet().ClientContext(server_.NymID(), alice_nym_id_);
+
+    EXPECT_EQ(sequence + 1, clientContext->Request());
+
+    // The client resends the same request after timing out
+    auto retried = server_.Factory().Message();
+
+    ASSERT_TRUE(retried);
+    ASSERT_TRUE(retried->LoadContractFromString(serialized));
+
+    auto retriedReply = server_.Factory().Message();
+
+    ASSERT_TRUE(retriedReply);
+    ASSERT_TRUE(processor.ProcessUserCommand(*retried, *retriedReply, lock));
+    EXPECT_STREQ(sent.Get(), String(*retriedReply).Get());
+
+    clientContext =
+        server_.Wallet().ClientContext(server_.NymID(), alice_nym_id_);
+
+    EXPECT_EQ(sequence + 1, clientContext->Request());
+
+    // A different request which reuses the number is checked as usual
+    auto [changedNumber, changed] = serverContext.It().InitializeServerCommand(
+        MessageType::getNymMarketOffers, requestNumber);
+
+    ASSERT_EQ(requestNumber, changedNumber);
+    ASSERT_TRUE(changed);
+    ASSERT_TRUE(serverContext.It().FinalizeServerCommand(*changed));
+
+    auto changedReply = server_.Factory().Message();
+
+    ASSERT_TRUE(changedReply);
+
+    processor.ProcessUserCommand(*changed, *changedReply, lock);
+
+    EXPECT_FALSE(changedReply->m_bSuccess);
+
+    clientContext =
+        server_.Wallet().ClientContext(server_.NymID(), alice_nym_id_);
+
+    EXPECT_EQ(sequence + 1, clientContext->Request());
+
+    // Registration clears the cached replies
+    lock.unlock();
+    const auto [registerNumber, registerTransaction, registerReply] =
+        client_1_.OTAPI().registerNym(serverContext.It());
+    const auto& [registerResult, registerMessage] = registerReply;
+
+    ASSERT_EQ(SendResult::VALID_REPLY, registerResult);
+    ASSERT_TRUE(registerMessage);
+    EXPECT_TRUE(registerMessage->m_bSuccess);
+
+    lock.lock();
+    retried = server_.Factory().Message();
+
+    ASSERT_TRUE(retried);
+    ASSERT_TRUE(retried->LoadContractFromString(serialized));
+
+    retriedReply = server_.Factory().Message();
+
+    ASSERT_TRUE(retriedReply);
+
+    processor.ProcessUserCommand(*retried, *retriedReply, lock);
+
+    EXPECT_FALSE(retriedReply->m_bSuccess);
+    EXPECT_STRNE(sent.Get(), String(*retriedReply).Get());
+}
+
+TEST_F(Test_Basic, reload_cron_markets_and_items)
+{
+    const auto serverNym = server_.Wallet().Nym(server_.NymID());
+
+    ASSERT_TRUE(serverNym);
+
+    const auto unitID = find_unit_definition_id();
+    const auto currencyID = Identifier::Random();
+    const auto now = OTTimeGetCurrentTime();
+    std::unique_ptr<OTCron> cron{server_.Factory().Cron(server_)};
+
+    ASSERT_TRUE(cron);
+
+    cron->SetNotaryID(server_id_);
+    cron->SetServerNym(serverNym);
+    cron->SetCronFile(TEST_CRON_FILE);
+    std::vector<OTIdentifier> markets{};
+
+    for (const std::int64_t scale : {1, 10, 100, 1000}) {
+        const auto market = cron->GetOrCreateMarket(unitID, currencyID, scale);
+
+        ASSERT_TRUE(market);
+
+        markets.emplace_back(Identifier::Factory(*market));
+    }
+
+    const std::vector<TransactionNumber> items{900001, 900002, 900003};
+
+    for (const auto number : items) {
+        std::shared_ptr<OTCronItem> plan{
+            server_.Factory()
+                .PaymentPlan(
+                    server_id_,
+                    unitID,
+                    find_issuer_account(),
+                    alice_nym_id_,
+                    find_user_account(),
+                    bob_nym_id_)
+                .release()};
+
+        ASSERT_TRUE(plan);
+
+        plan->SetTransactionNum(number);
+        plan->SetCreationDate(now);
+
+        ASSERT_TRUE(plan->SignContract(*serverNym));
+        ASSERT_TRUE(plan->SaveContract());
+        ASSERT_TRUE(cron->AddCronItem(plan, false, now));
+    }
+
+    ASSERT_TRUE(cron->SaveCron());
+
+    // Markets are read from storage serially and parsed in parallel with the
+    // cron items
+    std::unique_ptr<OTCron> reloaded{server_.Factory().Cron(server_)};
+
+    ASSERT_TRUE(reloaded);
+
+    reloaded->SetNotaryID(server_id_);
+    reloaded->SetServerNym(serverNym);
+    reloaded->SetCronFile(TEST_CRON_FILE);
+
+    ASSERT_TRUE(reloaded->LoadCron());
+
+    for (const auto& id : markets) {
+        const auto market = reloaded->GetMarket(id);
+
+        ASSERT_TRUE(market);
+        EXPECT_EQ(id->str(), Identifier::Factory(*market)->str());
+    }
+
+    for (const auto number : items) {
+        const auto item = reloaded->GetItemByOfficialNum(number);
+
+        ASSERT_TRUE(item);
+        EXPECT_EQ(number, item->GetTransactionNum());
+    }
+
+    erase_test_cron();
+}
+
+TEST_F(Test_Basic, market_price_levels)
+{
+    const auto serverNym = server_.Wallet().Nym(server_.NymID());
+
+    ASSERT_TRUE(serverNym);
+
+    const auto unitID = find_unit_definition_id();
+    const auto currencyID = Identifier::Random();
+    std::unique_ptr<OTCron> cron{server_.Factory().Cron(server_)};
+
+    ASSERT_TRUE(cron);
+
+    cron->SetNotaryID(server_id_);
+    cron->SetServerNym(serverNym);
+    // Fills save the cron file along with the market
+    cron->SetCronFile(TEST_CRON_FILE);
+    const auto market = cron->GetOrCreateMarket(unitID, currencyID, 1);
+
+    ASSERT_TRUE(market);
+
+    const auto add = [&](const bool selling,
+                         const std::int64_t price,
+                         const std::int64_t total,
+                         const std::int64_t finished,
+                         const TransactionNumber number) -> bool {
+        return add_offer(
+            *market, *serverNym, selling, price, total, finished, number);
+    };
+    const auto offers = [&](std::vector<TransactionNumber>& bids,
+                            std::vector<TransactionNumber>& asks,
+                            std::map<TransactionNumber, std::int64_t>&
+                                available) -> void {
+        Armored list{};
+        std::int32_t count{0};
+
+        ASSERT_TRUE(market->GetOfferList(list, 0, count));
+        ASSERT_LT(0, count);
+
+        std::unique_ptr<OTDB::OfferListMarket> decoded{
+            dynamic_cast<OTDB::OfferListMarket*>(OTDB::DecodeObject(
+                OTDB::STORED_OBJ_OFFER_LIST_MARKET, list.Get()))};
+
+        ASSERT_TRUE(decoded);
+
+        for (std::size_t i = 0; i < decoded->GetBidDataCount(); ++i) {
+            const auto* bid = decoded->GetBidData(i);
+            const auto number = std::stoll(bid->transaction_id);
+            bids.emplace_back(number);
+            available[number] = std::stoll(bid->available_assets);
+        }
+
+        for (std::size_t i = 0; i < decoded->GetAskDataCount(); ++i) {
+            const auto* ask = decoded->GetAskData(i);
+            const auto number = std::stoll(ask->transaction_id);
+            asks.emplace_back(number);
+            available[number] = std::stoll(ask->available_assets);
+        }
+    };
+
+    ASSERT_TRUE(add(false, 10, 100, 0, 901001));
+    ASSERT_TRUE(add(false, 12, 50, 0, 901002));
+    ASSERT_TRUE(add(false, 12, 30, 0, 901003));
+    // Partially filled before it was added, as when a market is reloaded
+    ASSERT_TRUE(add(true, 20, 40, 15, 901004));
+    ASSERT_TRUE(add(true, 15, 10, 0, 901005));
+    ASSERT_TRUE(add(true, 20, 5, 0, 901006));
+    EXPECT_FALSE(add(true, 25, 5, 0, 901006));
+
+    EXPECT_EQ(12, market->GetHighestBidPrice());
+    EXPECT_EQ(15, market->GetLowestAskPrice());
+    EXPECT_EQ(3u, market->GetBidCount());
+    EXPECT_EQ(3u, market->GetAskCount());
+    // Only the part of an offer which has not been filled is available
+    EXPECT_EQ(25 + 10 + 5, market->GetTotalAvailableAssets());
+    ASSERT_TRUE(market->SaveMarket());
+
+    std::vector<TransactionNumber> bids{};
+    std::vector<TransactionNumber> asks{};
+    std::map<TransactionNumber, std::int64_t> available{};
+    offers(bids, asks, available);
+
+    // Levels are listed by price, and the offers within a level in the order
+    // they were added
+    const std::vector<TransactionNumber> expectedBids{901001, 901002, 901003};
+    const std::vector<TransactionNumber> expectedAsks{901005, 901004, 901006};
+
+    EXPECT_EQ(expectedBids, bids);
+    EXPECT_EQ(expectedAsks, asks);
+    EXPECT_EQ(25, available.at(901004));
+
+    // Removing the only offer at the best price removes that level
+    ASSERT_TRUE(market->RemoveOffer(901005));
+    EXPECT_EQ(20, market->GetLowestAskPrice());
+    EXPECT_EQ(2u, market->GetAskCount());
+    EXPECT_EQ(25 + 5, market->GetTotalAvailableAssets());
+
+    // A level stays as long as any offer is left on it
+    ASSERT_TRUE(market->RemoveOffer(901002));
+    EXPECT_EQ(12, market->GetHighestBidPrice());
+    ASSERT_TRUE(market->RemoveOffer(901003));
+    EXPECT_EQ(10, market->GetHighestBidPrice());
+    EXPECT_EQ(1u, market->GetBidCount());
+    EXPECT_FALSE(market->RemoveOffer(901003));
+
+    // The partial fill and the remaining levels survive a reload
+    auto reloaded = server_.Factory().Market(server_id_, unitID, currencyID, 1);
+
+    ASSERT_TRUE(reloaded);
+
+    reloaded->SetCronPointer(*cron);
+
+    ASSERT_TRUE(reloaded->LoadMarket());
+    EXPECT_EQ(10, reloaded->GetHighestBidPrice());
+    EXPECT_EQ(20, reloaded->GetLowestAskPrice());
+    EXPECT_EQ(1u, reloaded->GetBidCount());
+    EXPECT_EQ(2u, reloaded->GetAskCount());
+    EXPECT_EQ(25 + 5, reloaded->GetTotalAvailableAssets());
+
+    erase_test_cron();
+}
+
+TEST_F(Test_Basic, market_list_from_snapshots)
+{
+    const auto serverNym = server_.Wallet().Nym(server_.NymID());
+
+    ASSERT_TRUE(serverNym);
+
+    std::unique_ptr<OTCron> cron{server_.Factory().Cron(server_)};
+
+    ASSERT_TRUE(cron);
+
+    cron->SetNotaryID(server_id_);
+    cron->SetServerNym(serverNym);
+    const auto market = cron->GetOrCreateMarket(
+        find_unit_definition_id(), Identifier::Random(), 1);
+
+    ASSERT_TRUE(market);
+
+    const auto read = [&](std::string& bids, std::string& total) -> bool {
+        Armored packed{};
+        std::int32_t count{0};
+
+        if (false == cron->GetMarketList(packed, count)) { return false; }
+        if (1 != count) { return false; }
+
+        std::unique_ptr<OTDB::MarketList> list{
+            dynamic_cast<OTDB::MarketList*>(OTDB::DecodeObject(
+                OTDB::STORED_OBJ_MARKET_LIST, packed.Get()))};
+
+        if (false == bool(list)) { return false; }
+        if (1 != list->GetMarketDataCount()) { return false; }
+
+        bids = list->GetMarketData(0)->number_bids;
+        total = list->GetMarketData(0)->total_assets;
+
+        return true;
+    };
+    std::string bids{};
+    std::string total{};
+
+    ASSERT_TRUE(add_offer(*market, *serverNym, false, 10, 100, 0, 902001));
+    ASSERT_TRUE(add_offer(*market, *serverNym, true, 20, 40, 0, 902002));
+
+    // Changes are not visible until the market is saved
+    ASSERT_TRUE(read(bids, total));
+    EXPECT_EQ("0", bids);
+    EXPECT_EQ("0", total);
+    ASSERT_TRUE(market->SaveMarket());
+    ASSERT_TRUE(read(bids, total));
+    EXPECT_EQ("1", bids);
+    EXPECT_EQ("40", total);
+
+    // Queries only read published snapshots, so they are safe while the
+    // order book changes
+    std::atomic<bool> done{false};
+    std::atomic<int> failures{0};
+    std::atomic<int> reads{0};
+    std::thread reader([&]() -> void {
+        std::string readBids{};
+        std::string readTotal{};
+
+        while ((false == done) || (0 == reads)) {
+            if (read(readBids, readTotal)) {
+                const auto count = std::stoll(readBids);
+
+                if ((1 > count) || (11 < count)) { ++failures; }
+            } else {
+                ++failures;
+            }
+
+            ++reads;
+        }
+    });
+
+    for (TransactionNumber i = 0; i < 10; ++i) {
+        EXPECT_TRUE(
+            add_offer(*market, *serverNym, false, 11, 10, 0, 902100 + i));
+        EXPECT_TRUE(market->SaveMarket());
+    }
+
+    for (TransactionNumber i = 0; i < 10; ++i) {
+        EXPECT_TRUE(market->RemoveOffer(902100 + i));
+    }
+
+    done = true;
+    reader.join();
+
+    EXPECT_EQ(0, failures.load());
+    ASSERT_TRUE(read(bids, total));
+    EXPECT_EQ("1", bids);
+
+    // Put the running notary's cron file back
+    EXPECT_TRUE(server_.Server().Cron().SaveCron());
+}
+
+TEST_F(Test_Basic, account_activity_per_workflow)
+{
+    const auto accountID = find_issuer_account();
+    const auto nym = client_1_.Wallet().Nym(alice_nym_id_);
+
+    ASSERT_TRUE(nym);
+
+    const auto& activity =
+        client_1_.UI().AccountActivity(alice_nym_id_, accountID);
+    const auto rows = [&](const TransactionNumber number) -> std::size_t {
+        std::size_t output{0};
+        auto row = activity.First();
+
+        if (false == row->Valid()) { return output; }
+
+        while (true) {
+            if (number == row->Number()) { ++output; }
+            if (row->Last()) { break; }
+
+            row = activity.Next();
+        }
+
+        return output;
+    };
+    // Rows are updated by a background thread
+    const auto wait_for = [&](const TransactionNumber number,
+                              const std::size_t count) -> bool {
+        const auto deadline =
+            std::chrono::steady_clock::now() + std::chrono::seconds(30);
+
+        while (std::chrono::steady_clock::now() < deadline) {
+            if (count == rows(number)) { return true; }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+
+        return false;
+    };
+    std::unique_ptr<Cheque> cheque{
+        client_1_.Factory().Cheque(server_id_, find_unit_definition_id())};
+
+    ASSERT_TRUE(cheque);
+
+    const TransactionNumber number{cheque_transaction_number_ + 1000};
+    const auto now = OTTimeGetCurrentTime();
+
+    ASSERT_TRUE(cheque->IssueCheque(
+        CHEQUE_AMOUNT,
+        number,
+        now,
+        OTTimeAddTimeInterval(
+            now, OTTimeGetSecondsFromTime(OT_TIME_DAY_IN_SECONDS)),
+        accountID,
+        alice_nym_id_,
+        String(CHEQUE_MEMO),
+        bob_nym_id_));
+    ASSERT_TRUE(cheque->SignContract(*nym));
+    ASSERT_TRUE(cheque->SaveContract());
+
+    // Saving a new workflow adds its rows
+    const auto workflowID = client_1_.Workflow().WriteCheque(*cheque);
+
+    ASSERT_FALSE(workflowID->empty());
+    ASSERT_TRUE(wait_for(number, 1));
+
+    const auto existing = rows(cheque_transaction_number_);
+
+    // A new event on the same workflow adds a row, and leaves the rows of
+    // every other workflow alone
+    auto request = client_1_.Factory().Message();
+    auto reply = client_1_.Factory().Message();
+
+    ASSERT_TRUE(request);
+    ASSERT_TRUE(reply);
+
+    request->m_strNotaryID = String(server_id_);
+    reply->m_bSuccess = true;
+
+    ASSERT_TRUE(request->SignContract(*nym));
+    ASSERT_TRUE(request->SaveContract());
+    ASSERT_TRUE(reply->SignContract(*nym));
+    ASSERT_TRUE(reply->SaveContract());
+    ASSERT_TRUE(
+        client_1_.Workflow().CancelCheque(*cheque, *request, reply.get()));
+    EXPECT_TRUE(wait_for(number, 2));
+    EXPECT_EQ(existing, rows(cheque_transaction_number_));
+}
+
+TEST_F(Test_Basic, activity_thread_loads_rows_on_display)
+{
+    const auto threadID = client_1_.Contacts().ContactID(bob_nym_id_);
+
+    ASSERT_FALSE(threadID->empty());
+
+    const auto& thread =
+        client_1_.UI().ActivityThread(alice_nym_id_, threadID);
+    // Displaying a cheque row schedules the read of its contents
+    const auto loaded = [&]() -> bool {
+        auto row = thread.First();
+
+        while (row->Valid()) {
+            if ((StorageBox::OUTGOINGCHEQUE == row->Type()) &&
+                (CHEQUE_MEMO == row->Memo())) {
+
+                return false == row->Loading();
+            }
+
+            if (row->Last()) { break; }
+
+            row = thread.Next();
+        }
+
+        return false;
+    };
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    bool found{false};
+
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (loaded()) {
+            found = true;
+            break;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    ASSERT_TRUE(found);
+
+    // Rows which are displayed again keep their contents
+    for (int i = 0; i < 10; ++i) { EXPECT_TRUE(loaded()); }
+}
+
+TEST_F(Test_Basic, blank_number_list_format)
+{
+    const auto nym = client_1_.Wallet().Nym(alice_nym_id_);
+
+    ASSERT_TRUE(nym);
+
+    const auto serialize = [&](const bool ranges) -> std::string {
+        auto blank = client_1_.Factory().Transaction(
+            alice_nym_id_,
+            alice_nym_id_,
+            server_id_,
+            transactionType::blank,
+            originType::not_applicable,
+            cheque_transaction_number_ + 2000);
+
+        OT_ASSERT(blank);
+
+        blank->AddNumbersToTransaction(NumList(std::string("1-150,200")));
+        blank->SetNumberRanges(ranges);
+        blank->SignContract(*nym);
+        blank->SaveContract();
+        String output{};
+        blank->SaveContractRaw(output);
+
+        return output.Get();
+    };
+    const auto parse = [&](const std::string& input) -> std::int32_t {
+        auto blank = client_1_.Factory().Transaction(
+            alice_nym_id_, alice_nym_id_, server_id_);
+
+        OT_ASSERT(blank);
+
+        if (false == blank->LoadContractFromString(String(input))) {
+            return -1;
+        }
+
+        NumList output{};
+        blank->GetNumList(output);
+
+        return output.Count();
+    };
+
+    // Peers which did not announce support for runs get every number
+    const auto legacy = serialize(false);
+
+    EXPECT_NE(
+        std::string::npos,
+        legacy.find("totalListOfNumbers=\"1,2,3,4,5,"));
+    EXPECT_EQ(std::string::npos, legacy.find("1-150"));
+    EXPECT_EQ(151, parse(legacy));
+
+    const auto compact = serialize(true);
+
+    EXPECT_NE(
+        std::string::npos, compact.find("totalListOfNumbers=\"1-150,200\""));
+    EXPECT_EQ(151, parse(compact));
+}
 }  // namespace
@@ -209,4 +209,49 @@ TEST_F(Test_Messages, pushReply)
     EXPECT_EQ(payload, aliceCopy->Payload());
     EXPECT_TRUE(aliceCopy->Validate());
 }
+
+TEST_F(Test_Messages, number_ranges_version)
+{
+    const auto alice = client_.Wallet().Nym(alice_nym_id_);
+
+    ASSERT_TRUE(alice);
+
+    auto message = client_.Factory().Message();
+
+    ASSERT_TRUE(message);
+
+    // New messages announce that their sender parses "first-last" runs
+    EXPECT_TRUE(message->SupportsNumberRanges());
+
+    message->m_strCommand = Message::Command(MessageType::pingNotary).c_str();
+    message->m_strNymID = String(alice_nym_id_);
+    message->m_strNotaryID = String(server_id_);
+
+    ASSERT_TRUE(message->SignContract(*alice));
+    ASSERT_TRUE(message->SaveContract());
+
+    String serialized{};
+
+    ASSERT_TRUE(message->SaveContractRaw(serialized));
+
+    auto parsed = server_.Factory().Message();
+
+    ASSERT_TRUE(parsed);
+    ASSERT_TRUE(parsed->LoadContractFromString(serialized));
+    EXPECT_TRUE(parsed->SupportsNumberRanges());
+
+    // A message from an older peer carries an earlier version
+    std::string legacy{serialized.Get()};
+    const std::string current{"version=\"3.0\""};
+    const auto position = legacy.find(current);
+
+    ASSERT_NE(std::string::npos, position);
+
+    legacy.replace(position, current.size(), "version=\"2.0\"");
+    auto old = server_.Factory().Message();
+
+    ASSERT_TRUE(old);
+    ASSERT_TRUE(old->LoadContractFromString(String(legacy)));
+    EXPECT_FALSE(old->SupportsNumberRanges());
+}
 }  // namespace
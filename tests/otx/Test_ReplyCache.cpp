@@ -0,0 +1,155 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+
+#include "Internal.hpp"
+#include "server/ReplyCache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#define TEST_NYM_A "testReplyCacheA"
+#define TEST_NYM_B "testReplyCacheB"
+#define TEST_NYM_C "testReplyCacheC"
+
+using namespace opentxs;
+
+namespace
+{
+class Test_ReplyCache : public ::testing::Test
+{
+public:
+    static const opentxs::ArgList args_;
+
+    const opentxs::api::server::Manager& server_;
+    const std::string& folder_;
+
+    Test_ReplyCache()
+        : server_(OT::App().StartServer(args_, 0, true))
+        , folder_(server_.DataFolder())
+    {
+        // Replies stored by earlier runs must not satisfy these tests
+        server::ReplyCache cache{folder_, 1, 4};
+        cache.Clear(TEST_NYM_A);
+        cache.Clear(TEST_NYM_B);
+        cache.Clear(TEST_NYM_C);
+    }
+};
+
+const opentxs::ArgList Test_ReplyCache::args_{
+    {{OPENTXS_ARG_STORAGE_PLUGIN, {"mem"}}}};
+
+TEST_F(Test_ReplyCache, retry_returns_same_reply)
+{
+    const auto serverNym = server_.Wallet().Nym(server_.NymID());
+
+    ASSERT_TRUE(serverNym);
+
+    auto original = server_.Factory().Message();
+
+    ASSERT_TRUE(original);
+
+    original->m_strCommand = "pingNotaryResponse";
+    original->m_strNymID = TEST_NYM_A;
+    original->m_strNotaryID = String(server_.ID());
+    original->m_strRequestNum = "5";
+    original->m_bSuccess = true;
+
+    ASSERT_TRUE(original->SignContract(*serverNym));
+    ASSERT_TRUE(original->SaveContract());
+
+    const String sent(*original);
+
+    {
+        server::ReplyCache cache{folder_, 4, 4};
+        cache.Store(TEST_NYM_A, 5, "digest", sent.Get());
+    }
+
+    // A new cache reads the reply back from storage
+    server::ReplyCache cache{folder_, 4, 4};
+    std::string reply{};
+
+    ASSERT_TRUE(cache.Load(TEST_NYM_A, 5, "digest", reply));
+
+    // The processor returns the reply by loading it into the outgoing message
+    auto retried = server_.Factory().Message();
+
+    ASSERT_TRUE(retried);
+    ASSERT_TRUE(retried->LoadContractFromString(String(reply)));
+    EXPECT_STREQ(sent.Get(), String(*retried).Get());
+}
+
+TEST_F(Test_ReplyCache, changed_request_misses)
+{
+    server::ReplyCache cache{folder_, 4, 4};
+    cache.Store(TEST_NYM_A, 5, "digest", "reply");
+    std::string reply{};
+
+    EXPECT_FALSE(cache.Load(TEST_NYM_A, 5, "other digest", reply));
+    EXPECT_FALSE(cache.Load(TEST_NYM_A, 6, "digest", reply));
+    EXPECT_FALSE(cache.Load(TEST_NYM_B, 5, "digest", reply));
+    EXPECT_TRUE(reply.empty());
+    EXPECT_TRUE(cache.Load(TEST_NYM_A, 5, "digest", reply));
+    EXPECT_EQ("reply", reply);
+
+    cache.Clear(TEST_NYM_A);
+
+    EXPECT_FALSE(cache.Load(TEST_NYM_A, 5, "digest", reply));
+
+    server::ReplyCache reloaded{folder_, 4, 4};
+
+    EXPECT_FALSE(reloaded.Load(TEST_NYM_A, 5, "digest", reply));
+}
+
+TEST_F(Test_ReplyCache, replaces_oldest_request)
+{
+    server::ReplyCache cache{folder_, 4, 4};
+
+    for (RequestNumber i = 1; i < 6; ++i) {
+        cache.Store(TEST_NYM_A, i, "digest", std::to_string(i));
+    }
+
+    server::ReplyCache reloaded{folder_, 4, 4};
+
+    for (auto* instance : {&cache, &reloaded}) {
+        std::string reply{};
+
+        // Request 5 took over the record of request 1
+        EXPECT_FALSE(instance->Load(TEST_NYM_A, 1, "digest", reply));
+
+        for (RequestNumber i = 2; i < 6; ++i) {
+            ASSERT_TRUE(instance->Load(TEST_NYM_A, i, "digest", reply));
+            EXPECT_EQ(std::to_string(i), reply);
+        }
+    }
+}
+
+TEST_F(Test_ReplyCache, evicts_least_recently_used_nym)
+{
+    server::ReplyCache cache{folder_, 2, 4};
+    std::string reply{};
+    cache.Store(TEST_NYM_A, 5, "digest", "a");
+    cache.Store(TEST_NYM_B, 5, "digest", "b");
+
+    EXPECT_EQ(2, cache.Nyms());
+    EXPECT_TRUE(cache.Load(TEST_NYM_A, 5, "digest", reply));
+
+    // Only the least recently used nym leaves memory
+    cache.Store(TEST_NYM_C, 5, "digest", "c");
+
+    EXPECT_EQ(2, cache.Nyms());
+
+    // and its replies are reloaded from storage when it returns
+    ASSERT_TRUE(cache.Load(TEST_NYM_B, 5, "digest", reply));
+    EXPECT_EQ("b", reply);
+    EXPECT_EQ(2, cache.Nyms());
+    ASSERT_TRUE(cache.Load(TEST_NYM_A, 5, "digest", reply));
+    EXPECT_EQ("a", reply);
+    ASSERT_TRUE(cache.Load(TEST_NYM_C, 5, "digest", reply));
+    EXPECT_EQ("c", reply);
+}
+}  // namespace
@@ -0,0 +1,153 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+#define ALICE_NYM_NAME "Alice"
+#define BOB_PAYMENT_CODE                                                       \
+    "PM8TJS2JxQ5ztXUpBBRnpTbcUXbUHy2T1abfrb3KkAAtMEGNbey4oumH7Hc578WgQJhPjBxt" \
+    "eQ5GHHToTYHE3A1w6p7tU6KSoFmWBVbFGjKPisZDbP97"
+#define BOB_NYM_NAME "Bob"
+// ACTIVITY_THREAD_PAGE_SIZE
+#define TEST_PAGE_SIZE 50
+#define TEST_MAIL_COUNT 60
+#define TEST_FIRST_TIME 1000
+
+using namespace opentxs;
+
+namespace
+{
+class Test_ActivityThread : public ::testing::Test
+{
+public:
+    // A separate instance keeps these contacts out of the other ui tests
+    const opentxs::api::client::Manager& client_;
+    const std::string fingerprint_;
+    const OTIdentifier nym_id_;
+    const OTPaymentCode bob_payment_code_;
+
+    Test_ActivityThread()
+        : client_(opentxs::OT::App().StartClient({}, 1))
+        , fingerprint_(client_.Exec().Wallet_ImportSeed(
+              "response seminar brave tip suit recall often sound stick owner "
+              "lottery motion",
+              ""))
+        , nym_id_(Identifier::Factory(client_.Exec().CreateNymHD(
+              proto::CITEMTYPE_INDIVIDUAL,
+              ALICE_NYM_NAME,
+              fingerprint_,
+              0)))
+        , bob_payment_code_(client_.Factory().PaymentCode(BOB_PAYMENT_CODE))
+    {
+    }
+
+    /** Stores a message from Bob which was sent at TEST_FIRST_TIME + i */
+    bool receive(const std::size_t i) const
+    {
+        const auto nym = client_.Wallet().Nym(nym_id_);
+
+        if (false == bool(nym)) { return false; }
+
+        auto mail = client_.Factory().Message();
+
+        if (false == bool(mail)) { return false; }
+
+        mail->m_strCommand = String::Factory("sendNymMessage");
+        mail->m_strNymID = String::Factory(bob_payment_code_->ID());
+        mail->m_strNymID2 = String::Factory(nym_id_);
+        mail->m_strRequestNum = String::Factory(std::to_string(i));
+
+        if (false == mail->SignContract(*nym)) { return false; }
+
+        if (false == mail->SaveContract()) { return false; }
+
+        // The thread orders items by the time recorded in the message
+        mail->m_lTime = TEST_FIRST_TIME + i;
+
+        return false == client_.Activity()
+                            .Mail(nym_id_, *mail, StorageBox::MAILINBOX)
+                            .empty();
+    }
+
+    static std::int64_t timestamp(const ui::ActivityThreadItem& row)
+    {
+        return std::chrono::duration_cast<std::chrono::seconds>(
+                   row.Timestamp().time_since_epoch())
+            .count();
+    }
+
+    static bool wait_for_size(
+        const ui::ActivityThread& thread,
+        const std::size_t size)
+    {
+        for (int i = 0; i < 100; ++i) {
+            if (size == thread.Size()) { return true; }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+
+        return false;
+    }
+};
+
+TEST_F(Test_ActivityThread, load_more)
+{
+    ASSERT_FALSE(nym_id_->empty());
+    ASSERT_TRUE(bob_payment_code_->VerifyInternally());
+
+    const auto bob = client_.Contacts().NewContact(
+        BOB_NYM_NAME, bob_payment_code_->ID(), bob_payment_code_);
+
+    ASSERT_TRUE(bool(bob));
+
+    for (std::size_t i = 0; i < TEST_MAIL_COUNT; ++i) {
+        ASSERT_TRUE(receive(i));
+    }
+
+    const auto& thread = client_.UI().ActivityThread(nym_id_, bob->ID());
+
+    // Only the newest page is loaded when the widget is constructed
+    ASSERT_TRUE(wait_for_size(thread, TEST_PAGE_SIZE));
+
+    auto version = thread.Version();
+    auto first = thread.At(0, version);
+    auto last = thread.At(TEST_PAGE_SIZE - 1, version);
+
+    ASSERT_TRUE(first.get().Valid());
+    ASSERT_TRUE(last.get().Valid());
+    EXPECT_EQ(
+        TEST_FIRST_TIME + TEST_MAIL_COUNT - TEST_PAGE_SIZE,
+        timestamp(first.get()));
+    EXPECT_EQ(TEST_FIRST_TIME + TEST_MAIL_COUNT - 1, timestamp(last.get()));
+
+    // The older items are added in front of the loaded ones
+    ASSERT_TRUE(thread.LoadMore());
+    ASSERT_EQ(TEST_MAIL_COUNT, thread.Size());
+
+    version = thread.Version();
+    first = thread.At(0, version);
+    last = thread.At(TEST_MAIL_COUNT - 1, version);
+
+    ASSERT_TRUE(first.get().Valid());
+    ASSERT_TRUE(last.get().Valid());
+    EXPECT_EQ(TEST_FIRST_TIME, timestamp(first.get()));
+    EXPECT_EQ(TEST_FIRST_TIME + TEST_MAIL_COUNT - 1, timestamp(last.get()));
+
+    ui::List::ChangeSet changes{};
+
+    ASSERT_TRUE(thread.Changes(0, changes));
+    EXPECT_EQ(TEST_MAIL_COUNT, changes.inserted_.size());
+
+    // Every item has been loaded
+    EXPECT_FALSE(thread.LoadMore());
+    EXPECT_EQ(TEST_MAIL_COUNT, thread.Size());
+}
+}  // namespace
@@ -179,6 +179,37 @@ public:
                     ASSERT_EQ(true, chris.get().Last());
                     EXPECT_EQ(chris.get().DisplayName(), CHRIS_NYM_NAME);
 
+                    // Random access matches the cursor, owner first
+                    const auto version = contact_list_.Version();
+
+                    ASSERT_EQ(3, contact_list_.Size());
+
+                    const auto first = contact_list_.At(0, version);
+                    const auto second = contact_list_.At(1, version);
+                    const auto third = contact_list_.At(2, version);
+
+                    ASSERT_EQ(true, first.get().Valid());
+                    EXPECT_EQ(first.get().DisplayName(), ALICE_NYM_NAME);
+                    ASSERT_EQ(true, second.get().Valid());
+                    EXPECT_EQ(second.get().DisplayName(), BOB_NYM_NAME);
+                    ASSERT_EQ(true, third.get().Valid());
+                    EXPECT_EQ(third.get().DisplayName(), CHRIS_NYM_NAME);
+                    EXPECT_EQ(false, contact_list_.At(3, version).get().Valid());
+                    EXPECT_NE(0, contact_list_.Handle(0, version));
+                    EXPECT_NE(
+                        contact_list_.Handle(0, version),
+                        contact_list_.Handle(1, version));
+                    EXPECT_EQ(0, contact_list_.Handle(3, version));
+                    EXPECT_EQ(
+                        false, contact_list_.At(0, version + 1).get().Valid());
+
+                    ui::List::ChangeSet changes{};
+
+                    ASSERT_EQ(true, contact_list_.Changes(0, changes));
+                    EXPECT_EQ(version, changes.version_);
+                    EXPECT_EQ(3, changes.inserted_.size());
+                    EXPECT_EQ(0, changes.removed_.size());
+
                     IncrementCounter(contact_widget_id_);
                 } break;
                 case 6: {
@@ -54,6 +54,7 @@ typedef int64_t time64_t;
 %include "../../include/opentxs/core/crypto/OTCallback.hpp"
 %include "../../include/opentxs/core/crypto/OTCaller.hpp"
 %include "../../include/opentxs/ui/Widget.hpp"
+%include "../../include/opentxs/ui/List.hpp"
 %include "../../include/opentxs/ui/ListRow.hpp"
 %include "../../include/opentxs/ui/BalanceItem.hpp"
 %include "../../include/opentxs/ui/AccountActivity.hpp"